@@ -209,6 +209,7 @@ void ResourceSaver::_bind_methods() {
 	BIND_BITFIELD_FLAG(FLAG_SAVE_BIG_ENDIAN);
 	BIND_BITFIELD_FLAG(FLAG_COMPRESS);
 	BIND_BITFIELD_FLAG(FLAG_REPLACE_SUBRESOURCE_PATHS);
+	BIND_BITFIELD_FLAG(FLAG_INCREMENTAL);
 }
 
 ////// Logger ///////
@@ -0,0 +1,135 @@
+/**************************************************************************/
+/*  frame_trace.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "frame_trace.h"
+
+#include "core/io/file_access.h"
+#include "core/os/thread.h"
+
+SafeFlag FrameTrace::enabled;
+SafeNumeric<uint64_t> FrameTrace::clear_ticks;
+
+Mutex FrameTrace::buffers_mutex;
+LocalVector<FrameTrace::ThreadBuffer *> FrameTrace::buffers;
+SafeNumeric<uint32_t> FrameTrace::buffers_generation;
+
+thread_local FrameTrace::ThreadBuffer *FrameTrace::thread_buffer = nullptr;
+thread_local uint32_t FrameTrace::thread_buffer_generation = 0;
+
+FrameTrace::ThreadBuffer *FrameTrace::_register_thread() {
+	ThreadBuffer *buffer = memnew(ThreadBuffer);
+	buffer->thread_id = Thread::get_caller_id();
+
+	MutexLock lock(buffers_mutex);
+	buffers.push_back(buffer);
+	return buffer;
+}
+
+void FrameTrace::set_enabled(bool p_enabled) {
+	enabled.set_to(p_enabled);
+}
+
+void FrameTrace::record(const char *p_name, uint64_t p_begin, uint64_t p_end) {
+	ThreadBuffer *buffer = thread_buffer;
+	const uint32_t generation = buffers_generation.get();
+	if (unlikely(!buffer || thread_buffer_generation != generation)) {
+		buffer = _register_thread();
+		thread_buffer = buffer;
+		thread_buffer_generation = generation;
+	}
+
+	// Only the owning thread writes to its buffer, so publishing the new count is enough.
+	uint64_t index = buffer->written.get();
+	Event &event = buffer->events[index & (BUFFER_SIZE - 1)];
+	event.name = p_name;
+	event.begin = p_begin;
+	event.duration = p_end - p_begin;
+	buffer->written.set(index + 1);
+}
+
+void FrameTrace::clear() {
+	// Buffers may be written concurrently, so events are filtered on export instead of being erased.
+	clear_ticks.set(OS::get_singleton()->get_ticks_usec());
+}
+
+String FrameTrace::to_chrome_trace_json() {
+	const uint64_t since = clear_ticks.get();
+
+	String json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+	bool first = true;
+
+	MutexLock lock(buffers_mutex);
+	for (uint32_t tid = 0; tid < buffers.size(); tid++) {
+		const ThreadBuffer *buffer = buffers[tid];
+
+		const String thread_name = buffer->thread_id == Thread::get_main_id() ? String("Main Thread") : vformat("Thread %d", (int64_t)buffer->thread_id);
+		json += vformat("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"%s\"}}", first ? "" : ",", tid, thread_name);
+		first = false;
+
+		const uint64_t written = buffer->written.get();
+		const uint64_t start = written > BUFFER_SIZE ? written - BUFFER_SIZE : 0;
+		for (uint64_t i = start; i < written; i++) {
+			const Event event = buffer->events[i & (BUFFER_SIZE - 1)];
+			if (buffer->written.get() >= i + BUFFER_SIZE) {
+				// The owning thread has wrapped around and may be overwriting this slot.
+				continue;
+			}
+			if (event.begin < since) {
+				continue;
+			}
+			json += vformat(",{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%d,\"dur\":%d}", String(event.name).json_escape(), tid, (int64_t)event.begin, (int64_t)event.duration);
+		}
+	}
+
+	json += "]}";
+	return json;
+}
+
+Error FrameTrace::save_chrome_trace(const String &p_path) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), err, vformat("Cannot save frame trace to file '%s'.", p_path));
+
+	f->store_string(to_chrome_trace_json());
+	return OK;
+}
+
+void FrameTrace::finalize() {
+	// Must not be called while other threads are still recording events.
+	enabled.clear();
+
+	MutexLock lock(buffers_mutex);
+	for (ThreadBuffer *buffer : buffers) {
+		memdelete(buffer);
+	}
+	buffers.clear();
+	buffers_generation.increment();
+	thread_buffer = nullptr;
+}
@@ -0,0 +1,110 @@
+/**************************************************************************/
+/*  frame_trace.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/mutex.h"
+#include "core/os/os.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+// Lightweight scoped timers for the main loop phases.
+//
+// Scopes are compiled in all builds and cost a single flag check while
+// tracing is disabled. When enabled, each thread appends completed scopes to
+// its own ring buffer without locking; the buffers can be exported as a
+// Chrome trace (also readable by Perfetto) at any time.
+class FrameTrace {
+public:
+	struct Event {
+		const char *name = nullptr;
+		uint64_t begin = 0;
+		uint64_t duration = 0;
+	};
+
+	// Events kept per thread before the oldest ones are overwritten.
+	static constexpr uint32_t BUFFER_SIZE = 1 << 14;
+
+private:
+	struct ThreadBuffer {
+		uint64_t thread_id = 0;
+		SafeNumeric<uint64_t> written;
+		Event events[BUFFER_SIZE];
+	};
+
+	static SafeFlag enabled;
+	static SafeNumeric<uint64_t> clear_ticks;
+
+	static Mutex buffers_mutex;
+	static LocalVector<ThreadBuffer *> buffers;
+	// Bumped by finalize(), so threads stop using buffers that were freed.
+	static SafeNumeric<uint32_t> buffers_generation;
+
+	static thread_local ThreadBuffer *thread_buffer;
+	static thread_local uint32_t thread_buffer_generation;
+
+	static ThreadBuffer *_register_thread();
+
+public:
+	_FORCE_INLINE_ static bool is_enabled() { return enabled.is_set(); }
+	static void set_enabled(bool p_enabled);
+
+	static void record(const char *p_name, uint64_t p_begin, uint64_t p_end);
+
+	// Discards all the events recorded so far.
+	static void clear();
+	static String to_chrome_trace_json();
+	static Error save_chrome_trace(const String &p_path);
+
+	static void finalize();
+};
+
+class FrameTraceScope {
+	const char *name = nullptr;
+	uint64_t begin = 0;
+
+public:
+	_FORCE_INLINE_ FrameTraceScope(const char *p_name) {
+		if (unlikely(FrameTrace::is_enabled())) {
+			name = p_name;
+			begin = OS::get_singleton()->get_ticks_usec();
+		}
+	}
+
+	_FORCE_INLINE_ ~FrameTraceScope() {
+		if (unlikely(name)) {
+			FrameTrace::record(name, begin, OS::get_singleton()->get_ticks_usec());
+		}
+	}
+};
+
+// Times the rest of the enclosing block. Only one scope can be opened per block.
+// The name must be a string literal or otherwise outlive the recorded events.
+#define FRAME_TRACE_SCOPE(m_name) FrameTraceScope _frame_trace_scope(m_name)
@@ -49,7 +49,8 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
 
-	bool exists = files.has(pmd5);
+	PackedFile *existing = files.getptr(pmd5);
+	bool exists = existing != nullptr;
 
 	PackedFile pf;
 	pf.encrypted = p_encrypted;
@@ -61,8 +62,10 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 	}
 	pf.src = p_src;
 
-	if (!exists || p_replace_files) {
-		files[pmd5] = pf;
+	if (!exists) {
+		files.insert(pmd5, pf);
+	} else if (p_replace_files) {
+		*existing = pf;
 	}
 
 	if (!exists) {
@@ -70,18 +73,27 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 		PackedDir *cd = root;
 
 		if (simplified_path.contains_char('/')) { // In a subdirectory.
-			Vector<String> ds = simplified_path.get_base_dir().split("/");
-
-			for (int j = 0; j < ds.size(); j++) {
-				if (!cd->subdirs.has(ds[j])) {
-					PackedDir *pd = memnew(PackedDir);
-					pd->name = ds[j];
-					pd->parent = cd;
-					cd->subdirs[pd->name] = pd;
-					cd = pd;
-				} else {
-					cd = cd->subdirs[ds[j]];
+			String base_dir = simplified_path.get_base_dir();
+			if (last_dir && base_dir == last_dir_path) {
+				cd = last_dir;
+			} else {
+				Vector<String> ds = base_dir.split("/");
+
+				for (int j = 0; j < ds.size(); j++) {
+					PackedDir **subdir = cd->subdirs.getptr(ds[j]);
+					if (!subdir) {
+						PackedDir *pd = memnew(PackedDir);
+						pd->name = ds[j];
+						pd->parent = cd;
+						cd->subdirs[pd->name] = pd;
+						cd = pd;
+					} else {
+						cd = *subdir;
+					}
 				}
+
+				last_dir_path = base_dir;
+				last_dir = cd;
 			}
 		}
 		String filename = simplified_path.get_file();
@@ -125,6 +137,10 @@ void PackedData::add_pack_source(PackSource *p_source) {
 	}
 }
 
+void PackedData::reserve_paths(uint32_t p_count) {
+	files.reserve(files.size() + p_count);
+}
+
 uint8_t *PackedData::get_file_hash(const String &p_path) {
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
@@ -154,6 +170,8 @@ void PackedData::_get_file_paths(PackedDir *p_dir, const String &p_parent_dir, H
 
 void PackedData::clear() {
 	files.clear();
+	last_dir_path = String();
+	last_dir = nullptr;
 	_free_packed_dirs(root);
 	root = memnew(PackedDir);
 }
@@ -276,6 +294,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	}
 
 	int file_count = f->get_32();
+	uint64_t start_time = OS::get_singleton()->get_ticks_usec();
 
 	if (rel_filebase) {
 		file_base += pck_start_pos;
@@ -297,9 +316,14 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		f = fae;
 	}
 
+	// Every entry takes more than one byte, so larger counts come from a corrupted directory.
+	if (file_count > 0 && (uint64_t)file_count <= f->get_length()) {
+		PackedData::get_singleton()->reserve_paths(file_count);
+	}
+
+	CharString cs;
 	for (int i = 0; i < file_count; i++) {
 		uint32_t sl = f->get_32();
-		CharString cs;
 		cs.resize(sl + 1);
 		f->get_buffer((uint8_t *)cs.ptr(), sl);
 		cs[sl] = 0;
@@ -318,6 +342,8 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		}
 	}
 
+	print_verbose(vformat("Loaded %d files from pack \"%s\" in %.3f ms.", file_count, p_path, (OS::get_singleton()->get_ticks_usec() - start_time) / 1000.0));
+
 	return true;
 }
 
@@ -102,6 +102,11 @@ private:
 
 	PackedDir *root = nullptr;
 
+	// Directory of the last added path. Packs list files grouped by folder,
+	// so most paths can skip walking the directory tree.
+	String last_dir_path;
+	PackedDir *last_dir = nullptr;
+
 	static inline PackedData *singleton = nullptr;
 	bool disabled = false;
 
@@ -110,6 +115,7 @@ private:
 
 public:
 	void add_pack_source(PackSource *p_source);
+	void reserve_paths(uint32_t p_count); // for PackSource
 	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false); // for PackSource
 	void remove_path(const String &p_path);
 	uint8_t *get_file_hash(const String &p_path);
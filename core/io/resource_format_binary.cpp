@@ -98,6 +98,12 @@ enum {
 	FORMAT_VERSION_NO_NODEPATH_PROPERTY = 3,
 };
 
+// Incremental saves append patch blocks to the end of the file. A patch block has this bit set
+// in its property count and is followed by the offset of the block it patches.
+static constexpr uint32_t RESOURCE_PATCH_BIT = 0x80000000;
+// Past this many stacked patches, a resource is written whole again to keep loading cheap.
+static constexpr uint32_t RESOURCE_PATCH_MAX_DEPTH = 8;
+
 void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
 	uint32_t extra = 4 - (p_len % 4);
 	if (extra < 4) {
@@ -672,6 +678,71 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 	return OK; //never reach anyway
 }
 
+Error ResourceLoaderBinary::_parse_resource_properties(LocalVector<Pair<StringName, Variant>> &r_properties, uint32_t p_depth) {
+	uint32_t pc = f->get_32();
+	uint64_t base_offset = 0;
+	if (pc & RESOURCE_PATCH_BIT) {
+		pc &= ~RESOURCE_PATCH_BIT;
+		base_offset = f->get_64();
+	}
+
+	LocalVector<Pair<StringName, Variant>> properties;
+	properties.reserve(pc);
+
+	for (uint32_t i = 0; i < pc; i++) {
+		StringName name = _get_string();
+
+		if (name == StringName()) {
+			error = ERR_FILE_CORRUPT;
+			ERR_FAIL_V(ERR_FILE_CORRUPT);
+		}
+
+		Variant value;
+
+		error = parse_variant(value);
+		if (error) {
+			return error;
+		}
+
+		properties.push_back(Pair<StringName, Variant>(name, value));
+	}
+
+	if (base_offset == 0) {
+		r_properties = std::move(properties);
+		return OK;
+	}
+
+	// This is a patch block, replay it on top of the properties of the block it patches.
+	if (p_depth >= RESOURCE_PATCH_MAX_DEPTH || base_offset >= f->get_length()) {
+		error = ERR_FILE_CORRUPT;
+		ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Invalid resource patch chain.", local_path));
+	}
+
+	f->seek(base_offset);
+	_ALLOW_DISCARD_ get_unicode_string(); // Type, same as the patch.
+
+	error = _parse_resource_properties(r_properties, p_depth + 1);
+	if (error) {
+		return error;
+	}
+
+	HashMap<StringName, uint32_t> property_indices;
+	for (uint32_t i = 0; i < r_properties.size(); i++) {
+		property_indices[r_properties[i].first] = i;
+	}
+
+	for (Pair<StringName, Variant> &property : properties) {
+		HashMap<StringName, uint32_t>::ConstIterator E = property_indices.find(property.first);
+		if (E) {
+			r_properties[E->value].second = property.second;
+		} else {
+			r_properties.push_back(property);
+		}
+	}
+
+	return OK;
+}
+
 Ref<Resource> ResourceLoaderBinary::get_resource() {
 	return resource;
 }
@@ -705,22 +776,24 @@ Error ResourceLoaderBinary::load() {
 		}
 	}
 
-	for (int i = 0; i < internal_resources.size(); i++) {
-		bool main = i == (internal_resources.size() - 1);
+	const int load_count = internal_load_order.is_empty() ? internal_resources.size() : internal_load_order.size();
+	for (int i = 0; i < load_count; i++) {
+		bool main = i == (load_count - 1);
+		int res_index = internal_load_order.is_empty() ? i : int(internal_load_order[i]);
 
 		//maybe it is loaded already
 		String path;
 		String id;
 
 		if (!main) {
-			path = internal_resources[i].path;
+			path = internal_resources[res_index].path;
 
 			if (path.begins_with("local://")) {
 				path = path.replace_first("local://", "");
 				id = path;
 				path = res_path + "::" + path;
 
-				internal_resources.write[i].path = path; // Update path.
+				internal_resources.write[res_index].path = path; // Update path.
 			}
 
 			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
@@ -738,7 +811,7 @@ Error ResourceLoaderBinary::load() {
 			}
 		}
 
-		uint64_t offset = internal_resources[i].offset;
+		uint64_t offset = internal_resources[res_index].offset;
 
 		f->seek(offset);
 
@@ -807,26 +880,19 @@ Error ResourceLoaderBinary::load() {
 			internal_index_cache[path] = res;
 		}
 
-		int pc = f->get_32();
+		LocalVector<Pair<StringName, Variant>> properties;
+		error = _parse_resource_properties(properties);
+		if (error) {
+			return error;
+		}
 
 		//set properties
 
 		Dictionary missing_resource_properties;
 
-		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
-
-			if (name == StringName()) {
-				error = ERR_FILE_CORRUPT;
-				ERR_FAIL_V(ERR_FILE_CORRUPT);
-			}
-
-			Variant value;
-
-			error = parse_variant(value);
-			if (error) {
-				return error;
-			}
+		for (Pair<StringName, Variant> &property : properties) {
+			const StringName &name = property.first;
+			Variant &value = property.second;
 
 			bool set_valid = true;
 			if (value.get_type() == Variant::OBJECT && missing_resource == nullptr && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
@@ -884,7 +950,7 @@ Error ResourceLoaderBinary::load() {
 #endif
 
 		if (progress) {
-			*progress = (i + 1) / float(internal_resources.size());
+			*progress = (i + 1) / float(load_count);
 		}
 
 		resource_cache.push_back(res);
@@ -938,6 +1004,9 @@ void ResourceLoaderBinary::get_classes_used(Ref<FileAccess> p_f, HashSet<StringN
 	}
 
 	for (int i = 0; i < internal_resources.size(); i++) {
+		if (internal_resources[i].offset == 0) {
+			continue; // Dropped by an incremental save.
+		}
 		p_f->seek(internal_resources[i].offset);
 		String t = get_unicode_string();
 		ERR_FAIL_COND(p_f->get_error() != OK);
@@ -978,6 +1047,96 @@ void ResourceLoaderBinary::get_dependencies(Ref<FileAccess> p_f, List<String> *p
 	}
 }
 
+void ResourceLoaderBinary::_read_external_resources(uint32_t p_count, bool p_keep_uuid_paths) {
+	for (uint32_t i = 0; i < p_count; i++) {
+		ExtResource er;
+		er.type = get_unicode_string();
+		er.path = get_unicode_string();
+		if (using_uids) {
+			er.uid = ResourceUID::ID(f->get_64());
+			if (!p_keep_uuid_paths && er.uid != ResourceUID::INVALID_ID) {
+				if (ResourceUID::get_singleton()->has_id(er.uid)) {
+					// If a UID is found and the path is valid, it will be used, otherwise, it falls back to the path.
+					er.path = ResourceUID::get_singleton()->get_id_path(er.uid);
+				} else {
+#ifdef TOOLS_ENABLED
+					// Silence a warning that can happen during the initial filesystem scan due to cache being regenerated.
+					if (ResourceLoader::get_resource_uid(res_path) != er.uid) {
+						WARN_PRINT(vformat("'%s': In external resource #%d, invalid UID: '%s' - using text path instead: '%s'.", res_path, external_resources.size(), ResourceUID::get_singleton()->id_to_text(er.uid), er.path));
+					}
+#else
+					WARN_PRINT(vformat("'%s': In external resource #%d, invalid UID: '%s' - using text path instead: '%s'.", res_path, external_resources.size(), ResourceUID::get_singleton()->id_to_text(er.uid), er.path));
+#endif
+				}
+			}
+		}
+
+		external_resources.push_back(er);
+	}
+}
+
+void ResourceLoaderBinary::_read_deltas(bool p_keep_uuid_paths) {
+	// Each delta record points to the one before it, walk back to the first one and replay them in order.
+	LocalVector<uint64_t> records;
+	uint64_t record = last_delta_offset;
+	while (record != 0) {
+		if (record >= f->get_length() || (!records.is_empty() && record >= records[records.size() - 1])) {
+			error = ERR_FILE_CORRUPT;
+			ERR_FAIL_MSG(vformat("'%s': Invalid incremental save record.", local_path));
+		}
+		f->seek(record);
+		uint8_t magic[4];
+		f->get_buffer(magic, 4);
+		if (magic[0] != 'R' || magic[1] != 'S' || magic[2] != 'D' || magic[3] != 'L') {
+			error = ERR_FILE_CORRUPT;
+			ERR_FAIL_MSG(vformat("'%s': Invalid incremental save record.", local_path));
+		}
+		records.push_back(record);
+		record = f->get_64();
+	}
+
+	for (int64_t i = int64_t(records.size()) - 1; i >= 0; i--) {
+		f->seek(records[i] + 12);
+
+		uint32_t string_count = f->get_32();
+		for (uint32_t j = 0; j < string_count; j++) {
+			string_map.push_back(get_unicode_string());
+		}
+
+		_read_external_resources(f->get_32(), p_keep_uuid_paths);
+
+		uint32_t new_internal_count = f->get_32();
+		for (uint32_t j = 0; j < new_internal_count; j++) {
+			IntResource ir;
+			ir.path = get_unicode_string();
+			ir.offset = 0;
+			internal_resources.push_back(ir);
+		}
+
+		uint32_t offset_count = f->get_32();
+		if (offset_count != uint32_t(internal_resources.size())) {
+			error = ERR_FILE_CORRUPT;
+			ERR_FAIL_MSG(vformat("'%s': Invalid incremental save record.", local_path));
+		}
+		for (uint32_t j = 0; j < offset_count; j++) {
+			internal_resources.write[j].offset = f->get_64();
+		}
+
+		uint32_t load_count = f->get_32();
+		internal_load_order.resize(load_count);
+		for (uint32_t j = 0; j < load_count; j++) {
+			uint32_t index = f->get_32();
+			if (index >= offset_count) {
+				error = ERR_FILE_CORRUPT;
+				ERR_FAIL_MSG(vformat("'%s': Invalid incremental save record.", local_path));
+			}
+			internal_load_order.write[j] = index;
+		}
+	}
+
+	print_bl("delta records: " + itos(records.size()));
+}
+
 void ResourceLoaderBinary::open(Ref<FileAccess> p_f, bool p_no_resources, bool p_keep_uuid_paths) {
 	error = OK;
 
@@ -1053,7 +1212,13 @@ void ResourceLoaderBinary::open(Ref<FileAccess> p_f, bool p_no_resources, bool p
 		script_class = get_unicode_string();
 	}
 
-	for (int i = 0; i < ResourceFormatSaverBinaryInstance::RESERVED_FIELDS; i++) {
+	int reserved_fields = ResourceFormatSaverBinaryInstance::RESERVED_FIELDS;
+	if (flags & ResourceFormatSaverBinaryInstance::FORMAT_FLAG_INCREMENTAL) {
+		last_delta_offset = f->get_64();
+		reserved_fields -= 2;
+	}
+
+	for (int i = 0; i < reserved_fields; i++) {
 		f->get_32(); //skip a few reserved fields
 	}
 
@@ -1071,31 +1236,7 @@ void ResourceLoaderBinary::open(Ref<FileAccess> p_f, bool p_no_resources, bool p
 	print_bl("strings: " + itos(string_table_size));
 
 	uint32_t ext_resources_size = f->get_32();
-	for (uint32_t i = 0; i < ext_resources_size; i++) {
-		ExtResource er;
-		er.type = get_unicode_string();
-		er.path = get_unicode_string();
-		if (using_uids) {
-			er.uid = ResourceUID::ID(f->get_64());
-			if (!p_keep_uuid_paths && er.uid != ResourceUID::INVALID_ID) {
-				if (ResourceUID::get_singleton()->has_id(er.uid)) {
-					// If a UID is found and the path is valid, it will be used, otherwise, it falls back to the path.
-					er.path = ResourceUID::get_singleton()->get_id_path(er.uid);
-				} else {
-#ifdef TOOLS_ENABLED
-					// Silence a warning that can happen during the initial filesystem scan due to cache being regenerated.
-					if (ResourceLoader::get_resource_uid(res_path) != er.uid) {
-						WARN_PRINT(vformat("'%s': In external resource #%d, invalid UID: '%s' - using text path instead: '%s'.", res_path, i, ResourceUID::get_singleton()->id_to_text(er.uid), er.path));
-					}
-#else
-					WARN_PRINT(vformat("'%s': In external resource #%d, invalid UID: '%s' - using text path instead: '%s'.", res_path, i, ResourceUID::get_singleton()->id_to_text(er.uid), er.path));
-#endif
-				}
-			}
-		}
-
-		external_resources.push_back(er);
-	}
+	_read_external_resources(ext_resources_size, p_keep_uuid_paths);
 
 	print_bl("ext resources: " + itos(ext_resources_size));
 	uint32_t int_resources_size = f->get_32();
@@ -1109,6 +1250,14 @@ void ResourceLoaderBinary::open(Ref<FileAccess> p_f, bool p_no_resources, bool p
 
 	print_bl("int resources: " + itos(int_resources_size));
 
+	if (last_delta_offset != 0 && !f->eof_reached()) {
+		_read_deltas(p_keep_uuid_paths);
+		if (error != OK) {
+			f.unref();
+			return;
+		}
+	}
+
 	if (f->eof_reached()) {
 		error = ERR_FILE_CORRUPT;
 		f.unref();
@@ -1301,6 +1450,27 @@ void ResourceFormatLoaderBinary::get_dependencies(const String &p_path, List<Str
 	loader.get_dependencies(f, p_dependencies, p_add_types);
 }
 
+Error ResourceFormatLoaderBinary::_rename_dependencies_by_resaving(const String &p_path, const HashMap<String, String> &p_map) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+
+	ERR_FAIL_COND_V_MSG(err != OK, ERR_FILE_CANT_OPEN, vformat("Cannot open file '%s'.", p_path));
+
+	ResourceLoaderBinary loader;
+	loader.local_path = ProjectSettings::get_singleton()->localize_path(p_path);
+	loader.res_path = loader.local_path;
+	loader.remaps = p_map;
+	loader.open(f);
+
+	err = loader.load();
+
+	ERR_FAIL_COND_V(err != ERR_FILE_EOF, ERR_FILE_CORRUPT);
+	Ref<Resource> res = loader.get_resource();
+	ERR_FAIL_COND_V(res.is_null(), ERR_FILE_CORRUPT);
+
+	return ResourceFormatSaverBinary::singleton->save(res, p_path);
+}
+
 Error ResourceFormatLoaderBinary::rename_dependencies(const String &p_path, const HashMap<String, String> &p_map) {
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
 	ERR_FAIL_COND_V_MSG(f.is_null(), ERR_CANT_OPEN, vformat("Cannot open file '%s'.", p_path));
@@ -1363,24 +1533,7 @@ Error ResourceFormatLoaderBinary::rename_dependencies(const String &p_path, cons
 
 		WARN_PRINT(vformat("This file is old, so it can't refactor dependencies, opening and resaving '%s'.", p_path));
 
-		Error err;
-		f = FileAccess::open(p_path, FileAccess::READ, &err);
-
-		ERR_FAIL_COND_V_MSG(err != OK, ERR_FILE_CANT_OPEN, vformat("Cannot open file '%s'.", p_path));
-
-		ResourceLoaderBinary loader;
-		loader.local_path = ProjectSettings::get_singleton()->localize_path(p_path);
-		loader.res_path = loader.local_path;
-		loader.remaps = p_map;
-		loader.open(f);
-
-		err = loader.load();
-
-		ERR_FAIL_COND_V(err != ERR_FILE_EOF, ERR_FILE_CORRUPT);
-		Ref<Resource> res = loader.get_resource();
-		ERR_FAIL_COND_V(res.is_null(), ERR_FILE_CORRUPT);
-
-		return ResourceFormatSaverBinary::singleton->save(res, p_path);
+		return _rename_dependencies_by_resaving(p_path, p_map);
 	}
 
 	if (ver_format > FORMAT_VERSION || ver_major > GODOT_VERSION_MAJOR) {
@@ -1411,7 +1564,25 @@ Error ResourceFormatLoaderBinary::rename_dependencies(const String &p_path, cons
 		save_ustring(fw, get_ustring(f));
 	}
 
-	for (int i = 0; i < ResourceFormatSaverBinaryInstance::RESERVED_FIELDS; i++) {
+	int reserved_fields = ResourceFormatSaverBinaryInstance::RESERVED_FIELDS;
+	if (flags & ResourceFormatSaverBinaryInstance::FORMAT_FLAG_INCREMENTAL) {
+		if (f->get_64() != 0) {
+			// Delta records store absolute offsets, which would need fixing up. Resaving compacts them instead.
+			f.unref();
+			fw.unref();
+
+			{
+				Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+				da->remove(p_path + ".depren");
+			}
+
+			return _rename_dependencies_by_resaving(p_path, p_map);
+		}
+		fw->store_64(0);
+		reserved_fields -= 2;
+	}
+
+	for (int i = 0; i < reserved_fields; i++) {
 		fw->store_32(0); // reserved
 		f->get_32();
 	}
@@ -2125,7 +2296,121 @@ static String _resource_get_class(Ref<Resource> p_resource) {
 	}
 }
 
-Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags) {
+void ResourceFormatSaverBinaryInstance::_get_resource_data(const Ref<Resource> &p_resource, ResourceData &r_data) {
+	Dictionary missing_resource_properties = p_resource->get_meta(META_MISSING_RESOURCES, Dictionary());
+
+	r_data.type = _resource_get_class(p_resource);
+
+	List<PropertyInfo> property_list;
+	p_resource->get_property_list(&property_list);
+
+	for (const PropertyInfo &F : property_list) {
+		if (skip_editor && F.name.begins_with("__editor")) {
+			continue;
+		}
+		if (F.name == META_PROPERTY_MISSING_RESOURCES) {
+			continue;
+		}
+
+		if ((F.usage & PROPERTY_USAGE_STORAGE) || missing_resource_properties.has(F.name)) {
+			Property p;
+			p.name_idx = get_string_index(F.name);
+
+			if (F.usage & PROPERTY_USAGE_RESOURCE_NOT_PERSISTENT) {
+				NonPersistentKey npk;
+				npk.base = p_resource;
+				npk.property = F.name;
+				if (non_persistent_map.has(npk)) {
+					p.value = non_persistent_map[npk];
+				}
+			} else {
+				p.value = p_resource->get(F.name);
+			}
+
+			if (F.type == Variant::OBJECT && missing_resource_properties.has(F.name)) {
+				// Was this missing resource overridden? If so do not save the old value.
+				Ref<Resource> res = p.value;
+				if (res.is_null()) {
+					p.value = missing_resource_properties[F.name];
+				}
+			}
+
+			Variant default_value = ClassDB::class_get_default_property_value(p_resource->get_class(), F.name);
+
+			if (default_value.get_type() != Variant::NIL && bool(Variant::evaluate(Variant::OP_EQUAL, p.value, default_value))) {
+				continue;
+			}
+
+			p.pi = F;
+
+			r_data.properties.push_back(p);
+		}
+	}
+}
+
+void ResourceFormatSaverBinaryInstance::_assign_scene_unique_ids() {
+	HashSet<String> used_unique_ids;
+
+	for (Ref<Resource> &r : saved_resources) {
+		if (r->is_built_in()) {
+			if (!r->get_scene_unique_id().is_empty()) {
+				if (used_unique_ids.has(r->get_scene_unique_id())) {
+					r->set_scene_unique_id("");
+				} else {
+					used_unique_ids.insert(r->get_scene_unique_id());
+				}
+			}
+		}
+	}
+
+	for (Ref<Resource> &r : saved_resources) {
+		if (r->is_built_in() && r->get_scene_unique_id().is_empty()) {
+			String new_id;
+
+			while (true) {
+				new_id = _resource_get_class(r) + "_" + Resource::generate_scene_unique_id();
+				if (!used_unique_ids.has(new_id)) {
+					break;
+				}
+			}
+
+			r->set_scene_unique_id(new_id);
+			used_unique_ids.insert(new_id);
+		}
+	}
+}
+
+static Variant _incremental_snapshot_value(const Variant &p_value) {
+	// Containers, packed arrays included, are shared by reference between Variant copies and could be
+	// edited in place after saving, so keep a copy.
+	if (p_value.is_array() || p_value.get_type() == Variant::DICTIONARY) {
+		return p_value.duplicate(true);
+	}
+	return p_value;
+}
+
+static bool _incremental_value_changed(const Variant &p_old, const Variant &p_new) {
+	if (p_old.get_type() != p_new.get_type()) {
+		return true;
+	}
+	if (p_old.identity_compare(p_new)) {
+		return false;
+	}
+	if (p_old.get_type() == Variant::OBJECT) {
+		return true;
+	}
+	return !bool(Variant::evaluate(Variant::OP_EQUAL, p_old, p_new));
+}
+
+void ResourceFormatSaverBinaryInstance::_snapshot_resource_data(const ResourceData &p_data, IncrementalState::Snapshot &r_snapshot) const {
+	r_snapshot.type = p_data.type;
+	r_snapshot.properties.clear();
+	for (const Property &p : p_data.properties) {
+		r_snapshot.properties[strings[p.name_idx]] = _incremental_snapshot_value(p.value);
+	}
+}
+
+Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags, IncrementalState *r_state) {
 	Resource::seed_scene_unique_id(p_path.hash());
 
 	Error err;
@@ -2188,6 +2473,9 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 #ifdef REAL_T_IS_DOUBLE
 		format_flags |= FORMAT_FLAG_REAL_T_IS_DOUBLE;
 #endif
+		if (r_state) {
+			format_flags |= FORMAT_FLAG_INCREMENTAL;
+		}
 		if (!p_resource->is_class("PackedScene")) {
 			Ref<Script> s = p_resource->get_script();
 			if (s.is_valid()) {
@@ -2206,65 +2494,21 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 		save_unicode_string(f, script_class);
 	}
 
-	for (int i = 0; i < ResourceFormatSaverBinaryInstance::RESERVED_FIELDS; i++) {
+	int reserved_fields = ResourceFormatSaverBinaryInstance::RESERVED_FIELDS;
+	if (r_state) {
+		r_state->delta_offset_pos = f->get_position();
+		f->store_64(0); // Offset of the latest delta record.
+		reserved_fields -= 2;
+	}
+
+	for (int i = 0; i < reserved_fields; i++) {
 		f->store_32(0); // reserved
 	}
 
 	List<ResourceData> resources;
 
-	{
-		for (const Ref<Resource> &E : saved_resources) {
-			Dictionary missing_resource_properties = E->get_meta(META_MISSING_RESOURCES, Dictionary());
-
-			ResourceData &rd = resources.push_back(ResourceData())->get();
-			rd.type = _resource_get_class(E);
-
-			List<PropertyInfo> property_list;
-			E->get_property_list(&property_list);
-
-			for (const PropertyInfo &F : property_list) {
-				if (skip_editor && F.name.begins_with("__editor")) {
-					continue;
-				}
-				if (F.name == META_PROPERTY_MISSING_RESOURCES) {
-					continue;
-				}
-
-				if ((F.usage & PROPERTY_USAGE_STORAGE) || missing_resource_properties.has(F.name)) {
-					Property p;
-					p.name_idx = get_string_index(F.name);
-
-					if (F.usage & PROPERTY_USAGE_RESOURCE_NOT_PERSISTENT) {
-						NonPersistentKey npk;
-						npk.base = E;
-						npk.property = F.name;
-						if (non_persistent_map.has(npk)) {
-							p.value = non_persistent_map[npk];
-						}
-					} else {
-						p.value = E->get(F.name);
-					}
-
-					if (F.type == Variant::OBJECT && missing_resource_properties.has(F.name)) {
-						// Was this missing resource overridden? If so do not save the old value.
-						Ref<Resource> res = p.value;
-						if (res.is_null()) {
-							p.value = missing_resource_properties[F.name];
-						}
-					}
-
-					Variant default_value = ClassDB::class_get_default_property_value(E->get_class(), F.name);
-
-					if (default_value.get_type() != Variant::NIL && bool(Variant::evaluate(Variant::OP_EQUAL, p.value, default_value))) {
-						continue;
-					}
-
-					p.pi = F;
-
-					rd.properties.push_back(p);
-				}
-			}
-		}
+	for (const Ref<Resource> &E : saved_resources) {
+		_get_resource_data(E, resources.push_back(ResourceData())->get());
 	}
 
 	f->store_32(uint32_t(strings.size())); //string table size
@@ -2288,42 +2532,20 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 		save_unicode_string(f, res_path);
 		ResourceUID::ID ruid = ResourceSaver::get_resource_id_for_path(save_order[i]->get_path(), false);
 		f->store_64(uint64_t(ruid));
+		if (r_state) {
+			r_state->external_paths.push_back(res_path);
+		}
 	}
 	// save internal resource table
 	f->store_32(uint32_t(saved_resources.size())); //amount of internal resources
 	Vector<uint64_t> ofs_pos;
-	HashSet<String> used_unique_ids;
 
-	for (Ref<Resource> &r : saved_resources) {
-		if (r->is_built_in()) {
-			if (!r->get_scene_unique_id().is_empty()) {
-				if (used_unique_ids.has(r->get_scene_unique_id())) {
-					r->set_scene_unique_id("");
-				} else {
-					used_unique_ids.insert(r->get_scene_unique_id());
-				}
-			}
-		}
-	}
+	_assign_scene_unique_ids();
 
 	HashMap<Ref<Resource>, int> resource_map;
 	int res_index = 0;
 	for (Ref<Resource> &r : saved_resources) {
 		if (r->is_built_in()) {
-			if (r->get_scene_unique_id().is_empty()) {
-				String new_id;
-
-				while (true) {
-					new_id = _resource_get_class(r) + "_" + Resource::generate_scene_unique_id();
-					if (!used_unique_ids.has(new_id)) {
-						break;
-					}
-				}
-
-				r->set_scene_unique_id(new_id);
-				used_unique_ids.insert(new_id);
-			}
-
 			save_unicode_string(f, "local://" + r->get_scene_unique_id());
 			if (takeover_paths) {
 				r->set_path(p_path + "::" + r->get_scene_unique_id(), true);
@@ -2366,6 +2588,260 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 		return ERR_CANT_CREATE;
 	}
 
+	if (r_state) {
+		r_state->file_length = f->get_length();
+		r_state->base_length = r_state->file_length;
+		r_state->last_delta = 0;
+		r_state->big_endian = big_endian;
+		r_state->strings = strings;
+		r_state->internal_offsets = ofs_table;
+
+		const List<Ref<Resource>>::Element *R = saved_resources.front();
+		for (const ResourceData &rd : resources) {
+			const Ref<Resource> &r = R->get();
+			String table_path = r->is_built_in() ? "local://" + r->get_scene_unique_id() : r->get_path();
+			r_state->internal_paths.push_back(table_path);
+			_snapshot_resource_data(rd, r_state->resources[table_path]);
+			R = R->next();
+		}
+	}
+
+	return OK;
+}
+
+Error ResourceFormatSaverBinaryInstance::save_incremental(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags, IncrementalState &r_state) {
+	// Appends the properties that changed since the last save of this file, followed by a
+	// delta record with the updated tables. Returns ERR_UNAVAILABLE when a full save is needed.
+	if ((p_flags & ResourceSaver::FLAG_COMPRESS) || bool(p_flags & ResourceSaver::FLAG_SAVE_BIG_ENDIAN) != r_state.big_endian) {
+		return ERR_UNAVAILABLE;
+	}
+	if (r_state.file_length - r_state.base_length > r_state.base_length) {
+		return ERR_UNAVAILABLE; // More patches than data, compact.
+	}
+	if (FileAccess::get_modified_time(p_path) != r_state.modified_time) {
+		return ERR_UNAVAILABLE; // Written by someone else since.
+	}
+
+	Resource::seed_scene_unique_id(p_path.hash());
+
+	relative_paths = p_flags & ResourceSaver::FLAG_RELATIVE_PATHS;
+	skip_editor = p_flags & ResourceSaver::FLAG_OMIT_EDITOR_PROPERTIES;
+	bundle_resources = p_flags & ResourceSaver::FLAG_BUNDLE_RESOURCES;
+	big_endian = r_state.big_endian;
+	takeover_paths = p_flags & ResourceSaver::FLAG_REPLACE_SUBRESOURCE_PATHS;
+
+	if (!p_path.begins_with("res://")) {
+		takeover_paths = false;
+	}
+
+	local_path = p_path.get_base_dir();
+	path = ProjectSettings::get_singleton()->localize_path(p_path);
+
+	// Indices already stored in the file must stay valid, so start from its string table.
+	strings = r_state.strings;
+	for (int i = 0; i < strings.size(); i++) {
+		string_map[strings[i]] = i;
+	}
+
+	_find_resources(p_resource, true);
+
+	// Same for external resources. One that is no longer used would still be loaded as a
+	// dependency, so drop it by compacting instead.
+	HashMap<String, int> old_external_indices;
+	for (int i = 0; i < r_state.external_paths.size(); i++) {
+		old_external_indices[r_state.external_paths[i]] = i;
+	}
+
+	HashMap<Ref<Resource>, int> remapped_external_resources;
+	Vector<Ref<Resource>> new_external_resources;
+	Vector<String> new_external_paths;
+	int reused_external_resources = 0;
+	for (const KeyValue<Ref<Resource>, int> &E : external_resources) {
+		String res_path = E.key->get_path();
+		res_path = relative_paths ? local_path.path_to_file(res_path) : res_path;
+		HashMap<String, int>::ConstIterator F = old_external_indices.find(res_path);
+		if (F) {
+			remapped_external_resources[E.key] = F->value;
+			reused_external_resources++;
+		} else {
+			remapped_external_resources[E.key] = r_state.external_paths.size() + new_external_resources.size();
+			new_external_resources.push_back(E.key);
+			new_external_paths.push_back(res_path);
+		}
+	}
+
+	if (reused_external_resources != r_state.external_paths.size()) {
+		return ERR_UNAVAILABLE;
+	}
+	external_resources = remapped_external_resources;
+
+	_assign_scene_unique_ids();
+
+	HashMap<String, int> old_internal_indices;
+	for (int i = 0; i < r_state.internal_paths.size(); i++) {
+		old_internal_indices[r_state.internal_paths[i]] = i;
+	}
+
+	HashMap<Ref<Resource>, int> resource_map;
+	Vector<String> internal_paths = r_state.internal_paths;
+	Vector<uint32_t> load_order;
+	for (Ref<Resource> &r : saved_resources) {
+		String table_path = r->is_built_in() ? "local://" + r->get_scene_unique_id() : r->get_path();
+		HashMap<String, int>::ConstIterator E = old_internal_indices.find(table_path);
+		int index;
+		if (E) {
+			index = E->value;
+		} else {
+			index = internal_paths.size();
+			internal_paths.push_back(table_path);
+		}
+		resource_map[r] = index;
+		load_order.push_back(index);
+	}
+
+	List<ResourceData> resources;
+	for (const Ref<Resource> &E : saved_resources) {
+		_get_resource_data(E, resources.push_back(ResourceData())->get());
+	}
+
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ_WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, vformat("Cannot open file '%s'.", p_path));
+
+	if (f->get_length() != r_state.file_length) {
+		return ERR_UNAVAILABLE;
+	}
+
+	f->set_big_endian(big_endian);
+	f->seek_end();
+
+	// Only snapshots of resources still in the file are kept.
+	HashMap<String, IncrementalState::Snapshot> snapshots;
+	Vector<uint64_t> internal_offsets;
+	internal_offsets.resize_zeroed(internal_paths.size());
+
+	const List<Ref<Resource>>::Element *R = saved_resources.front();
+	for (const ResourceData &rd : resources) {
+		Ref<Resource> r = R->get();
+		int index = resource_map[r];
+		const String &table_path = internal_paths[index];
+		R = R->next();
+
+		if (r->is_built_in()) {
+			if (takeover_paths) {
+				r->set_path(p_path + "::" + r->get_scene_unique_id(), true);
+			}
+#ifdef TOOLS_ENABLED
+			r->set_edited(false);
+#endif
+		}
+
+		IncrementalState::Snapshot *old_snapshot = r_state.resources.getptr(table_path);
+		uint64_t old_offset = index < r_state.internal_offsets.size() ? r_state.internal_offsets[index] : 0;
+
+		LocalVector<const Property *> changed;
+		bool patch = old_snapshot && old_offset != 0 && old_snapshot->type == rd.type && old_snapshot->patch_depth < RESOURCE_PATCH_MAX_DEPTH;
+		if (patch) {
+			uint32_t kept = 0;
+			for (const Property &p : rd.properties) {
+				const Variant *old_value = old_snapshot->properties.getptr(strings[p.name_idx]);
+				if (old_value) {
+					kept++;
+				}
+				if (!old_value || _incremental_value_changed(*old_value, p.value)) {
+					changed.push_back(&p);
+				}
+			}
+			// A property that went back to its default can't be expressed as a patch.
+			patch = kept == old_snapshot->properties.size();
+		}
+
+		IncrementalState::Snapshot &snapshot = snapshots[table_path];
+
+		if (patch && changed.is_empty()) {
+			internal_offsets.write[index] = old_offset;
+			snapshot = std::move(*old_snapshot);
+			continue;
+		}
+
+		internal_offsets.write[index] = f->get_position();
+		save_unicode_string(f, rd.type);
+
+		if (patch) {
+			f->store_32(uint32_t(changed.size()) | RESOURCE_PATCH_BIT);
+			f->store_64(old_offset);
+			for (const Property *p : changed) {
+				f->store_32(uint32_t(p->name_idx));
+				write_variant(f, p->value, resource_map, external_resources, string_map, p->pi);
+			}
+			snapshot.patch_depth = old_snapshot->patch_depth + 1;
+		} else {
+			f->store_32(uint32_t(rd.properties.size()));
+			for (const Property &p : rd.properties) {
+				f->store_32(uint32_t(p.name_idx));
+				write_variant(f, p.value, resource_map, external_resources, string_map, p.pi);
+			}
+			snapshot.patch_depth = 0;
+		}
+
+		_snapshot_resource_data(rd, snapshot);
+	}
+
+	// Delta record: new strings, external and internal resources, then the full offset table and load order.
+	uint64_t record_offset = f->get_position();
+	f->store_buffer((const uint8_t *)"RSDL", 4);
+	f->store_64(r_state.last_delta);
+
+	f->store_32(uint32_t(strings.size() - r_state.strings.size()));
+	for (int j = r_state.strings.size(); j < strings.size(); j++) {
+		save_unicode_string(f, strings[j]);
+	}
+
+	f->store_32(uint32_t(new_external_resources.size()));
+	for (int j = 0; j < new_external_resources.size(); j++) {
+		save_unicode_string(f, new_external_resources[j]->get_save_class());
+		save_unicode_string(f, new_external_paths[j]);
+		ResourceUID::ID ruid = ResourceSaver::get_resource_id_for_path(new_external_resources[j]->get_path(), false);
+		f->store_64(uint64_t(ruid));
+	}
+
+	f->store_32(uint32_t(internal_paths.size() - r_state.internal_paths.size()));
+	for (int j = r_state.internal_paths.size(); j < internal_paths.size(); j++) {
+		save_unicode_string(f, internal_paths[j]);
+	}
+
+	f->store_32(uint32_t(internal_offsets.size()));
+	for (int j = 0; j < internal_offsets.size(); j++) {
+		f->store_64(internal_offsets[j]);
+	}
+
+	f->store_32(uint32_t(load_order.size()));
+	for (int j = 0; j < load_order.size(); j++) {
+		f->store_32(load_order[j]);
+	}
+
+	if (f->get_error() != OK && f->get_error() != ERR_FILE_EOF) {
+		return ERR_CANT_CREATE;
+	}
+
+	// Only point the header to the new record once everything it references is written,
+	// so an interrupted save leaves the previous state loadable.
+	f->flush();
+	f->seek(r_state.delta_offset_pos);
+	f->store_64(record_offset);
+
+	if (f->get_error() != OK && f->get_error() != ERR_FILE_EOF) {
+		return ERR_CANT_CREATE;
+	}
+
+	r_state.file_length = f->get_length();
+	r_state.last_delta = record_offset;
+	r_state.strings = strings;
+	r_state.external_paths.append_array(new_external_paths);
+	r_state.internal_paths = internal_paths;
+	r_state.internal_offsets = internal_offsets;
+	r_state.resources = std::move(snapshots);
+
 	return OK;
 }
 
@@ -2484,8 +2960,44 @@ Error ResourceFormatSaverBinaryInstance::set_uid(const String &p_path, ResourceU
 
 Error ResourceFormatSaverBinary::save(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags) {
 	String local_path = ProjectSettings::get_singleton()->localize_path(p_path);
-	ResourceFormatSaverBinaryInstance saver;
-	return saver.save(local_path, p_resource, p_flags);
+
+	ResourceFormatSaverBinaryInstance::IncrementalState state;
+	bool has_state = false;
+	{
+		MutexLock lock(incremental_mutex);
+		HashMap<String, ResourceFormatSaverBinaryInstance::IncrementalState>::Iterator E = incremental_states.find(local_path);
+		if (E) {
+			state = std::move(E->value);
+			has_state = true;
+			incremental_states.remove(E);
+		}
+	}
+
+	if (!(p_flags & ResourceSaver::FLAG_INCREMENTAL) || (p_flags & ResourceSaver::FLAG_COMPRESS)) {
+		ResourceFormatSaverBinaryInstance saver;
+		return saver.save(local_path, p_resource, p_flags);
+	}
+
+	Error err = ERR_UNAVAILABLE;
+	if (has_state) {
+		ResourceFormatSaverBinaryInstance saver;
+		err = saver.save_incremental(local_path, p_resource, p_flags, state);
+	}
+
+	if (err == ERR_UNAVAILABLE) {
+		// First save of this file in this session, or it needs compacting.
+		state = ResourceFormatSaverBinaryInstance::IncrementalState();
+		ResourceFormatSaverBinaryInstance saver;
+		err = saver.save(local_path, p_resource, p_flags, &state);
+	}
+
+	if (err == OK) {
+		state.modified_time = FileAccess::get_modified_time(local_path);
+		MutexLock lock(incremental_mutex);
+		incremental_states[local_path] = std::move(state);
+	}
+
+	return err;
 }
 
 Error ResourceFormatSaverBinary::set_uid(const String &p_path, ResourceUID::ID p_uid) {
@@ -33,6 +33,9 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/pair.h"
 
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
@@ -75,10 +78,14 @@ class ResourceLoaderBinary {
 	};
 
 	Vector<IntResource> internal_resources;
+	Vector<uint32_t> internal_load_order; // Only set by incremental saves, table order otherwise.
+	uint64_t last_delta_offset = 0;
 	HashMap<String, Ref<Resource>> internal_index_cache;
 
 	String get_unicode_string();
 	void _advance_padding(uint32_t p_len);
+	void _read_external_resources(uint32_t p_count, bool p_keep_uuid_paths);
+	void _read_deltas(bool p_keep_uuid_paths);
 
 	HashMap<String, String> remaps;
 	Error error = OK;
@@ -89,6 +96,7 @@ class ResourceLoaderBinary {
 	friend class ResourceFormatLoaderBinary;
 
 	Error parse_variant(Variant &r_v);
+	Error _parse_resource_properties(LocalVector<Pair<StringName, Variant>> &r_properties, uint32_t p_depth = 0);
 
 	HashMap<String, Ref<Resource>> dependency_cache;
 
@@ -108,6 +116,8 @@ public:
 };
 
 class ResourceFormatLoaderBinary : public ResourceFormatLoader {
+	static Error _rename_dependencies_by_resaving(const String &p_path, const HashMap<String, String> &p_map);
+
 public:
 	virtual Ref<Resource> load(const String &p_path, const String &p_original_path = "", Error *r_error = nullptr, bool p_use_sub_threads = false, float *r_progress = nullptr, CacheMode p_cache_mode = CACHE_MODE_REUSE) override;
 	virtual void get_recognized_extensions_for_type(const String &p_type, List<String> *p_extensions) const override;
@@ -160,6 +170,8 @@ class ResourceFormatSaverBinaryInstance {
 
 	static void _pad_buffer(Ref<FileAccess> f, int p_bytes);
 	void _find_resources(const Variant &p_variant, bool p_main = false);
+	void _get_resource_data(const Ref<Resource> &p_resource, ResourceData &r_data);
+	void _assign_scene_unique_ids();
 	static void save_unicode_string(Ref<FileAccess> f, const String &p_string, bool p_bit_on_len = false);
 	int get_string_index(const String &p_string);
 
@@ -169,16 +181,49 @@ public:
 		FORMAT_FLAG_UIDS = 2,
 		FORMAT_FLAG_REAL_T_IS_DOUBLE = 4,
 		FORMAT_FLAG_HAS_SCRIPT_CLASS = 8,
+		FORMAT_FLAG_INCREMENTAL = 16,
 
 		// Amount of reserved 32-bit fields in resource header
 		RESERVED_FIELDS = 11
 	};
-	Error save(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags = 0);
+
+	// What an incremental save needs to remember about the file it last wrote,
+	// so the next save can append only the properties that changed.
+	struct IncrementalState {
+		struct Snapshot {
+			String type;
+			HashMap<StringName, Variant> properties;
+			uint32_t patch_depth = 0;
+		};
+
+		uint64_t modified_time = 0;
+		uint64_t file_length = 0;
+		uint64_t base_length = 0;
+		uint64_t delta_offset_pos = 0;
+		uint64_t last_delta = 0;
+		bool big_endian = false;
+
+		Vector<StringName> strings;
+		Vector<String> external_paths;
+		Vector<String> internal_paths;
+		Vector<uint64_t> internal_offsets;
+		HashMap<String, Snapshot> resources;
+	};
+
+private:
+	void _snapshot_resource_data(const ResourceData &p_data, IncrementalState::Snapshot &r_snapshot) const;
+
+public:
+	Error save(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags = 0, IncrementalState *r_state = nullptr);
+	Error save_incremental(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags, IncrementalState &r_state);
 	Error set_uid(const String &p_path, ResourceUID::ID p_uid);
 	static void write_variant(Ref<FileAccess> f, const Variant &p_property, HashMap<Ref<Resource>, int> &resource_map, HashMap<Ref<Resource>, int> &external_resources, HashMap<StringName, int> &string_map, const PropertyInfo &p_hint = PropertyInfo());
 };
 
 class ResourceFormatSaverBinary : public ResourceFormatSaver {
+	Mutex incremental_mutex;
+	HashMap<String, ResourceFormatSaverBinaryInstance::IncrementalState> incremental_states;
+
 public:
 	static inline ResourceFormatSaverBinary *singleton = nullptr;
 	virtual Error save(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags = 0) override;
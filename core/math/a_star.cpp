@@ -51,6 +51,7 @@ void AStar3D::add_point(int64_t p_id, const Vector3 &p_pos, real_t p_weight_scal
 
 	Point *found_pt;
 	bool p_exists = points.lookup(p_id, found_pt);
+	ERR_FAIL_COND_MSG(frozen && !p_exists, vformat("Can't add point with id: %d while the graph is frozen. Call unfreeze() first.", p_id));
 
 	if (!p_exists) {
 		Point *pt = memnew(Point);
@@ -65,6 +66,12 @@ void AStar3D::add_point(int64_t p_id, const Vector3 &p_pos, real_t p_weight_scal
 	} else {
 		found_pt->pos = p_pos;
 		found_pt->weight_scale = p_weight_scale;
+
+		if (frozen) {
+			uint32_t index = frozen_graph.point_indices[p_id];
+			frozen_graph.point_positions[index] = p_pos;
+			frozen_graph.point_weight_scales[index] = p_weight_scale;
+		}
 	}
 }
 
@@ -82,6 +89,10 @@ void AStar3D::set_point_position(int64_t p_id, const Vector3 &p_pos) {
 	ERR_FAIL_COND_MSG(!p_exists, vformat("Can't set point's position. Point with id: %d doesn't exist.", p_id));
 
 	p->pos = p_pos;
+
+	if (frozen) {
+		frozen_graph.point_positions[frozen_graph.point_indices[p_id]] = p_pos;
+	}
 }
 
 real_t AStar3D::get_point_weight_scale(int64_t p_id) const {
@@ -99,12 +110,17 @@ void AStar3D::set_point_weight_scale(int64_t p_id, real_t p_weight_scale) {
 	ERR_FAIL_COND_MSG(p_weight_scale < 0.0, vformat("Can't set point's weight scale less than 0.0: %f.", p_weight_scale));
 
 	p->weight_scale = p_weight_scale;
+
+	if (frozen) {
+		frozen_graph.point_weight_scales[frozen_graph.point_indices[p_id]] = p_weight_scale;
+	}
 }
 
 void AStar3D::remove_point(int64_t p_id) {
 	Point *p = nullptr;
 	bool p_exists = points.lookup(p_id, p);
 	ERR_FAIL_COND_MSG(!p_exists, vformat("Can't remove point. Point with id: %d doesn't exist.", p_id));
+	ERR_FAIL_COND_MSG(frozen, vformat("Can't remove point with id: %d while the graph is frozen. Call unfreeze() first.", p_id));
 
 	for (OAHashMap<int64_t, Point *>::Iterator it = p->neighbors.iter(); it.valid; it = p->neighbors.next_iter(it)) {
 		Segment s(p_id, (*it.key));
@@ -129,6 +145,7 @@ void AStar3D::remove_point(int64_t p_id) {
 
 void AStar3D::connect_points(int64_t p_id, int64_t p_with_id, bool bidirectional) {
 	ERR_FAIL_COND_MSG(p_id == p_with_id, vformat("Can't connect point with id: %d to itself.", p_id));
+	ERR_FAIL_COND_MSG(frozen, "Can't connect points while the graph is frozen. Call unfreeze() first.");
 
 	Point *a = nullptr;
 	bool from_exists = points.lookup(p_id, a);
@@ -166,6 +183,8 @@ void AStar3D::connect_points(int64_t p_id, int64_t p_with_id, bool bidirectional
 }
 
 void AStar3D::disconnect_points(int64_t p_id, int64_t p_with_id, bool bidirectional) {
+	ERR_FAIL_COND_MSG(frozen, "Can't disconnect points while the graph is frozen. Call unfreeze() first.");
+
 	Point *a = nullptr;
 	bool a_exists = points.lookup(p_id, a);
 	ERR_FAIL_COND_MSG(!a_exists, vformat("Can't disconnect points. Point with id: %d doesn't exist.", p_id));
@@ -226,6 +245,15 @@ Vector<int64_t> AStar3D::get_point_connections(int64_t p_id) {
 
 	Vector<int64_t> point_list;
 
+	if (frozen) {
+		// The per-point neighbor maps are released while frozen.
+		const uint32_t index = frozen_graph.point_indices[p_id];
+		for (uint32_t i = frozen_graph.neighbor_offsets[index]; i < frozen_graph.neighbor_offsets[index + 1]; i++) {
+			point_list.push_back(frozen_graph.point_ids[frozen_graph.neighbors[i]]);
+		}
+		return point_list;
+	}
+
 	for (OAHashMap<int64_t, Point *>::Iterator it = p->neighbors.iter(); it.valid; it = p->neighbors.next_iter(it)) {
 		point_list.push_back((*it.key));
 	}
@@ -242,6 +270,8 @@ bool AStar3D::are_points_connected(int64_t p_id, int64_t p_with_id, bool bidirec
 }
 
 void AStar3D::clear() {
+	frozen = false; // All points are deleted below, don't rebuild their neighbor maps.
+	unfreeze();
 	last_free_id = 0;
 	for (OAHashMap<int64_t, Point *>::Iterator it = points.iter(); it.valid; it = points.next_iter(it)) {
 		memdelete(*(it.value));
@@ -384,6 +414,332 @@ bool AStar3D::_solve(Point *begin_point, Point *end_point, bool p_allow_partial_
 	return found_route;
 }
 
+uint32_t AStar3D::FrozenSearch::find_node(uint32_t p_point) const {
+	const uint32_t *node = node_indices.getptr(p_point);
+	return node ? *node : UINT32_MAX;
+}
+
+uint32_t AStar3D::FrozenSearch::get_or_add_node(uint32_t p_point) {
+	uint32_t *node = node_indices.getptr(p_point);
+	if (node) {
+		return *node;
+	}
+
+	FrozenSearchNode new_node;
+	new_node.point = p_point;
+	new_node.g_score = Math::INF;
+	nodes.push_back(new_node);
+	node_indices.insert(p_point, nodes.size() - 1);
+	return nodes.size() - 1;
+}
+
+void AStar3D::FrozenSearch::push(uint32_t p_node) {
+	FrozenOpenNode open_node;
+	open_node.node = p_node;
+	open_node.g_score = nodes[p_node].g_score;
+	open_node.f_score = nodes[p_node].f_score;
+	open_list.push_back(open_node);
+	sorter.push_heap(0, open_list.size() - 1, 0, open_node, open_list.ptr());
+}
+
+bool AStar3D::FrozenSearch::clean_top() {
+	// Improved nodes are pushed again instead of being moved inside the heap, so older entries are skipped here.
+	while (!open_list.is_empty()) {
+		const FrozenOpenNode &top = open_list[0];
+		const FrozenSearchNode &node = nodes[top.node];
+		if (!node.closed && top.g_score == node.g_score) {
+			return true;
+		}
+		sorter.pop_heap(0, open_list.size(), open_list.ptr());
+		open_list.remove_at(open_list.size() - 1);
+	}
+	return false;
+}
+
+uint32_t AStar3D::FrozenSearch::pop() {
+	if (!clean_top()) {
+		return UINT32_MAX;
+	}
+	uint32_t node = open_list[0].node;
+	sorter.pop_heap(0, open_list.size(), open_list.ptr());
+	open_list.remove_at(open_list.size() - 1);
+	nodes[node].closed = true;
+	return node;
+}
+
+template <typename T>
+bool AStar3D::_solve_frozen(const FrozenGraph &p_graph, T *p_costs, int64_t p_from_id, int64_t p_to_id, bool p_allow_partial_path, LocalVector<uint32_t> &r_path) {
+	r_path.clear();
+
+	const uint32_t *begin_index = p_graph.point_indices.getptr(p_from_id);
+	const uint32_t *end_index = p_graph.point_indices.getptr(p_to_id);
+	ERR_FAIL_NULL_V(begin_index, false);
+	ERR_FAIL_NULL_V(end_index, false);
+	const uint32_t begin_point = *begin_index;
+	const uint32_t end_point = *end_index;
+
+	if (!p_graph.point_enabled[end_point] && !p_allow_partial_path) {
+		return false;
+	}
+
+	const real_t begin_to_end_estimate = p_costs->_estimate_cost(p_from_id, p_to_id);
+
+	FrozenSearch forward;
+	uint32_t begin_node = forward.get_or_add_node(begin_point);
+	forward.nodes[begin_node].g_score = 0;
+
+	if (p_allow_partial_path) {
+		// Partial paths need the point closest to the end, which only a plain forward search keeps track of.
+		forward.nodes[begin_node].f_score = begin_to_end_estimate;
+		forward.push(begin_node);
+
+		uint32_t closest_node = UINT32_MAX;
+		bool found_route = false;
+
+		while (true) {
+			uint32_t node_index = forward.pop();
+			if (node_index == UINT32_MAX) {
+				break;
+			}
+			const FrozenSearchNode node = forward.nodes[node_index];
+
+			// Find point closer to end_point, or same distance to end_point but closer to begin_point.
+			if (closest_node == UINT32_MAX) {
+				closest_node = node_index;
+			} else {
+				const FrozenSearchNode &closest = forward.nodes[closest_node];
+				const real_t closest_h_score = closest.f_score - closest.g_score;
+				const real_t h_score = node.f_score - node.g_score;
+				if (closest_h_score > h_score || (closest_h_score >= h_score && closest.g_score > node.g_score)) {
+					closest_node = node_index;
+				}
+			}
+
+			if (node.point == end_point) {
+				closest_node = node_index;
+				found_route = true;
+				break;
+			}
+
+			const int64_t point_id = p_graph.point_ids[node.point];
+			for (uint32_t i = p_graph.neighbor_offsets[node.point]; i < p_graph.neighbor_offsets[node.point + 1]; i++) {
+				const uint32_t neighbor = p_graph.neighbors[i];
+				if (!p_graph.point_enabled[neighbor]) {
+					continue;
+				}
+
+				const int64_t neighbor_id = p_graph.point_ids[neighbor];
+				const real_t tentative_g_score = node.g_score + p_costs->_compute_cost(point_id, neighbor_id) * p_graph.point_weight_scales[neighbor];
+
+				uint32_t neighbor_node = forward.get_or_add_node(neighbor);
+				FrozenSearchNode &e = forward.nodes[neighbor_node];
+				if (e.closed || tentative_g_score >= e.g_score) {
+					continue;
+				}
+
+				e.prev_node = node_index;
+				e.g_score = tentative_g_score;
+				e.f_score = tentative_g_score + p_costs->_estimate_cost(neighbor_id, p_to_id);
+				forward.push(neighbor_node);
+			}
+		}
+
+		for (uint32_t node_index = closest_node; node_index != UINT32_MAX; node_index = forward.nodes[node_index].prev_node) {
+			r_path.push_back(forward.nodes[node_index].point);
+		}
+		r_path.reverse();
+		return found_route;
+	}
+
+	// Bidirectional search with average potentials: the forward search is guided by
+	// p(v) = (h(v, end) - h(begin, v)) / 2 and the backward search by -p(v), which keeps
+	// both consistent with each other. The searches stop once the best meeting point found
+	// can no longer be improved by either open list.
+	forward.nodes[begin_node].f_score = begin_to_end_estimate * 0.5;
+	forward.push(begin_node);
+
+	FrozenSearch backward;
+	uint32_t end_node = backward.get_or_add_node(end_point);
+	backward.nodes[end_node].g_score = 0;
+	backward.nodes[end_node].f_score = begin_to_end_estimate * 0.5;
+	backward.push(end_node);
+
+	real_t best_cost = Math::INF;
+	uint32_t meeting_point = UINT32_MAX;
+
+	while (forward.clean_top() && backward.clean_top()) {
+		if (forward.open_list[0].f_score + backward.open_list[0].f_score >= best_cost) {
+			break;
+		}
+
+		// Expand the smaller frontier to keep both searches balanced.
+		const bool is_forward = forward.open_list.size() <= backward.open_list.size();
+		FrozenSearch &search = is_forward ? forward : backward;
+		const FrozenSearch &other = is_forward ? backward : forward;
+		const LocalVector<uint32_t> &offsets = is_forward ? p_graph.neighbor_offsets : p_graph.incoming_offsets;
+		const LocalVector<uint32_t> &neighbors = is_forward ? p_graph.neighbors : p_graph.incoming;
+
+		uint32_t node_index = search.pop();
+		const FrozenSearchNode node = search.nodes[node_index];
+		if (node.point == (is_forward ? end_point : begin_point)) {
+			continue; // Nothing to gain from searching past the other search's origin.
+		}
+		const int64_t point_id = p_graph.point_ids[node.point];
+
+		for (uint32_t i = offsets[node.point]; i < offsets[node.point + 1]; i++) {
+			const uint32_t neighbor = neighbors[i];
+			// The begin point may be disabled, it is only skipped when it is a neighbor.
+			if (!p_graph.point_enabled[neighbor] && (is_forward || neighbor != begin_point)) {
+				continue;
+			}
+
+			const int64_t neighbor_id = p_graph.point_ids[neighbor];
+			real_t tentative_g_score;
+			if (is_forward) {
+				tentative_g_score = node.g_score + p_costs->_compute_cost(point_id, neighbor_id) * p_graph.point_weight_scales[neighbor];
+			} else {
+				tentative_g_score = node.g_score + p_costs->_compute_cost(neighbor_id, point_id) * p_graph.point_weight_scales[node.point];
+			}
+
+			uint32_t neighbor_node = search.get_or_add_node(neighbor);
+			FrozenSearchNode &e = search.nodes[neighbor_node];
+			if (e.closed || tentative_g_score >= e.g_score) {
+				continue;
+			}
+
+			const real_t potential = (p_costs->_estimate_cost(neighbor_id, p_to_id) - p_costs->_estimate_cost(p_from_id, neighbor_id)) * 0.5;
+			e.prev_node = node_index;
+			e.g_score = tentative_g_score;
+			e.f_score = tentative_g_score + (is_forward ? potential : -potential);
+			search.push(neighbor_node);
+
+			uint32_t other_node = other.find_node(neighbor);
+			if (other_node != UINT32_MAX && tentative_g_score + other.nodes[other_node].g_score < best_cost) {
+				best_cost = tentative_g_score + other.nodes[other_node].g_score;
+				meeting_point = neighbor;
+			}
+		}
+	}
+
+	if (meeting_point == UINT32_MAX) {
+		return false;
+	}
+
+	for (uint32_t node_index = forward.find_node(meeting_point); node_index != UINT32_MAX; node_index = forward.nodes[node_index].prev_node) {
+		r_path.push_back(forward.nodes[node_index].point);
+	}
+	r_path.reverse();
+	for (uint32_t node_index = backward.nodes[backward.find_node(meeting_point)].prev_node; node_index != UINT32_MAX; node_index = backward.nodes[node_index].prev_node) {
+		r_path.push_back(backward.nodes[node_index].point);
+	}
+	return true;
+}
+
+void AStar3D::freeze() {
+	unfreeze();
+
+	const uint32_t point_count = points.get_num_elements();
+	frozen_graph.point_indices.reserve(point_count);
+	frozen_graph.point_ids.reserve(point_count);
+	frozen_graph.point_positions.reserve(point_count);
+	frozen_graph.point_weight_scales.reserve(point_count);
+	frozen_graph.point_enabled.reserve(point_count);
+
+	for (OAHashMap<int64_t, Point *>::Iterator it = points.iter(); it.valid; it = points.next_iter(it)) {
+		const Point *p = *(it.value);
+		frozen_graph.point_indices.insert(p->id, frozen_graph.point_ids.size());
+		frozen_graph.point_ids.push_back(p->id);
+		frozen_graph.point_positions.push_back(p->pos);
+		frozen_graph.point_weight_scales.push_back(p->weight_scale);
+		frozen_graph.point_enabled.push_back(p->enabled);
+	}
+
+	frozen_graph.neighbor_offsets.resize(point_count + 1);
+	frozen_graph.incoming_offsets.resize(point_count + 1);
+	memset(frozen_graph.incoming_offsets.ptr(), 0, sizeof(uint32_t) * (point_count + 1));
+
+	for (uint32_t i = 0; i < point_count; i++) {
+		Point *p = nullptr;
+		points.lookup(frozen_graph.point_ids[i], p);
+
+		frozen_graph.neighbor_offsets[i] = frozen_graph.neighbors.size();
+		for (OAHashMap<int64_t, Point *>::Iterator it = p->neighbors.iter(); it.valid; it = p->neighbors.next_iter(it)) {
+			uint32_t neighbor = frozen_graph.point_indices[*(it.key)];
+			frozen_graph.neighbors.push_back(neighbor);
+			frozen_graph.incoming_offsets[neighbor + 1]++;
+		}
+	}
+	frozen_graph.neighbor_offsets[point_count] = frozen_graph.neighbors.size();
+
+	for (uint32_t i = 0; i < point_count; i++) {
+		frozen_graph.incoming_offsets[i + 1] += frozen_graph.incoming_offsets[i];
+	}
+
+	LocalVector<uint32_t> incoming_fill;
+	incoming_fill.resize(point_count);
+	memcpy(incoming_fill.ptr(), frozen_graph.incoming_offsets.ptr(), sizeof(uint32_t) * point_count);
+	frozen_graph.incoming.resize(frozen_graph.neighbors.size());
+	for (uint32_t i = 0; i < point_count; i++) {
+		for (uint32_t j = frozen_graph.neighbor_offsets[i]; j < frozen_graph.neighbor_offsets[i + 1]; j++) {
+			frozen_graph.incoming[incoming_fill[frozen_graph.neighbors[j]]++] = i;
+		}
+	}
+
+	// The connections now live in the compact arrays, so release the per-point maps
+	// instead of keeping two copies of the graph. unfreeze() rebuilds them.
+	for (OAHashMap<int64_t, Point *>::Iterator it = points.iter(); it.valid; it = points.next_iter(it)) {
+		Point *p = *(it.value);
+		p->neighbors = OAHashMap<int64_t, Point *>(1u);
+		p->unlinked_neighbours = OAHashMap<int64_t, Point *>(1u);
+	}
+
+	frozen = true;
+}
+
+void AStar3D::unfreeze() {
+	if (frozen) {
+		const uint32_t point_count = frozen_graph.point_ids.size();
+		LocalVector<Point *> frozen_points;
+		frozen_points.resize(point_count);
+		for (uint32_t i = 0; i < point_count; i++) {
+			points.lookup(frozen_graph.point_ids[i], frozen_points[i]);
+		}
+
+		for (uint32_t i = 0; i < point_count; i++) {
+			for (uint32_t j = frozen_graph.neighbor_offsets[i]; j < frozen_graph.neighbor_offsets[i + 1]; j++) {
+				Point *neighbor = frozen_points[frozen_graph.neighbors[j]];
+				frozen_points[i]->neighbors.set(neighbor->id, neighbor);
+			}
+		}
+
+		// A point that is linked from another point it doesn't link back to keeps it as an unlinked neighbor.
+		for (uint32_t i = 0; i < point_count; i++) {
+			Point *p = frozen_points[i];
+			for (uint32_t j = frozen_graph.incoming_offsets[i]; j < frozen_graph.incoming_offsets[i + 1]; j++) {
+				Point *from = frozen_points[frozen_graph.incoming[j]];
+				if (!p->neighbors.has(from->id)) {
+					p->unlinked_neighbours.set(from->id, from);
+				}
+			}
+		}
+	}
+
+	frozen = false;
+	frozen_graph.point_indices.clear();
+	frozen_graph.point_ids.clear();
+	frozen_graph.point_positions.clear();
+	frozen_graph.point_weight_scales.clear();
+	frozen_graph.point_enabled.clear();
+	frozen_graph.neighbor_offsets.clear();
+	frozen_graph.neighbors.clear();
+	frozen_graph.incoming_offsets.clear();
+	frozen_graph.incoming.clear();
+}
+
+bool AStar3D::is_frozen() const {
+	return frozen;
+}
+
 real_t AStar3D::_estimate_cost(int64_t p_from_id, int64_t p_end_id) {
 	real_t scost;
 	if (GDVIRTUAL_CALL(_estimate_cost, p_from_id, p_end_id, scost)) {
@@ -433,6 +789,20 @@ Vector<Vector3> AStar3D::get_point_path(int64_t p_from_id, int64_t p_to_id, bool
 		return ret;
 	}
 
+	if (frozen) {
+		// Frozen graphs are searched without touching the points, so this is safe to call from several threads.
+		LocalVector<uint32_t> frozen_path;
+		_solve_frozen(frozen_graph, this, p_from_id, p_to_id, p_allow_partial_path, frozen_path);
+
+		Vector<Vector3> path;
+		path.resize(frozen_path.size());
+		Vector3 *w = path.ptrw();
+		for (uint32_t i = 0; i < frozen_path.size(); i++) {
+			w[i] = frozen_graph.point_positions[frozen_path[i]];
+		}
+		return path;
+	}
+
 	Point *begin_point = a;
 	Point *end_point = b;
 
@@ -487,6 +857,19 @@ Vector<int64_t> AStar3D::get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_
 		return ret;
 	}
 
+	if (frozen) {
+		LocalVector<uint32_t> frozen_path;
+		_solve_frozen(frozen_graph, this, p_from_id, p_to_id, p_allow_partial_path, frozen_path);
+
+		Vector<int64_t> path;
+		path.resize(frozen_path.size());
+		int64_t *w = path.ptrw();
+		for (uint32_t i = 0; i < frozen_path.size(); i++) {
+			w[i] = frozen_graph.point_ids[frozen_path[i]];
+		}
+		return path;
+	}
+
 	Point *begin_point = a;
 	Point *end_point = b;
 
@@ -532,6 +915,10 @@ void AStar3D::set_point_disabled(int64_t p_id, bool p_disabled) {
 	ERR_FAIL_COND_MSG(!p_exists, vformat("Can't set if point is disabled. Point with id: %d doesn't exist.", p_id));
 
 	p->enabled = !p_disabled;
+
+	if (frozen) {
+		frozen_graph.point_enabled[frozen_graph.point_indices[p_id]] = !p_disabled;
+	}
 }
 
 bool AStar3D::is_point_disabled(int64_t p_id) const {
@@ -566,6 +953,10 @@ void AStar3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("reserve_space", "num_nodes"), &AStar3D::reserve_space);
 	ClassDB::bind_method(D_METHOD("clear"), &AStar3D::clear);
 
+	ClassDB::bind_method(D_METHOD("freeze"), &AStar3D::freeze);
+	ClassDB::bind_method(D_METHOD("unfreeze"), &AStar3D::unfreeze);
+	ClassDB::bind_method(D_METHOD("is_frozen"), &AStar3D::is_frozen);
+
 	ClassDB::bind_method(D_METHOD("get_closest_point", "to_position", "include_disabled"), &AStar3D::get_closest_point, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_closest_position_in_segment", "to_position"), &AStar3D::get_closest_position_in_segment);
 
@@ -659,6 +1050,18 @@ void AStar2D::reserve_space(int64_t p_num_nodes) {
 	astar.reserve_space(p_num_nodes);
 }
 
+void AStar2D::freeze() {
+	astar.freeze();
+}
+
+void AStar2D::unfreeze() {
+	astar.unfreeze();
+}
+
+bool AStar2D::is_frozen() const {
+	return astar.is_frozen();
+}
+
 int64_t AStar2D::get_closest_point(const Vector2 &p_point, bool p_include_disabled) const {
 	return astar.get_closest_point(Vector3(p_point.x, p_point.y, 0), p_include_disabled);
 }
@@ -716,6 +1119,19 @@ Vector<Vector2> AStar2D::get_point_path(int64_t p_from_id, int64_t p_to_id, bool
 		return ret;
 	}
 
+	if (astar.frozen) {
+		LocalVector<uint32_t> frozen_path;
+		AStar3D::_solve_frozen(astar.frozen_graph, this, p_from_id, p_to_id, p_allow_partial_path, frozen_path);
+
+		Vector<Vector2> path;
+		path.resize(frozen_path.size());
+		Vector2 *w = path.ptrw();
+		for (uint32_t i = 0; i < frozen_path.size(); i++) {
+			w[i] = Vector2(astar.frozen_graph.point_positions[frozen_path[i]].x, astar.frozen_graph.point_positions[frozen_path[i]].y);
+		}
+		return path;
+	}
+
 	AStar3D::Point *begin_point = a;
 	AStar3D::Point *end_point = b;
 
@@ -770,6 +1186,19 @@ Vector<int64_t> AStar2D::get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_
 		return ret;
 	}
 
+	if (astar.frozen) {
+		LocalVector<uint32_t> frozen_path;
+		AStar3D::_solve_frozen(astar.frozen_graph, this, p_from_id, p_to_id, p_allow_partial_path, frozen_path);
+
+		Vector<int64_t> path;
+		path.resize(frozen_path.size());
+		int64_t *w = path.ptrw();
+		for (uint32_t i = 0; i < frozen_path.size(); i++) {
+			w[i] = astar.frozen_graph.point_ids[frozen_path[i]];
+		}
+		return path;
+	}
+
 	AStar3D::Point *begin_point = a;
 	AStar3D::Point *end_point = b;
 
@@ -905,6 +1334,10 @@ void AStar2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("reserve_space", "num_nodes"), &AStar2D::reserve_space);
 	ClassDB::bind_method(D_METHOD("clear"), &AStar2D::clear);
 
+	ClassDB::bind_method(D_METHOD("freeze"), &AStar2D::freeze);
+	ClassDB::bind_method(D_METHOD("unfreeze"), &AStar2D::unfreeze);
+	ClassDB::bind_method(D_METHOD("is_frozen"), &AStar2D::is_frozen);
+
 	ClassDB::bind_method(D_METHOD("get_closest_point", "to_position", "include_disabled"), &AStar2D::get_closest_point, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_closest_position_in_segment", "to_position"), &AStar2D::get_closest_position_in_segment);
 
@@ -32,7 +32,10 @@
 
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
+#include "core/templates/sort_array.h"
 
 /**
 	A* pathfinding algorithm.
@@ -107,6 +110,63 @@ class AStar3D : public RefCounted {
 		}
 	};
 
+	// Compact copy of the graph made by `freeze()`. Points are stored by dense index and their
+	// connections in CSR layout, so that path queries neither touch nor modify the `Point` structs.
+	struct FrozenGraph {
+		HashMap<int64_t, uint32_t> point_indices;
+		LocalVector<int64_t> point_ids;
+		LocalVector<Vector3> point_positions;
+		LocalVector<real_t> point_weight_scales;
+		LocalVector<uint8_t> point_enabled;
+
+		LocalVector<uint32_t> neighbor_offsets;
+		LocalVector<uint32_t> neighbors;
+		// Points that have the point as neighbor, used by the backward search.
+		LocalVector<uint32_t> incoming_offsets;
+		LocalVector<uint32_t> incoming;
+	};
+
+	struct FrozenSearchNode {
+		uint32_t point = 0;
+		uint32_t prev_node = UINT32_MAX;
+		real_t g_score = 0;
+		real_t f_score = 0;
+		bool closed = false;
+	};
+
+	struct FrozenOpenNode {
+		uint32_t node = 0;
+		real_t g_score = 0;
+		real_t f_score = 0;
+	};
+
+	struct SortFrozenOpenNodes {
+		_FORCE_INLINE_ bool operator()(const FrozenOpenNode &A, const FrozenOpenNode &B) const { // Returns true when the node A is worse than node B.
+			if (A.f_score > B.f_score) {
+				return true;
+			} else if (A.f_score < B.f_score) {
+				return false;
+			} else {
+				return A.g_score < B.g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
+			}
+		}
+	};
+
+	// State of one search direction. Only reached points get a node.
+	struct FrozenSearch {
+		HashMap<uint32_t, uint32_t> node_indices;
+		LocalVector<FrozenSearchNode> nodes;
+		LocalVector<FrozenOpenNode> open_list;
+		SortArray<FrozenOpenNode, SortFrozenOpenNodes> sorter;
+
+		uint32_t find_node(uint32_t p_point) const;
+		uint32_t get_or_add_node(uint32_t p_point);
+		void push(uint32_t p_node);
+		// Drops outdated entries from the top of the open list, returns false when it is empty.
+		bool clean_top();
+		uint32_t pop();
+	};
+
 	mutable int64_t last_free_id = 0;
 	uint64_t pass = 1;
 
@@ -114,8 +174,14 @@ class AStar3D : public RefCounted {
 	HashSet<Segment, Segment> segments;
 	Point *last_closest_point = nullptr;
 
+	bool frozen = false;
+	FrozenGraph frozen_graph;
+
 	bool _solve(Point *begin_point, Point *end_point, bool p_allow_partial_path);
 
+	template <typename T>
+	static bool _solve_frozen(const FrozenGraph &p_graph, T *p_costs, int64_t p_from_id, int64_t p_to_id, bool p_allow_partial_path, LocalVector<uint32_t> &r_path);
+
 protected:
 	static void _bind_methods();
 
@@ -156,6 +222,10 @@ public:
 	void reserve_space(int64_t p_num_nodes);
 	void clear();
 
+	void freeze();
+	void unfreeze();
+	bool is_frozen() const;
+
 	int64_t get_closest_point(const Vector3 &p_point, bool p_include_disabled = false) const;
 	Vector3 get_closest_position_in_segment(const Vector3 &p_point) const;
 
@@ -168,6 +238,7 @@ public:
 
 class AStar2D : public RefCounted {
 	GDCLASS(AStar2D, RefCounted);
+	friend class AStar3D;
 	AStar3D astar;
 
 	bool _solve(AStar3D::Point *begin_point, AStar3D::Point *end_point, bool p_allow_partial_path);
@@ -212,6 +283,10 @@ public:
 	void reserve_space(int64_t p_num_nodes);
 	void clear();
 
+	void freeze();
+	void unfreeze();
+	bool is_frozen() const;
+
 	int64_t get_closest_point(const Vector2 &p_point, bool p_include_disabled = false) const;
 	Vector2 get_closest_position_in_segment(const Vector2 &p_point) const;
 
@@ -31,6 +31,7 @@
 #include "a_star_grid_2d.h"
 #include "a_star_grid_2d.compat.inc"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/variant/typed_array.h"
 
 static real_t heuristic_euclidean(const Vector2i &p_from, const Vector2i &p_to) {
@@ -132,13 +133,24 @@ void AStarGrid2D::update() {
 	const int32_t end_x = region.get_end().x;
 	const int32_t end_y = region.get_end().y;
 	const Vector2 half_cell_size = cell_size / 2;
-	for (int32_t x = region.position.x; x < end_x + 2; x++) {
-		solid_mask.push_back(true);
+
+	// All cells start walkable, only the border around the region is solid.
+	const size_t mask_size = size_t(region.size.x + 2) * size_t(region.size.y + 2);
+	solid_mask.resize((mask_size + 63) / 64);
+	for (uint64_t &mask_word : solid_mask) {
+		mask_word = 0;
+	}
+	for (int32_t x = region.position.x - 1; x < end_x + 1; x++) {
+		_set_solid_unchecked(x, region.position.y - 1, true);
+		_set_solid_unchecked(x, end_y, true);
+	}
+	for (int32_t y = region.position.y; y < end_y; y++) {
+		_set_solid_unchecked(region.position.x - 1, y, true);
+		_set_solid_unchecked(end_x, y, true);
 	}
 
 	for (int32_t y = region.position.y; y < end_y; y++) {
 		LocalVector<Point> line;
-		solid_mask.push_back(true);
 		for (int32_t x = region.position.x; x < end_x; x++) {
 			Vector2 v = offset;
 			switch (cell_shape) {
@@ -155,16 +167,10 @@ void AStarGrid2D::update() {
 					break;
 			}
 			line.push_back(Point(Vector2i(x, y), v));
-			solid_mask.push_back(false);
 		}
-		solid_mask.push_back(true);
 		points.push_back(line);
 	}
 
-	for (int32_t x = region.position.x; x < end_x + 2; x++) {
-		solid_mask.push_back(true);
-	}
-
 	dirty = false;
 }
 
@@ -270,31 +276,42 @@ void AStarGrid2D::fill_weight_scale_region(const Rect2i &p_region, real_t p_weig
 }
 
 AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
-	int32_t from_x = p_from->id.x;
-	int32_t from_y = p_from->id.y;
+	Vector2i jump_id;
+	if (_jump_id(p_from->id, p_to->id, end->id, jump_id)) {
+		return _get_point_unchecked(jump_id);
+	}
+	return nullptr;
+}
+
+bool AStarGrid2D::_jump_id(const Vector2i &p_from, const Vector2i &p_to, const Vector2i &p_end, Vector2i &r_jump_id) const {
+	int32_t from_x = p_from.x;
+	int32_t from_y = p_from.y;
 
-	int32_t to_x = p_to->id.x;
-	int32_t to_y = p_to->id.y;
+	int32_t to_x = p_to.x;
+	int32_t to_y = p_to.y;
 
 	int32_t dx = to_x - from_x;
 	int32_t dy = to_y - from_y;
 
 	if (diagonal_mode == DIAGONAL_MODE_ALWAYS || diagonal_mode == DIAGONAL_MODE_AT_LEAST_ONE_WALKABLE) {
 		if (dx == 0 || dy == 0) {
-			return _forced_successor(to_x, to_y, dx, dy);
+			return _forced_successor_id(to_x, to_y, dx, dy, p_end, r_jump_id);
 		}
 
 		while (_is_walkable(to_x, to_y) && (diagonal_mode == DIAGONAL_MODE_ALWAYS || _is_walkable(to_x, to_y - dy) || _is_walkable(to_x - dx, to_y))) {
-			if (end->id.x == to_x && end->id.y == to_y) {
-				return end;
+			if (p_end.x == to_x && p_end.y == to_y) {
+				r_jump_id = p_end;
+				return true;
 			}
 
 			if ((_is_walkable(to_x - dx, to_y + dy) && !_is_walkable(to_x - dx, to_y)) || (_is_walkable(to_x + dx, to_y - dy) && !_is_walkable(to_x, to_y - dy))) {
-				return _get_point_unchecked(to_x, to_y);
+				r_jump_id = Vector2i(to_x, to_y);
+				return true;
 			}
 
-			if (_forced_successor(to_x + dx, to_y, dx, 0) != nullptr || _forced_successor(to_x, to_y + dy, 0, dy) != nullptr) {
-				return _get_point_unchecked(to_x, to_y);
+			if (_forced_successor_id(to_x + dx, to_y, dx, 0, p_end, r_jump_id) || _forced_successor_id(to_x, to_y + dy, 0, dy, p_end, r_jump_id)) {
+				r_jump_id = Vector2i(to_x, to_y);
+				return true;
 			}
 
 			to_x += dx;
@@ -303,20 +320,23 @@ AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
 
 	} else if (diagonal_mode == DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES) {
 		if (dx == 0 || dy == 0) {
-			return _forced_successor(from_x, from_y, dx, dy, true);
+			return _forced_successor_id(from_x, from_y, dx, dy, p_end, r_jump_id, true);
 		}
 
 		while (_is_walkable(to_x, to_y) && _is_walkable(to_x, to_y - dy) && _is_walkable(to_x - dx, to_y)) {
-			if (end->id.x == to_x && end->id.y == to_y) {
-				return end;
+			if (p_end.x == to_x && p_end.y == to_y) {
+				r_jump_id = p_end;
+				return true;
 			}
 
 			if ((_is_walkable(to_x + dx, to_y + dy) && !_is_walkable(to_x, to_y + dy)) || !_is_walkable(to_x + dx, to_y)) {
-				return _get_point_unchecked(to_x, to_y);
+				r_jump_id = Vector2i(to_x, to_y);
+				return true;
 			}
 
-			if (_forced_successor(to_x, to_y, dx, 0) != nullptr || _forced_successor(to_x, to_y, 0, dy) != nullptr) {
-				return _get_point_unchecked(to_x, to_y);
+			if (_forced_successor_id(to_x, to_y, dx, 0, p_end, r_jump_id) || _forced_successor_id(to_x, to_y, 0, dy, p_end, r_jump_id)) {
+				r_jump_id = Vector2i(to_x, to_y);
+				return true;
 			}
 
 			to_x += dx;
@@ -325,30 +345,33 @@ AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
 
 	} else { // DIAGONAL_MODE_NEVER
 		if (dy == 0) {
-			return _forced_successor(from_x, from_y, dx, 0, true);
+			return _forced_successor_id(from_x, from_y, dx, 0, p_end, r_jump_id, true);
 		}
 
 		while (_is_walkable(to_x, to_y)) {
-			if (end->id.x == to_x && end->id.y == to_y) {
-				return end;
+			if (p_end.x == to_x && p_end.y == to_y) {
+				r_jump_id = p_end;
+				return true;
 			}
 
 			if ((_is_walkable(to_x - 1, to_y) && !_is_walkable(to_x - 1, to_y - dy)) || (_is_walkable(to_x + 1, to_y) && !_is_walkable(to_x + 1, to_y - dy))) {
-				return _get_point_unchecked(to_x, to_y);
+				r_jump_id = Vector2i(to_x, to_y);
+				return true;
 			}
 
-			if (_forced_successor(to_x, to_y, 1, 0, true) != nullptr || _forced_successor(to_x, to_y, -1, 0, true) != nullptr) {
-				return _get_point_unchecked(to_x, to_y);
+			if (_forced_successor_id(to_x, to_y, 1, 0, p_end, r_jump_id, true) || _forced_successor_id(to_x, to_y, -1, 0, p_end, r_jump_id, true)) {
+				r_jump_id = Vector2i(to_x, to_y);
+				return true;
 			}
 
 			to_y += dy;
 		}
 	}
 
-	return nullptr;
+	return false;
 }
 
-AStarGrid2D::Point *AStarGrid2D::_forced_successor(int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy, bool p_inclusive) {
+bool AStarGrid2D::_forced_successor_id(int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy, const Vector2i &p_end, Vector2i &r_successor_id, bool p_inclusive) const {
 	// Remembering previous results can improve performance.
 	bool l_prev = false, r_prev = false, l = false, r = false;
 
@@ -362,8 +385,9 @@ AStarGrid2D::Point *AStarGrid2D::_forced_successor(int32_t p_x, int32_t p_y, int
 	int32_t r_x = p_x + p_dy, r_y = p_y + p_dx;
 
 	while (_is_walkable(o_x, o_y)) {
-		if (end->id.x == o_x && end->id.y == o_y) {
-			return end;
+		if (p_end.x == o_x && p_end.y == o_y) {
+			r_successor_id = p_end;
+			return true;
 		}
 
 		l_prev = l || _is_walkable(l_x, l_y);
@@ -378,13 +402,14 @@ AStarGrid2D::Point *AStarGrid2D::_forced_successor(int32_t p_x, int32_t p_y, int
 		r = _is_walkable(r_x, r_y);
 
 		if ((l && !l_prev) || (r && !r_prev)) {
-			return _get_point_unchecked(o_x, o_y);
+			r_successor_id = Vector2i(o_x, o_y);
+			return true;
 		}
 
 		o_x += p_dx;
 		o_y += p_dy;
 	}
-	return nullptr;
+	return false;
 }
 
 void AStarGrid2D::_get_nbors(Point *p_point, LocalVector<Point *> &r_nbors) {
@@ -491,6 +516,66 @@ void AStarGrid2D::_get_nbors(Point *p_point, LocalVector<Point *> &r_nbors) {
 	}
 }
 
+void AStarGrid2D::_get_nbor_ids(const Vector2i &p_id, LocalVector<Vector2i> &r_nbors) const {
+	// The solid border around the region keeps all neighbors in bounds.
+	const bool ts0 = _is_walkable(p_id.x, p_id.y - 1);
+	const bool ts1 = _is_walkable(p_id.x + 1, p_id.y);
+	const bool ts2 = _is_walkable(p_id.x, p_id.y + 1);
+	const bool ts3 = _is_walkable(p_id.x - 1, p_id.y);
+
+	if (ts0) {
+		r_nbors.push_back(Vector2i(p_id.x, p_id.y - 1));
+	}
+	if (ts1) {
+		r_nbors.push_back(Vector2i(p_id.x + 1, p_id.y));
+	}
+	if (ts2) {
+		r_nbors.push_back(Vector2i(p_id.x, p_id.y + 1));
+	}
+	if (ts3) {
+		r_nbors.push_back(Vector2i(p_id.x - 1, p_id.y));
+	}
+
+	bool td0 = false, td1 = false, td2 = false, td3 = false;
+	switch (diagonal_mode) {
+		case DIAGONAL_MODE_ALWAYS: {
+			td0 = true;
+			td1 = true;
+			td2 = true;
+			td3 = true;
+		} break;
+		case DIAGONAL_MODE_NEVER: {
+		} break;
+		case DIAGONAL_MODE_AT_LEAST_ONE_WALKABLE: {
+			td0 = ts3 || ts0;
+			td1 = ts0 || ts1;
+			td2 = ts1 || ts2;
+			td3 = ts2 || ts3;
+		} break;
+		case DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES: {
+			td0 = ts3 && ts0;
+			td1 = ts0 && ts1;
+			td2 = ts1 && ts2;
+			td3 = ts2 && ts3;
+		} break;
+		default:
+			break;
+	}
+
+	if (td0 && _is_walkable(p_id.x - 1, p_id.y - 1)) {
+		r_nbors.push_back(Vector2i(p_id.x - 1, p_id.y - 1));
+	}
+	if (td1 && _is_walkable(p_id.x + 1, p_id.y - 1)) {
+		r_nbors.push_back(Vector2i(p_id.x + 1, p_id.y - 1));
+	}
+	if (td2 && _is_walkable(p_id.x + 1, p_id.y + 1)) {
+		r_nbors.push_back(Vector2i(p_id.x + 1, p_id.y + 1));
+	}
+	if (td3 && _is_walkable(p_id.x - 1, p_id.y + 1)) {
+		r_nbors.push_back(Vector2i(p_id.x - 1, p_id.y + 1));
+	}
+}
+
 bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path) {
 	last_closest_point = nullptr;
 	pass++;
@@ -577,6 +662,138 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_
 	return found_route;
 }
 
+bool AStarGrid2D::solve_id_path(const Vector2i &p_from_id, const Vector2i &p_to_id, bool p_allow_partial_path, LocalVector<Vector2i> &r_path) const {
+	r_path.clear();
+	ERR_FAIL_COND_V_MSG(dirty, false, "Grid is not initialized. Call the update method.");
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_from_id), false, vformat("Can't get id path. Point %s out of bounds %s.", p_from_id, region));
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_to_id), false, vformat("Can't get id path. Point %s out of bounds %s.", p_to_id, region));
+
+	if (p_from_id == p_to_id) {
+		r_path.push_back(p_from_id);
+		return true;
+	}
+
+	if (_get_solid_unchecked(p_to_id) && !p_allow_partial_path) {
+		return false;
+	}
+
+	real_t (*compute_cost)(const Vector2i &, const Vector2i &) = heuristics[default_compute_heuristic];
+	real_t (*estimate_cost)(const Vector2i &, const Vector2i &) = heuristics[default_estimate_heuristic];
+
+	// Only the visited cells get a node, so the search state stays small on large grids.
+	HashMap<Vector2i, uint32_t> node_indices;
+	LocalVector<SolveNode> nodes;
+	LocalVector<OpenNode> open_list;
+	SortArray<OpenNode, SortOpenNodes> sorter;
+	LocalVector<Vector2i> nbors;
+
+	SolveNode begin_node;
+	begin_node.id = p_from_id;
+	begin_node.f_score = estimate_cost(p_from_id, p_to_id);
+	nodes.push_back(begin_node);
+	node_indices.insert(p_from_id, 0);
+
+	OpenNode begin_open_node;
+	begin_open_node.f_score = begin_node.f_score;
+	open_list.push_back(begin_open_node);
+
+	uint32_t end_node = UINT32_MAX;
+	uint32_t closest_node = UINT32_MAX;
+
+	while (!open_list.is_empty()) {
+		const OpenNode open_node = open_list[0];
+		sorter.pop_heap(0, open_list.size(), open_list.ptr());
+		open_list.remove_at(open_list.size() - 1);
+
+		// Nodes are pushed again instead of moved up when a shorter route is found, skip the outdated entries.
+		if (nodes[open_node.node].closed || open_node.g_score != nodes[open_node.node].g_score) {
+			continue;
+		}
+
+		const Vector2i id = nodes[open_node.node].id;
+		const real_t g_score = nodes[open_node.node].g_score;
+
+		// Find point closer to end_point, or same distance to end_point but closer to begin_point.
+		if (closest_node == UINT32_MAX) {
+			closest_node = open_node.node;
+		} else {
+			const SolveNode &closest = nodes[closest_node];
+			const real_t closest_h_score = closest.f_score - closest.g_score;
+			const real_t h_score = open_node.f_score - g_score;
+			if (closest_h_score > h_score || (closest_h_score >= h_score && closest.g_score > g_score)) {
+				closest_node = open_node.node;
+			}
+		}
+
+		if (id == p_to_id) {
+			end_node = open_node.node;
+			break;
+		}
+
+		nodes[open_node.node].closed = true;
+
+		nbors.clear();
+		_get_nbor_ids(id, nbors);
+
+		for (Vector2i nbor : nbors) {
+			real_t weight_scale = 1.0;
+
+			if (jumping_enabled) {
+				if (!_jump_id(id, nbor, p_to_id, nbor)) {
+					continue;
+				}
+			} else {
+				weight_scale = _get_point_unchecked(nbor)->weight_scale;
+			}
+
+			const real_t tentative_g_score = g_score + compute_cost(id, nbor) * weight_scale;
+
+			uint32_t nbor_node;
+			HashMap<Vector2i, uint32_t>::Iterator E = node_indices.find(nbor);
+			if (E) {
+				nbor_node = E->value;
+				if (nodes[nbor_node].closed || tentative_g_score >= nodes[nbor_node].g_score) {
+					continue;
+				}
+			} else {
+				nbor_node = nodes.size();
+				SolveNode new_node;
+				new_node.id = nbor;
+				nodes.push_back(new_node);
+				node_indices.insert(nbor, nbor_node);
+			}
+
+			SolveNode &node = nodes[nbor_node];
+			node.prev_node = open_node.node;
+			node.g_score = tentative_g_score;
+			node.f_score = tentative_g_score + estimate_cost(nbor, p_to_id);
+
+			OpenNode nbor_open_node;
+			nbor_open_node.node = nbor_node;
+			nbor_open_node.g_score = node.g_score;
+			nbor_open_node.f_score = node.f_score;
+			open_list.push_back(nbor_open_node);
+			sorter.push_heap(0, open_list.size() - 1, 0, nbor_open_node, open_list.ptr());
+		}
+	}
+
+	if (end_node == UINT32_MAX) {
+		if (!p_allow_partial_path || closest_node == UINT32_MAX) {
+			return false;
+		}
+
+		// Use closest point instead.
+		end_node = closest_node;
+	}
+
+	for (uint32_t node = end_node; node != UINT32_MAX; node = nodes[node].prev_node) {
+		r_path.push_back(nodes[node].id);
+	}
+	r_path.reverse();
+
+	return true;
+}
+
 real_t AStarGrid2D::_estimate_cost(const Vector2i &p_from_id, const Vector2i &p_end_id) {
 	real_t scost;
 	if (GDVIRTUAL_CALL(_estimate_cost, p_from_id, p_end_id, scost)) {
@@ -735,6 +952,57 @@ TypedArray<Vector2i> AStarGrid2D::get_id_path(const Vector2i &p_from_id, const V
 	return path;
 }
 
+void AStarGrid2D::_solve_id_path_batch_task(void *p_userdata, uint32_t p_index) {
+	IdPathBatch *batch = static_cast<IdPathBatch *>(p_userdata);
+	batch->grid->solve_id_path(batch->from_to_ids[p_index * 2 + 0], batch->from_to_ids[p_index * 2 + 1], batch->allow_partial_path, batch->paths[p_index]);
+}
+
+TypedArray<Array> AStarGrid2D::get_id_paths(const TypedArray<Vector2i> &p_from_to_ids, bool p_allow_partial_path) {
+	ERR_FAIL_COND_V_MSG(dirty, TypedArray<Array>(), "Grid is not initialized. Call the update method.");
+	ERR_FAIL_COND_V_MSG(p_from_to_ids.size() % 2 != 0, TypedArray<Array>(), "The number of IDs must be even, as each path needs a start and an end ID.");
+
+	const uint32_t path_count = p_from_to_ids.size() / 2;
+	TypedArray<Array> paths;
+	paths.resize(path_count);
+
+	if (GDVIRTUAL_IS_OVERRIDDEN(_estimate_cost) || GDVIRTUAL_IS_OVERRIDDEN(_compute_cost)) {
+		// Script costs can not be evaluated on other threads.
+		for (uint32_t i = 0; i < path_count; i++) {
+			paths[i] = get_id_path(p_from_to_ids[i * 2 + 0], p_from_to_ids[i * 2 + 1], p_allow_partial_path);
+		}
+		return paths;
+	}
+
+	LocalVector<Vector2i> from_to_ids;
+	from_to_ids.resize(path_count * 2);
+	for (uint32_t i = 0; i < path_count * 2; i++) {
+		from_to_ids[i] = p_from_to_ids[i];
+	}
+
+	LocalVector<LocalVector<Vector2i>> id_paths;
+	id_paths.resize(path_count);
+
+	IdPathBatch batch;
+	batch.grid = this;
+	batch.from_to_ids = from_to_ids.ptr();
+	batch.allow_partial_path = p_allow_partial_path;
+	batch.paths = id_paths.ptr();
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&AStarGrid2D::_solve_id_path_batch_task, &batch, path_count, -1, true, SNAME("AStarGrid2DSolveIdPaths"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	for (uint32_t i = 0; i < path_count; i++) {
+		TypedArray<Vector2i> path;
+		path.resize(id_paths[i].size());
+		for (uint32_t j = 0; j < id_paths[i].size(); j++) {
+			path[j] = id_paths[i][j];
+		}
+		paths[i] = path;
+	}
+
+	return paths;
+}
+
 void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_region", "region"), &AStarGrid2D::set_region);
 	ClassDB::bind_method(D_METHOD("get_region"), &AStarGrid2D::get_region);
@@ -770,6 +1038,7 @@ void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_point_data_in_region", "region"), &AStarGrid2D::get_point_data_in_region);
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id", "allow_partial_path"), &AStarGrid2D::get_point_path, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id", "allow_partial_path"), &AStarGrid2D::get_id_path, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("get_id_paths", "from_to_ids", "allow_partial_path"), &AStarGrid2D::get_id_paths, DEFVAL(false));
 
 	GDVIRTUAL_BIND(_estimate_cost, "from_id", "end_id")
 	GDVIRTUAL_BIND(_compute_cost, "from_id", "to_id")
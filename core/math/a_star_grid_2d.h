@@ -108,7 +108,43 @@ private:
 		}
 	};
 
-	LocalVector<bool> solid_mask;
+	// Search state of one `solve_id_path()` call, kept outside of the points so that queries can run in parallel.
+	struct SolveNode {
+		Vector2i id;
+		uint32_t prev_node = UINT32_MAX;
+		real_t g_score = 0;
+		real_t f_score = 0;
+		bool closed = false;
+	};
+
+	struct OpenNode {
+		uint32_t node = 0;
+		real_t g_score = 0;
+		real_t f_score = 0;
+	};
+
+	struct SortOpenNodes {
+		_FORCE_INLINE_ bool operator()(const OpenNode &A, const OpenNode &B) const { // Returns true when the node A is worse than node B.
+			if (A.f_score > B.f_score) {
+				return true;
+			} else if (A.f_score < B.f_score) {
+				return false;
+			} else {
+				return A.g_score < B.g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
+			}
+		}
+	};
+
+	struct IdPathBatch {
+		const AStarGrid2D *grid = nullptr;
+		const Vector2i *from_to_ids = nullptr;
+		bool allow_partial_path = false;
+		LocalVector<Vector2i> *paths = nullptr;
+	};
+
+	// One bit per cell, with a solid border around the region.
+	LocalVector<uint64_t> solid_mask;
+	// One Point per cell, this is still most of the memory used by a grid.
 	LocalVector<LocalVector<Point>> points;
 	Point *end = nullptr;
 	Point *last_closest_point = nullptr;
@@ -121,7 +157,16 @@ private: // Internal routines.
 	}
 
 	_FORCE_INLINE_ bool _is_walkable(int32_t p_x, int32_t p_y) const {
-		return !solid_mask[_to_mask_index(p_x, p_y)];
+		const size_t index = _to_mask_index(p_x, p_y);
+		return !(solid_mask[index >> 6] & (uint64_t(1) << (index & 63)));
+	}
+
+	_FORCE_INLINE_ void _set_mask_bit(size_t p_index, bool p_solid) {
+		if (p_solid) {
+			solid_mask[p_index >> 6] |= uint64_t(1) << (p_index & 63);
+		} else {
+			solid_mask[p_index >> 6] &= ~(uint64_t(1) << (p_index & 63));
+		}
 	}
 
 	_FORCE_INLINE_ Point *_get_point(int32_t p_x, int32_t p_y) {
@@ -132,15 +177,15 @@ private: // Internal routines.
 	}
 
 	_FORCE_INLINE_ void _set_solid_unchecked(int32_t p_x, int32_t p_y, bool p_solid) {
-		solid_mask[_to_mask_index(p_x, p_y)] = p_solid;
+		_set_mask_bit(_to_mask_index(p_x, p_y), p_solid);
 	}
 
 	_FORCE_INLINE_ void _set_solid_unchecked(const Vector2i &p_id, bool p_solid) {
-		solid_mask[_to_mask_index(p_id.x, p_id.y)] = p_solid;
+		_set_mask_bit(_to_mask_index(p_id.x, p_id.y), p_solid);
 	}
 
 	_FORCE_INLINE_ bool _get_solid_unchecked(const Vector2i &p_id) const {
-		return solid_mask[_to_mask_index(p_id.x, p_id.y)];
+		return !_is_walkable(p_id.x, p_id.y);
 	}
 
 	_FORCE_INLINE_ Point *_get_point_unchecked(int32_t p_x, int32_t p_y) {
@@ -156,9 +201,12 @@ private: // Internal routines.
 	}
 
 	void _get_nbors(Point *p_point, LocalVector<Point *> &r_nbors);
+	void _get_nbor_ids(const Vector2i &p_id, LocalVector<Vector2i> &r_nbors) const;
 	Point *_jump(Point *p_from, Point *p_to);
+	bool _jump_id(const Vector2i &p_from, const Vector2i &p_to, const Vector2i &p_end, Vector2i &r_jump_id) const;
 	bool _solve(Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path);
-	Point *_forced_successor(int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy, bool p_inclusive = false);
+	bool _forced_successor_id(int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy, const Vector2i &p_end, Vector2i &r_successor_id, bool p_inclusive = false) const;
+	static void _solve_id_path_batch_task(void *p_userdata, uint32_t p_index);
 
 protected:
 	static void _bind_methods();
@@ -224,6 +272,10 @@ public:
 	TypedArray<Dictionary> get_point_data_in_region(const Rect2i &p_region) const;
 	Vector<Vector2> get_point_path(const Vector2i &p_from, const Vector2i &p_to, bool p_allow_partial_path = false);
 	TypedArray<Vector2i> get_id_path(const Vector2i &p_from, const Vector2i &p_to, bool p_allow_partial_path = false);
+	TypedArray<Array> get_id_paths(const TypedArray<Vector2i> &p_from_to_ids, bool p_allow_partial_path = false);
+
+	// Thread-safe variant of `get_id_path()` for engine code. It does not use the `_compute_cost` and `_estimate_cost` overrides.
+	bool solve_id_path(const Vector2i &p_from_id, const Vector2i &p_to_id, bool p_allow_partial_path, LocalVector<Vector2i> &r_path) const;
 };
 
 VARIANT_ENUM_CAST(AStarGrid2D::DiagonalMode);
@@ -235,6 +235,16 @@ struct BVH_ABB {
 		return true;
 	}
 
+	// Same as intersects_swizzled(), but tests every axis without early outs,
+	// so that runs of tests compile to straight line code the compiler can vectorize.
+	bool intersects_swizzled_branchless(const BVH_ABB &p_o) const {
+		int miss = 0;
+		for (int axis = 0; axis < POINT::AXIS_COUNT; ++axis) {
+			miss |= int(min[axis] < p_o.min[axis]) | int(neg_max[axis] < p_o.neg_max[axis]);
+		}
+		return miss == 0;
+	}
+
 	bool is_other_within(const BVH_ABB &p_o) const {
 		if (_any_lessthan(p_o.neg_max, neg_max)) {
 			return false;
@@ -31,6 +31,7 @@
 #include "message_queue.h"
 
 #include "core/config/project_settings.h"
+#include "core/debugger/frame_trace.h"
 #include "core/object/class_db.h"
 #include "core/object/script_language.h"
 
@@ -239,6 +240,8 @@ Error CallQueue::flush() {
 
 	flushing = true;
 
+	FRAME_TRACE_SCOPE("CallQueue::flush");
+
 	uint32_t i = 0;
 	uint32_t offset = 0;
 
@@ -35,12 +35,7 @@
 #include "core/object/script_language.h"
 #include "core/string/string_buffer.h"
 
-char32_t VariantParser::Stream::get_char() {
-	// is within buffer?
-	if (readahead_pointer < readahead_filled) {
-		return readahead_buffer[readahead_pointer++];
-	}
-
+char32_t VariantParser::Stream::_refill_and_get_char() {
 	// attempt to readahead
 	readahead_filled = _read_buffer(readahead_buffer, readahead_enabled ? READAHEAD_SIZE : 1);
 	if (readahead_filled) {
@@ -51,7 +46,7 @@ char32_t VariantParser::Stream::get_char() {
 		eof = true;
 		return 0;
 	}
-	return get_char();
+	return readahead_buffer[readahead_pointer++];
 }
 
 bool VariantParser::Stream::is_eof() const {
@@ -547,56 +542,137 @@ Error VariantParser::_parse_enginecfg(Stream *p_stream, Vector<String> &strings,
 	}
 }
 
+// Returns the next character that is not whitespace or part of a comment, or 0 at the end of the stream.
+static char32_t _skip_number_list_whitespace(VariantParser::Stream *p_stream, int &line) {
+	while (true) {
+		char32_t c;
+		if (p_stream->saved) {
+			c = p_stream->saved;
+			p_stream->saved = 0;
+		} else {
+			c = p_stream->get_char();
+			if (p_stream->is_eof()) {
+				return 0;
+			}
+		}
+
+		if (c == '\n') {
+			line++;
+		} else if (c == ';') {
+			while (true) {
+				c = p_stream->get_char();
+				if (p_stream->is_eof()) {
+					return 0;
+				}
+				if (c == '\n') {
+					line++;
+					break;
+				}
+			}
+		} else if (c > 32 || c == 0) {
+			return c;
+		}
+	}
+}
+
+// Reads the elements of a constructor up to the closing parenthesis directly from the
+// stream. Accepts the same input as get_token(), but doesn't build a token per element.
 template <typename T>
-Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct, int &line, String &r_err_str) {
-	Token token;
-	get_token(p_stream, token, line, r_err_str);
-	if (token.type != TK_PARENTHESIS_OPEN) {
-		r_err_str = "Expected '(' in constructor";
-		return ERR_PARSE_ERROR;
+Error VariantParser::_parse_number_list(Stream *p_stream, LocalVector<T> &r_values, int &line, String &r_err_str) {
+	char32_t c = _skip_number_list_whitespace(p_stream, line);
+	if (c == ')') {
+		return OK;
 	}
 
-	bool first = true;
 	while (true) {
-		if (!first) {
-			get_token(p_stream, token, line, r_err_str);
-			if (token.type == TK_COMMA) {
-				//do none
-			} else if (token.type == TK_PARENTHESIS_CLOSE) {
-				break;
-			} else {
-				r_err_str = "Expected ',' or ')' in constructor";
-				return ERR_PARSE_ERROR;
-			}
+		StringBuffer<> token_text;
+		bool negative = false;
+		if (c == '-') {
+			token_text += c;
+			negative = true;
+			c = p_stream->get_char();
 		}
-		get_token(p_stream, token, line, r_err_str);
 
-		if (first && token.type == TK_PARENTHESIS_CLOSE) {
-			break;
-		} else if (token.type != TK_NUMBER) {
-			bool valid = false;
-			if (token.type == TK_IDENTIFIER) {
-				double real = stor_fix(token.value);
-				if (real != -1) {
-					token.type = TK_NUMBER;
-					token.value = real;
-					valid = true;
+		T value;
+		if (is_digit(c)) {
+			// Integers that fit are accumulated directly, anything else goes through String.
+			uint64_t integer = 0;
+			int digits = 0;
+			bool is_float = false;
+			while (is_digit(c)) {
+				integer = integer * 10 + (c - '0');
+				digits++;
+				token_text += c;
+				c = p_stream->get_char();
+			}
+
+			if (c == '.' || c == 'e' || c == 'E') {
+				is_float = true;
+				if (c == '.') {
+					token_text += c;
+					c = p_stream->get_char();
+					while (is_digit(c)) {
+						token_text += c;
+						c = p_stream->get_char();
+					}
 				}
+				if (c == 'e' || c == 'E') {
+					token_text += c;
+					c = p_stream->get_char();
+					if (c == '-' || c == '+') {
+						token_text += c;
+						c = p_stream->get_char();
+					}
+					while (is_digit(c)) {
+						token_text += c;
+						c = p_stream->get_char();
+					}
+				}
+			}
+
+			if (is_float) {
+				value = (T)token_text.as_double();
+			} else if (digits <= 18) {
+				value = (T)(negative ? -(int64_t)integer : (int64_t)integer);
+			} else {
+				value = (T)token_text.as_int();
 			}
-			if (!valid) {
+		} else if (is_ascii_alphabet_char(c) || is_underscore(c)) {
+			// Named values such as `inf` and `nan`, the sign is applied afterwards.
+			StringBuffer<> identifier;
+			while (is_ascii_alphabet_char(c) || is_underscore(c) || is_digit(c)) {
+				identifier += c;
+				c = p_stream->get_char();
+			}
+			double real = stor_fix(identifier.as_string());
+			if (real == -1) {
 				r_err_str = "Expected float in constructor";
 				return ERR_PARSE_ERROR;
 			}
+			value = (T)(negative ? -real : real);
+		} else {
+			r_err_str = "Expected float in constructor";
+			return ERR_PARSE_ERROR;
 		}
 
-		r_construct.push_back(token.value);
-		first = false;
+		r_values.push_back(value);
+
+		p_stream->saved = c;
+		c = _skip_number_list_whitespace(p_stream, line);
+		if (c == ')') {
+			break;
+		} else if (c != ',') {
+			r_err_str = "Expected ',' or ')' in constructor";
+			return ERR_PARSE_ERROR;
+		}
+		c = _skip_number_list_whitespace(p_stream, line);
 	}
 
 	return OK;
 }
 
-Error VariantParser::_parse_byte_array(Stream *p_stream, Vector<uint8_t> &r_construct, int &line, String &r_err_str) {
+template <typename T>
+Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct, int &line, String &r_err_str) {
 	Token token;
 	get_token(p_stream, token, line, r_err_str);
 	if (token.type != TK_PARENTHESIS_OPEN) {
@@ -604,68 +680,69 @@ Error VariantParser::_parse_byte_array(Stream *p_stream, Vector<uint8_t> &r_cons
 		return ERR_PARSE_ERROR;
 	}
 
+	LocalVector<T> values;
+	Error err = _parse_number_list(p_stream, values, line, r_err_str);
+	if (err) {
+		return err;
+	}
+
+	const int64_t base = r_construct.size();
+	r_construct.resize(base + values.size());
+	if (values.size()) {
+		memcpy(r_construct.ptrw() + base, values.ptr(), values.size() * sizeof(T));
+	}
+
+	return OK;
+}
+
+Error VariantParser::_parse_byte_array(Stream *p_stream, Vector<uint8_t> &r_construct, int &line, String &r_err_str) {
+	Token token;
 	get_token(p_stream, token, line, r_err_str);
-	if (token.type == TK_STRING) {
-		// Base64 encoded array.
-		String base64_encoded_string = token.value;
-		int strlen = base64_encoded_string.length();
-		CharString cstr = base64_encoded_string.ascii();
-
-		size_t arr_len = 0;
-		r_construct.resize(strlen / 4 * 3 + 1);
-		uint8_t *w = r_construct.ptrw();
-		Error err = CryptoCore::b64_decode(&w[0], r_construct.size(), &arr_len, (unsigned char *)cstr.get_data(), strlen);
+	if (token.type != TK_PARENTHESIS_OPEN) {
+		r_err_str = "Expected '(' in constructor";
+		return ERR_PARSE_ERROR;
+	}
+
+	// Only a base64 string needs a token, a list of numbers is read directly.
+	const char32_t c = _skip_number_list_whitespace(p_stream, line);
+	p_stream->saved = c;
+	if (c != '"') {
+		LocalVector<uint8_t> values;
+		Error err = _parse_number_list(p_stream, values, line, r_err_str);
 		if (err) {
-			r_err_str = "Invalid base64-encoded string";
-			return ERR_PARSE_ERROR;
+			return err;
 		}
-		r_construct.resize(arr_len);
-
-		get_token(p_stream, token, line, r_err_str);
-		if (token.type != TK_PARENTHESIS_CLOSE) {
-			r_err_str = "Expected ')' in constructor";
-			return ERR_PARSE_ERROR;
+		r_construct.resize(values.size());
+		if (values.size()) {
+			memcpy(r_construct.ptrw(), values.ptr(), values.size());
 		}
+		return OK;
+	}
 
-	} else if (token.type == TK_NUMBER || token.type == TK_IDENTIFIER) {
-		// Individual elements.
-		while (true) {
-			if (token.type != TK_NUMBER) {
-				bool valid = false;
-				if (token.type == TK_IDENTIFIER) {
-					double real = stor_fix(token.value);
-					if (real != -1) {
-						token.type = TK_NUMBER;
-						token.value = real;
-						valid = true;
-					}
-				}
-				if (!valid) {
-					r_err_str = "Expected number in constructor";
-					return ERR_PARSE_ERROR;
-				}
-			}
-
-			r_construct.push_back(token.value);
+	// Base64 encoded array.
+	get_token(p_stream, token, line, r_err_str);
+	if (token.type != TK_STRING) {
+		r_err_str = "Expected base64 string, or list of numbers in constructor";
+		return ERR_PARSE_ERROR;
+	}
 
-			get_token(p_stream, token, line, r_err_str);
+	String base64_encoded_string = token.value;
+	int strlen = base64_encoded_string.length();
+	CharString cstr = base64_encoded_string.ascii();
 
-			if (token.type == TK_COMMA) {
-				//do none
-			} else if (token.type == TK_PARENTHESIS_CLOSE) {
-				break;
-			} else {
-				r_err_str = "Expected ',' or ')' in constructor";
-				return ERR_PARSE_ERROR;
-			}
+	size_t arr_len = 0;
+	r_construct.resize(strlen / 4 * 3 + 1);
+	uint8_t *w = r_construct.ptrw();
+	Error err = CryptoCore::b64_decode(&w[0], r_construct.size(), &arr_len, (unsigned char *)cstr.get_data(), strlen);
+	if (err) {
+		r_err_str = "Invalid base64-encoded string";
+		return ERR_PARSE_ERROR;
+	}
+	r_construct.resize(arr_len);
 
-			get_token(p_stream, token, line, r_err_str);
-		}
-	} else if (token.type == TK_PARENTHESIS_CLOSE) {
-		// Empty array.
-		return OK;
-	} else {
-		r_err_str = "Expected base64 string, or list of numbers in constructor";
+	get_token(p_stream, token, line, r_err_str);
+	if (token.type != TK_PARENTHESIS_CLOSE) {
+		r_err_str = "Expected ')' in constructor";
 		return ERR_PARSE_ERROR;
 	}
 
@@ -1365,94 +1442,44 @@ Error VariantParser::parse_value(Token &token, Variant &value, Stream *p_stream,
 
 			value = array;
 		} else if (id == "PackedByteArray" || id == "PoolByteArray" || id == "ByteArray") {
-			Vector<uint8_t> args;
-			Error err = _parse_byte_array(p_stream, args, line, r_err_str);
+			Vector<uint8_t> arr;
+			Error err = _parse_byte_array(p_stream, arr, line, r_err_str);
 			if (err) {
 				return err;
 			}
 
-			Vector<uint8_t> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				uint8_t *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
 			value = arr;
 		} else if (id == "PackedInt32Array" || id == "PackedIntArray" || id == "PoolIntArray" || id == "IntArray") {
-			Vector<int32_t> args;
-			Error err = _parse_construct<int32_t>(p_stream, args, line, r_err_str);
+			Vector<int32_t> arr;
+			Error err = _parse_construct<int32_t>(p_stream, arr, line, r_err_str);
 			if (err) {
 				return err;
 			}
 
-			Vector<int32_t> arr;
-			{
-				int32_t len = args.size();
-				arr.resize(len);
-				int32_t *w = arr.ptrw();
-				for (int32_t i = 0; i < len; i++) {
-					w[i] = int32_t(args[i]);
-				}
-			}
-
 			value = arr;
 		} else if (id == "PackedInt64Array") {
-			Vector<int64_t> args;
-			Error err = _parse_construct<int64_t>(p_stream, args, line, r_err_str);
+			Vector<int64_t> arr;
+			Error err = _parse_construct<int64_t>(p_stream, arr, line, r_err_str);
 			if (err) {
 				return err;
 			}
 
-			Vector<int64_t> arr;
-			{
-				int64_t len = args.size();
-				arr.resize(len);
-				int64_t *w = arr.ptrw();
-				for (int64_t i = 0; i < len; i++) {
-					w[i] = int64_t(args[i]);
-				}
-			}
-
 			value = arr;
 		} else if (id == "PackedFloat32Array" || id == "PackedRealArray" || id == "PoolRealArray" || id == "FloatArray") {
-			Vector<float> args;
-			Error err = _parse_construct<float>(p_stream, args, line, r_err_str);
+			Vector<float> arr;
+			Error err = _parse_construct<float>(p_stream, arr, line, r_err_str);
 			if (err) {
 				return err;
 			}
 
-			Vector<float> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				float *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
 			value = arr;
 		} else if (id == "PackedFloat64Array") {
-			Vector<double> args;
-			Error err = _parse_construct<double>(p_stream, args, line, r_err_str);
+			Vector<double> arr;
+			Error err = _parse_construct<double>(p_stream, arr, line, r_err_str);
 			if (err) {
 				return err;
 			}
 
-			Vector<double> arr;
-			{
-				int len = args.size();
-				arr.resize(len);
-				double *w = arr.ptrw();
-				for (int i = 0; i < len; i++) {
-					w[i] = args[i];
-				}
-			}
-
 			value = arr;
 		} else if (id == "PackedStringArray" || id == "PoolStringArray" || id == "StringArray") {
 			get_token(p_stream, token, line, r_err_str);
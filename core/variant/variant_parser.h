@@ -32,6 +32,7 @@
 
 #include "core/io/file_access.h"
 #include "core/io/resource.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/variant.h"
 
 class VariantParser {
@@ -44,6 +45,8 @@ public:
 		uint32_t readahead_filled = 0;
 		bool eof = false;
 
+		char32_t _refill_and_get_char();
+
 	protected:
 		bool readahead_enabled = true;
 		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars) = 0;
@@ -52,7 +55,13 @@ public:
 	public:
 		char32_t saved = 0;
 
-		char32_t get_char();
+		_FORCE_INLINE_ char32_t get_char() {
+			// Most characters come straight from the readahead buffer.
+			if (likely(readahead_pointer < readahead_filled)) {
+				return readahead_buffer[readahead_pointer++];
+			}
+			return _refill_and_get_char();
+		}
 		virtual bool is_utf8() const = 0;
 		bool is_eof() const;
 
@@ -138,6 +147,8 @@ public:
 private:
 	static const char *tk_name[TK_MAX];
 
+	template <typename T>
+	static Error _parse_number_list(Stream *p_stream, LocalVector<T> &r_values, int &line, String &r_err_str);
 	template <typename T>
 	static Error _parse_construct(Stream *p_stream, Vector<T> &r_construct, int &line, String &r_err_str);
 	static Error _parse_byte_array(Stream *p_stream, Vector<uint8_t> &r_construct, int &line, String &r_err_str);
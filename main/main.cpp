@@ -34,6 +34,7 @@
 #include "core/core_globals.h"
 #include "core/crypto/crypto.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/frame_trace.h"
 #include "core/extension/extension_api_dump.h"
 #include "core/extension/gdextension_interface_dump.gen.h"
 #include "core/extension/gdextension_manager.h"
@@ -274,6 +275,7 @@ static int fixed_fps = -1;
 static MovieWriter *movie_writer = nullptr;
 static bool disable_vsync = false;
 static bool print_fps = false;
+static String frame_trace_path;
 #ifdef TOOLS_ENABLED
 static bool editor_pseudolocalization = false;
 static bool dump_gdextension_interface = false;
@@ -657,6 +659,7 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--fixed-fps <fps>", "Force a fixed number of frames per second. This setting disables real-time synchronization.\n");
 	print_help_option("--delta-smoothing <enable>", "Enable or disable frame delta smoothing [\"enable\", \"disable\"].\n");
 	print_help_option("--print-fps", "Print the frames per second to the stdout.\n");
+	print_help_option("--frame-trace <file>", "Record main loop phase timings and save them as a Chrome trace JSON file on exit.\n");
 #ifdef TOOLS_ENABLED
 	print_help_option("--editor-pseudolocalization", "Enable pseudolocalization for the editor and the project manager.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 #endif
@@ -1798,6 +1801,15 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			disable_vsync = true;
 		} else if (arg == "--print-fps") {
 			print_fps = true;
+		} else if (arg == "--frame-trace") {
+			if (N) {
+				frame_trace_path = N->get();
+				FrameTrace::set_enabled(true);
+				N = N->next();
+			} else {
+				OS::get_singleton()->print("Missing frame-trace argument, aborting.\n");
+				goto error;
+			}
 #ifdef TOOLS_ENABLED
 		} else if (arg == "--editor-pseudolocalization") {
 			editor_pseudolocalization = true;
@@ -4622,6 +4634,8 @@ static uint64_t navigation_process_max = 0;
 // will terminate the program. In case of failure, the OS exit code needs
 // to be set explicitly here (defaults to EXIT_SUCCESS).
 bool Main::iteration() {
+	FRAME_TRACE_SCOPE("Main::iteration");
+
 	iterating++;
 
 	const uint64_t ticks = OS::get_singleton()->get_ticks_usec();
@@ -4667,6 +4681,8 @@ bool Main::iteration() {
 #endif // XR_DISABLED
 
 	for (int iters = 0; iters < advance.physics_steps; ++iters) {
+		FRAME_TRACE_SCOPE("Main::physics_step");
+
 		if (Input::get_singleton()->is_agile_input_event_flushing()) {
 			Input::get_singleton()->flush_buffered_events();
 		}
@@ -4682,13 +4698,19 @@ bool Main::iteration() {
 		OS::get_singleton()->get_main_loop()->iteration_prepare();
 
 #ifndef PHYSICS_3D_DISABLED
-		PhysicsServer3D::get_singleton()->sync();
-		PhysicsServer3D::get_singleton()->flush_queries();
+		{
+			FRAME_TRACE_SCOPE("PhysicsServer3D::sync");
+			PhysicsServer3D::get_singleton()->sync();
+			PhysicsServer3D::get_singleton()->flush_queries();
+		}
 #endif // PHYSICS_3D_DISABLED
 
 #ifndef PHYSICS_2D_DISABLED
-		PhysicsServer2D::get_singleton()->sync();
-		PhysicsServer2D::get_singleton()->flush_queries();
+		{
+			FRAME_TRACE_SCOPE("PhysicsServer2D::sync");
+			PhysicsServer2D::get_singleton()->sync();
+			PhysicsServer2D::get_singleton()->flush_queries();
+		}
 #endif // PHYSICS_2D_DISABLED
 
 		if (OS::get_singleton()->get_main_loop()->physics_process(physics_step * time_scale)) {
@@ -4707,12 +4729,15 @@ bool Main::iteration() {
 #if !defined(NAVIGATION_2D_DISABLED) || !defined(NAVIGATION_3D_DISABLED)
 		uint64_t navigation_begin = OS::get_singleton()->get_ticks_usec();
 
+		{
+			FRAME_TRACE_SCOPE("NavigationServer::physics_process");
 #ifndef NAVIGATION_2D_DISABLED
-		NavigationServer2D::get_singleton()->physics_process(physics_step * time_scale);
+			NavigationServer2D::get_singleton()->physics_process(physics_step * time_scale);
 #endif // NAVIGATION_2D_DISABLED
 #ifndef NAVIGATION_3D_DISABLED
-		NavigationServer3D::get_singleton()->physics_process(physics_step * time_scale);
+			NavigationServer3D::get_singleton()->physics_process(physics_step * time_scale);
 #endif // NAVIGATION_3D_DISABLED
+		}
 
 		navigation_process_ticks = MAX(navigation_process_ticks, OS::get_singleton()->get_ticks_usec() - navigation_begin); // keep the largest one for reference
 		navigation_process_max = MAX(OS::get_singleton()->get_ticks_usec() - navigation_begin, navigation_process_max);
@@ -4721,13 +4746,19 @@ bool Main::iteration() {
 #endif // !defined(NAVIGATION_2D_DISABLED) || !defined(NAVIGATION_3D_DISABLED)
 
 #ifndef PHYSICS_3D_DISABLED
-		PhysicsServer3D::get_singleton()->end_sync();
-		PhysicsServer3D::get_singleton()->step(physics_step * time_scale);
+		{
+			FRAME_TRACE_SCOPE("PhysicsServer3D::step");
+			PhysicsServer3D::get_singleton()->end_sync();
+			PhysicsServer3D::get_singleton()->step(physics_step * time_scale);
+		}
 #endif // PHYSICS_3D_DISABLED
 
 #ifndef PHYSICS_2D_DISABLED
-		PhysicsServer2D::get_singleton()->end_sync();
-		PhysicsServer2D::get_singleton()->step(physics_step * time_scale);
+		{
+			FRAME_TRACE_SCOPE("PhysicsServer2D::step");
+			PhysicsServer2D::get_singleton()->end_sync();
+			PhysicsServer2D::get_singleton()->step(physics_step * time_scale);
+		}
 #endif // PHYSICS_2D_DISABLED
 
 		message_queue->flush();
@@ -4751,14 +4782,20 @@ bool Main::iteration() {
 	}
 	message_queue->flush();
 
+	{
+		FRAME_TRACE_SCOPE("NavigationServer::process");
 #ifndef NAVIGATION_2D_DISABLED
-	NavigationServer2D::get_singleton()->process(process_step * time_scale);
+		NavigationServer2D::get_singleton()->process(process_step * time_scale);
 #endif // NAVIGATION_2D_DISABLED
 #ifndef NAVIGATION_3D_DISABLED
-	NavigationServer3D::get_singleton()->process(process_step * time_scale);
+		NavigationServer3D::get_singleton()->process(process_step * time_scale);
 #endif // NAVIGATION_3D_DISABLED
+	}
 
-	RenderingServer::get_singleton()->sync(); //sync if still drawing from previous frames.
+	{
+		FRAME_TRACE_SCOPE("RenderingServer::sync");
+		RenderingServer::get_singleton()->sync(); //sync if still drawing from previous frames.
+	}
 
 	const bool has_pending_resources_for_processing = RD::get_singleton() && RD::get_singleton()->has_pending_resources_for_processing();
 	bool wants_present = (DisplayServer::get_singleton()->can_any_window_draw() ||
@@ -4766,6 +4803,8 @@ bool Main::iteration() {
 			RenderingServer::get_singleton()->is_render_loop_enabled();
 
 	if (wants_present || has_pending_resources_for_processing) {
+		FRAME_TRACE_SCOPE("RenderingServer::draw");
+
 		wants_present |= force_redraw_requested;
 		if ((!force_redraw_requested) && OS::get_singleton()->is_in_low_processor_usage_mode()) {
 			if (RenderingServer::get_singleton()->has_changed()) {
@@ -4787,7 +4826,10 @@ bool Main::iteration() {
 		ScriptServer::get_language(i)->frame();
 	}
 
-	AudioServer::get_singleton()->update();
+	{
+		FRAME_TRACE_SCOPE("AudioServer::update");
+		AudioServer::get_singleton()->update();
+	}
 
 	if (EngineDebugger::is_active()) {
 		EngineDebugger::get_singleton()->iteration(frame_time, process_ticks, physics_process_ticks, physics_step);
@@ -4911,6 +4953,13 @@ void Main::cleanup(bool p_force) {
 		movie_writer->end();
 	}
 
+	if (!frame_trace_path.is_empty()) {
+		FrameTrace::set_enabled(false);
+		FrameTrace::save_chrome_trace(frame_trace_path);
+		frame_trace_path = String();
+	}
+	FrameTrace::finalize();
+
 	ResourceLoader::clear_thread_load_tasks();
 
 	ResourceLoader::remove_custom_loaders();
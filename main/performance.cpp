@@ -30,6 +30,7 @@
 
 #include "performance.h"
 
+#include "core/debugger/frame_trace.h"
 #include "core/os/os.h"
 #include "core/variant/typed_array.h"
 #include "scene/main/node.h"
@@ -62,6 +63,12 @@ void Performance::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_monitor_modification_time"), &Performance::get_monitor_modification_time);
 	ClassDB::bind_method(D_METHOD("get_custom_monitor_names"), &Performance::get_custom_monitor_names);
 
+	ClassDB::bind_method(D_METHOD("set_frame_trace_enabled", "enabled"), &Performance::set_frame_trace_enabled);
+	ClassDB::bind_method(D_METHOD("is_frame_trace_enabled"), &Performance::is_frame_trace_enabled);
+	ClassDB::bind_method(D_METHOD("clear_frame_trace"), &Performance::clear_frame_trace);
+	ClassDB::bind_method(D_METHOD("get_frame_trace_json"), &Performance::get_frame_trace_json);
+	ClassDB::bind_method(D_METHOD("save_frame_trace", "path"), &Performance::save_frame_trace);
+
 	BIND_ENUM_CONSTANT(TIME_FPS);
 	BIND_ENUM_CONSTANT(TIME_PROCESS);
 	BIND_ENUM_CONSTANT(TIME_PHYSICS_PROCESS);
@@ -561,6 +568,26 @@ TypedArray<StringName> Performance::get_custom_monitor_names() {
 	return return_array;
 }
 
+void Performance::set_frame_trace_enabled(bool p_enabled) {
+	FrameTrace::set_enabled(p_enabled);
+}
+
+bool Performance::is_frame_trace_enabled() const {
+	return FrameTrace::is_enabled();
+}
+
+void Performance::clear_frame_trace() {
+	FrameTrace::clear();
+}
+
+String Performance::get_frame_trace_json() const {
+	return FrameTrace::to_chrome_trace_json();
+}
+
+Error Performance::save_frame_trace(const String &p_path) const {
+	return FrameTrace::save_chrome_trace(p_path);
+}
+
 uint64_t Performance::get_monitor_modification_time() {
 	return _monitor_modification_time;
 }
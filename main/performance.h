@@ -149,6 +149,12 @@ public:
 	Variant get_custom_monitor(const StringName &p_id);
 	TypedArray<StringName> get_custom_monitor_names();
 
+	void set_frame_trace_enabled(bool p_enabled);
+	bool is_frame_trace_enabled() const;
+	void clear_frame_trace();
+	String get_frame_trace_json() const;
+	Error save_frame_trace(const String &p_path) const;
+
 	uint64_t get_monitor_modification_time();
 
 	static Performance *get_singleton() { return singleton; }
@@ -71,6 +71,7 @@ private:
 	uint32_t collision_layer = 1;
 	real_t collision_priority = 1.0;
 	bool _static = true;
+	uint32_t space_order = 0;
 
 	SelfList<GodotCollisionObject2D> pending_shape_update_list;
 
@@ -107,6 +108,11 @@ public:
 	void _shape_changed() override;
 
 	_FORCE_INLINE_ Type get_type() const { return type; }
+
+	// Order in which the object was added to its space, which unlike pointers and RIDs
+	// is the same on every run that adds objects in the same order.
+	_FORCE_INLINE_ void set_space_order(uint32_t p_order) { space_order = p_order; }
+	_FORCE_INLINE_ uint32_t get_space_order() const { return space_order; }
 	void add_shape(GodotShape2D *p_shape, const Transform2D &p_transform = Transform2D(), bool p_disabled = false);
 	void set_shape(int p_index, GodotShape2D *p_shape);
 	void set_shape_transform(int p_index, const Transform2D &p_transform);
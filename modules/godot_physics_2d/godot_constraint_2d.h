@@ -47,6 +47,50 @@ protected:
 	}
 
 public:
+	// Identifies the constraint independently of memory addresses and of the order pairs were found in,
+	// used to sort islands in deterministic mode.
+	struct SortKey {
+		uint64_t objects = 0;
+		uint64_t detail = 0;
+
+		_FORCE_INLINE_ bool operator<(const SortKey &p_other) const {
+			return objects == p_other.objects ? detail < p_other.detail : objects < p_other.objects;
+		}
+	};
+
+	static SortKey make_pair_sort_key(const GodotCollisionObject2D *p_a, int p_shape_a, const GodotCollisionObject2D *p_b, int p_shape_b) {
+		if (p_a->get_space_order() > p_b->get_space_order()) {
+			SWAP(p_a, p_b);
+			SWAP(p_shape_a, p_shape_b);
+		}
+		SortKey key;
+		key.objects = (uint64_t(p_a->get_space_order()) << 32) | p_b->get_space_order();
+		key.detail = (uint64_t(uint32_t(p_shape_a)) << 32) | uint32_t(p_shape_b);
+		return key;
+	}
+
+	// Joints are ordered by their bodies, whichever one is first, then by their settings.
+	// RIDs depend on unrelated allocations, so they can't tell joints between the same bodies apart.
+	virtual SortKey get_sort_key() const {
+		uint32_t orders[2] = { 0, 0 };
+		for (int i = 0; i < MIN(_body_count, 2); i++) {
+			if (_body_ptr[i]) {
+				orders[i] = _body_ptr[i]->get_space_order();
+			}
+		}
+		const bool swapped = _body_count > 1 && orders[0] > orders[1];
+		if (swapped) {
+			SWAP(orders[0], orders[1]);
+		}
+		SortKey key;
+		key.objects = (uint64_t(orders[0]) << 32) | orders[1];
+		key.detail = get_sort_detail(swapped);
+		return key;
+	}
+
+	// Tells constraints between the same bodies apart, from settings that don't change between runs.
+	virtual uint64_t get_sort_detail(bool p_swapped) const { return p_swapped ? 1 : 0; }
+
 	_FORCE_INLINE_ void set_self(const RID &p_self) { self = p_self; }
 	_FORCE_INLINE_ RID get_self() const { return self; }
 
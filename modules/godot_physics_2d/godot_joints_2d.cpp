@@ -55,6 +55,18 @@
  * SOFTWARE.
  */
 
+uint64_t GodotJoint2D::_make_sort_detail(bool p_swapped, const Vector2 &p_anchor_a, const Vector2 &p_anchor_b, const Vector2 &p_anchor_c) const {
+	// Anchors are local to the bodies, so they are the same in every run.
+	uint32_t hash = hash_murmur3_one_32(p_swapped);
+	hash = hash_murmur3_one_real(p_anchor_a.x, hash);
+	hash = hash_murmur3_one_real(p_anchor_a.y, hash);
+	hash = hash_murmur3_one_real(p_anchor_b.x, hash);
+	hash = hash_murmur3_one_real(p_anchor_b.y, hash);
+	hash = hash_murmur3_one_real(p_anchor_c.x, hash);
+	hash = hash_murmur3_one_real(p_anchor_c.y, hash);
+	return (uint64_t(get_type()) << 32) | hash_fmix32(hash);
+}
+
 void GodotJoint2D::copy_settings_from(GodotJoint2D *p_joint) {
 	set_self(p_joint->get_self());
 	set_max_force(p_joint->get_max_force());
@@ -42,6 +42,8 @@ protected:
 	bool dynamic_A = false;
 	bool dynamic_B = false;
 
+	uint64_t _make_sort_detail(bool p_swapped, const Vector2 &p_anchor_a, const Vector2 &p_anchor_b, const Vector2 &p_anchor_c = Vector2()) const;
+
 public:
 	_FORCE_INLINE_ void set_max_force(real_t p_force) { max_force = p_force; }
 	_FORCE_INLINE_ real_t get_max_force() const { return max_force; }
@@ -103,6 +105,7 @@ class GodotPinJoint2D : public GodotJoint2D {
 
 public:
 	virtual PhysicsServer2D::JointType get_type() const override { return PhysicsServer2D::JOINT_TYPE_PIN; }
+	virtual uint64_t get_sort_detail(bool p_swapped) const override { return _make_sort_detail(p_swapped, anchor_A, anchor_B); }
 
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
@@ -143,6 +146,7 @@ class GodotGrooveJoint2D : public GodotJoint2D {
 
 public:
 	virtual PhysicsServer2D::JointType get_type() const override { return PhysicsServer2D::JOINT_TYPE_GROOVE; }
+	virtual uint64_t get_sort_detail(bool p_swapped) const override { return _make_sort_detail(p_swapped, A_groove_1, A_groove_2, B_anchor); }
 
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
@@ -177,6 +181,7 @@ class GodotDampedSpringJoint2D : public GodotJoint2D {
 
 public:
 	virtual PhysicsServer2D::JointType get_type() const override { return PhysicsServer2D::JOINT_TYPE_DAMPED_SPRING; }
+	virtual uint64_t get_sort_detail(bool p_swapped) const override { return _make_sort_detail(p_swapped, anchor_A, anchor_B); }
 
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
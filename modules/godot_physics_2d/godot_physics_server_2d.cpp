@@ -276,6 +276,18 @@ int GodotPhysicsServer2D::space_get_contact_count(RID p_space) const {
 	return space->get_debug_contact_count();
 }
 
+uint64_t GodotPhysicsServer2D::space_get_state_hash(RID p_space) const {
+	GodotSpace2D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, 0);
+	return space->get_state_hash();
+}
+
+void GodotPhysicsServer2D::set_step_max_tasks(int p_max_tasks) {
+	ERR_FAIL_NULL(stepper);
+	ERR_FAIL_COND(p_max_tasks == 0 || p_max_tasks < -1);
+	stepper->set_max_tasks(p_max_tasks);
+}
+
 PhysicsDirectSpaceState2D *GodotPhysicsServer2D::space_get_direct_state(RID p_space) {
 	GodotSpace2D *space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL_V(space, nullptr);
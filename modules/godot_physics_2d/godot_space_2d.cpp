@@ -1078,6 +1078,7 @@ GodotBroadPhase2D *GodotSpace2D::get_broadphase() {
 void GodotSpace2D::add_object(GodotCollisionObject2D *p_object) {
 	ERR_FAIL_COND(objects.has(p_object));
 	objects.insert(p_object);
+	p_object->set_space_order(object_order++);
 }
 
 void GodotSpace2D::remove_object(GodotCollisionObject2D *p_object) {
@@ -1089,6 +1090,57 @@ const HashSet<GodotCollisionObject2D *> &GodotSpace2D::get_objects() const {
 	return objects;
 }
 
+struct GodotCollisionObject2DSpaceOrderSort {
+	_FORCE_INLINE_ bool operator()(const GodotCollisionObject2D *p_a, const GodotCollisionObject2D *p_b) const {
+		return p_a->get_space_order() < p_b->get_space_order();
+	}
+};
+
+static _FORCE_INLINE_ uint64_t _hash_real_bits(real_t p_value, uint64_t p_hash) {
+	// Hash the exact bits, any difference in the simulation state counts.
+#ifdef REAL_T_IS_DOUBLE
+	uint64_t bits;
+#else
+	uint32_t bits;
+#endif
+	memcpy(&bits, &p_value, sizeof(bits));
+	return hash64_murmur3_64(bits, p_hash);
+}
+
+static _FORCE_INLINE_ uint64_t _hash_vector2_bits(const Vector2 &p_value, uint64_t p_hash) {
+	return _hash_real_bits(p_value.y, _hash_real_bits(p_value.x, p_hash));
+}
+
+uint64_t GodotSpace2D::get_state_hash() const {
+	LocalVector<const GodotCollisionObject2D *> sorted_objects;
+	sorted_objects.reserve(objects.size());
+	for (const GodotCollisionObject2D *E : objects) {
+		sorted_objects.push_back(E);
+	}
+	sorted_objects.sort_custom<GodotCollisionObject2DSpaceOrderSort>();
+
+	uint64_t hash = HASH_MURMUR3_SEED;
+	for (const GodotCollisionObject2D *object : sorted_objects) {
+		hash = hash64_murmur3_64(object->get_space_order(), hash);
+		hash = hash64_murmur3_64(object->get_type(), hash);
+
+		const Transform2D &transform = object->get_transform();
+		hash = _hash_vector2_bits(transform.columns[0], hash);
+		hash = _hash_vector2_bits(transform.columns[1], hash);
+		hash = _hash_vector2_bits(transform.columns[2], hash);
+
+		if (object->get_type() == GodotCollisionObject2D::TYPE_BODY) {
+			const GodotBody2D *body = static_cast<const GodotBody2D *>(object);
+			hash = hash64_murmur3_64(body->get_mode(), hash);
+			hash = hash64_murmur3_64(body->is_active(), hash);
+			hash = _hash_vector2_bits(body->get_linear_velocity(), hash);
+			hash = _hash_real_bits(body->get_angular_velocity(), hash);
+		}
+	}
+
+	return hash;
+}
+
 void GodotSpace2D::body_add_to_state_query_list(SelfList<GodotBody2D> *p_body) {
 	state_query_list.add(p_body);
 }
@@ -1226,6 +1278,7 @@ GodotSpace2D::GodotSpace2D() {
 	contact_max_allowed_penetration = GLOBAL_GET("physics/2d/solver/contact_max_allowed_penetration");
 	contact_bias = GLOBAL_GET("physics/2d/solver/default_contact_bias");
 	constraint_bias = GLOBAL_GET("physics/2d/solver/default_constraint_bias");
+	deterministic = GLOBAL_GET("physics/2d/solver/deterministic");
 
 	broadphase = GodotBroadPhase2D::create_func();
 	broadphase->set_pair_callback(_broadphase_pair, this);
@@ -88,6 +88,8 @@ private:
 	static void _broadphase_unpair(GodotCollisionObject2D *A, int p_subindex_A, GodotCollisionObject2D *B, int p_subindex_B, void *p_data, void *p_self);
 
 	HashSet<GodotCollisionObject2D *> objects;
+	uint32_t object_order = 0;
+	bool deterministic = false;
 
 	GodotArea2D *area = nullptr;
 
@@ -153,6 +155,9 @@ public:
 	void remove_object(GodotCollisionObject2D *p_object);
 	const HashSet<GodotCollisionObject2D *> &get_objects() const;
 
+	_FORCE_INLINE_ bool is_deterministic() const { return deterministic; }
+	uint64_t get_state_hash() const;
+
 	_FORCE_INLINE_ int get_solver_iterations() const { return solver_iterations; }
 	_FORCE_INLINE_ real_t get_contact_recycle_radius() const { return contact_recycle_radius; }
 	_FORCE_INLINE_ real_t get_contact_max_separation() const { return contact_max_separation; }
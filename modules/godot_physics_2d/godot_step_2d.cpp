@@ -32,6 +32,7 @@
 
 #include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
+#include "core/templates/sort_array.h"
 #include "godot_constraint_2d.h"
 
 #define BODY_ISLAND_COUNT_RESERVE 128
@@ -102,6 +103,36 @@ void GodotStep2D::_solve_island(uint32_t p_island_index, void *p_userdata) const
 	}
 }
 
+struct GodotConstraint2DSortKeySort {
+	_FORCE_INLINE_ bool operator()(const GodotConstraint2D *p_a, const GodotConstraint2D *p_b) const {
+		return p_a->get_sort_key() < p_b->get_sort_key();
+	}
+};
+
+struct GodotStep2DIslandSort {
+	const LocalVector<LocalVector<GodotConstraint2D *>> *islands = nullptr;
+
+	_FORCE_INLINE_ bool operator()(uint32_t p_a, uint32_t p_b) const {
+		// Islands are disjoint and sorted, so their first keys differ.
+		return (*islands)[p_a][0]->get_sort_key() < (*islands)[p_b][0]->get_sort_key();
+	}
+};
+
+void GodotStep2D::_sort_islands(uint32_t p_island_count) {
+	// The order constraints are found in depends on which body was activated first and on the order
+	// the broadphase reported the pairs in. Sorting by keys derived from the order objects were added
+	// to the space makes the pre-solve and solve order, and so the results, independent of both.
+	island_order.resize(p_island_count);
+	for (uint32_t island_index = 0; island_index < p_island_count; ++island_index) {
+		constraint_islands[island_index].sort_custom<GodotConstraint2DSortKeySort>();
+		island_order[island_index] = island_index;
+	}
+
+	SortArray<uint32_t, GodotStep2DIslandSort> sorter;
+	sorter.compare.islands = &constraint_islands;
+	sorter.sort(island_order.ptr(), p_island_count);
+}
+
 void GodotStep2D::_check_suspend(LocalVector<GodotBody2D *> &p_body_island) const {
 	bool can_sleep = true;
 
@@ -232,6 +263,11 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	p_space->set_island_count((int)island_count);
 
+	const bool deterministic = p_space->is_deterministic();
+	if (deterministic) {
+		_sort_islands(island_count);
+	}
+
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
 		p_space->set_elapsed_time(GodotSpace2D::ELAPSED_TIME_GENERATE_ISLANDS, profile_endtime - profile_begtime);
@@ -241,7 +277,7 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics2DConstraintSetup"));
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_setup_constraint, nullptr, total_constraint_count, max_tasks, true, SNAME("Physics2DConstraintSetup"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -253,15 +289,16 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	/* PRE-SOLVE CONSTRAINT ISLANDS */
 
 	// WARNING: This doesn't run on threads, because it involves thread-unsafe processing.
+	// Islands are solved independently of each other, so only the pre-solve order matters for determinism.
 	for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
-		_pre_solve_island(constraint_islands[island_index]);
+		_pre_solve_island(constraint_islands[deterministic ? island_order[island_index] : island_index]);
 	}
 
 	/* SOLVE CONSTRAINT ISLANDS */
 
 	// WARNING: `_solve_island` modifies the constraint islands for optimization purpose,
 	// their content is not reliable after these calls and shouldn't be used anymore.
-	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics2DConstraintSolveIslands"));
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_solve_island, nullptr, island_count, max_tasks, true, SNAME("Physics2DConstraintSolveIslands"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -43,14 +43,20 @@ class GodotStep2D {
 	LocalVector<LocalVector<GodotBody2D *>> body_islands;
 	LocalVector<LocalVector<GodotConstraint2D *>> constraint_islands;
 	LocalVector<GodotConstraint2D *> all_constraints;
+	LocalVector<uint32_t> island_order; // Pre-solve order of the islands in deterministic mode.
+	int max_tasks = -1; // Worker thread tasks per group, -1 uses every worker thread.
 
 	void _populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D *> &p_body_island, LocalVector<GodotConstraint2D *> &p_constraint_island);
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
 	void _pre_solve_island(LocalVector<GodotConstraint2D *> &p_constraint_island) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr) const;
 	void _check_suspend(LocalVector<GodotBody2D *> &p_body_island) const;
+	void _sort_islands(uint32_t p_island_count);
 
 public:
+	void set_max_tasks(int p_max_tasks) { max_tasks = p_max_tasks; }
+	int get_max_tasks() const { return max_tasks; }
+
 	void step(GodotSpace2D *p_space, real_t p_delta);
 	GodotStep2D();
 	~GodotStep2D();
@@ -0,0 +1,203 @@
+/**************************************************************************/
+/*  test_godot_space_2d.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../godot_physics_server_2d.h"
+
+#include "core/config/project_settings.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotSpace2D {
+
+struct Scene {
+	RID space;
+	LocalVector<RID> bodies;
+	LocalVector<RID> joints;
+};
+
+// Pyramids of boxes resting on a static floor, so islands, contacts, joints and sleeping all take part.
+// Unrelated objects in another space shift RIDs and allocations, which must not affect the result.
+static Scene create_scene(PhysicsServer2D *p_server, RID p_shape, bool p_interleave_unrelated, int p_pyramid_count = 1) {
+	Scene scene;
+	scene.space = p_server->space_create();
+	p_server->space_set_active(scene.space, true);
+	p_server->area_set_param(scene.space, PhysicsServer2D::AREA_PARAM_GRAVITY, 980.0);
+	p_server->area_set_param(scene.space, PhysicsServer2D::AREA_PARAM_GRAVITY_VECTOR, Vector2(0.0, 1.0));
+
+	RID unrelated_space = p_server->space_create();
+
+	RID floor = p_server->body_create();
+	p_server->body_set_mode(floor, PhysicsServer2D::BODY_MODE_STATIC);
+	p_server->body_add_shape(floor, p_shape, Transform2D(0.0, Vector2(40.0, 1.0), 0.0, Vector2()));
+	p_server->body_set_state(floor, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0.0, Vector2(0.0, 100.0)));
+	p_server->body_set_space(floor, scene.space);
+	scene.bodies.push_back(floor);
+
+	for (int pyramid = 0; pyramid < p_pyramid_count; pyramid++) {
+		const real_t offset = (pyramid - (p_pyramid_count - 1) * 0.5) * 150.0;
+		LocalVector<RID> bottom_row;
+		for (int row = 0; row < 6; row++) {
+			for (int column = 0; column < 6 - row; column++) {
+				if (p_interleave_unrelated) {
+					RID unrelated = p_server->body_create();
+					p_server->body_set_space(unrelated, unrelated_space);
+					scene.bodies.push_back(unrelated);
+				}
+
+				RID box = p_server->body_create();
+				p_server->body_set_mode(box, PhysicsServer2D::BODY_MODE_RIGID);
+				p_server->body_add_shape(box, p_shape);
+				const Vector2 position(offset + (column - (6 - row) * 0.5) * 21.0, 70.0 - row * 21.0);
+				p_server->body_set_state(box, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0.0, position));
+				p_server->body_set_space(box, scene.space);
+				scene.bodies.push_back(box);
+				if (row == 0) {
+					bottom_row.push_back(box);
+				}
+			}
+		}
+
+		// Two joints between the same bodies, which only their settings tell apart.
+		for (int i = 0; i < 2; i++) {
+			RID joint = p_server->joint_create();
+			p_server->joint_make_pin(joint, Vector2(offset - 52.5, 65.0 + i * 10.0), bottom_row[0], bottom_row[1]);
+			scene.joints.push_back(joint);
+		}
+	}
+
+	// Keep the unrelated space alive until the scene is freed.
+	scene.bodies.push_back(unrelated_space);
+	return scene;
+}
+
+static void free_scene(PhysicsServer2D *p_server, const Scene &p_scene) {
+	for (const RID &rid : p_scene.joints) {
+		p_server->free(rid);
+	}
+	for (const RID &rid : p_scene.bodies) {
+		p_server->free(rid);
+	}
+	p_server->free(p_scene.space);
+}
+
+TEST_CASE("[Modules][GodotPhysics2D] Deterministic spaces give reproducible state hashes") {
+	ProjectSettings *project_settings = ProjectSettings::get_singleton();
+	GodotPhysicsServer2D *server = memnew(GodotPhysicsServer2D);
+	server->init();
+	server->set_active(true);
+
+	const Variant previous_deterministic = project_settings->get_setting("physics/2d/solver/deterministic");
+	project_settings->set_setting("physics/2d/solver/deterministic", true);
+
+	RID shape = server->rectangle_shape_create();
+	server->shape_set_data(shape, Vector2(10.0, 10.0));
+
+	Scene scene_a = create_scene(server, shape, false);
+	Scene scene_b = create_scene(server, shape, true);
+
+	const uint64_t initial_hash = server->space_get_state_hash(scene_a.space);
+	CHECK_MESSAGE(
+			initial_hash == server->space_get_state_hash(scene_b.space),
+			"Identical scenes should hash identically, regardless of their RIDs.");
+
+	int diverged_step = -1;
+	for (int i = 0; i < 120 && diverged_step == -1; i++) {
+		server->step(1.0 / 60.0);
+		server->flush_queries();
+		if (server->space_get_state_hash(scene_a.space) != server->space_get_state_hash(scene_b.space)) {
+			diverged_step = i;
+		}
+	}
+	CHECK_MESSAGE(diverged_step == -1, "Identical scenes should simulate identically.");
+
+	CHECK_MESSAGE(
+			server->space_get_state_hash(scene_a.space) != initial_hash,
+			"The hash should change as bodies move.");
+
+	server->body_set_state(scene_a.bodies[1], PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, Vector2(1.0, 0.0));
+	CHECK_MESSAGE(
+			server->space_get_state_hash(scene_a.space) != server->space_get_state_hash(scene_b.space),
+			"The hash should cover body velocities.");
+
+	free_scene(server, scene_a);
+	free_scene(server, scene_b);
+	server->free(shape);
+
+	project_settings->set_setting("physics/2d/solver/deterministic", previous_deterministic);
+	server->finish();
+	memdelete(server);
+}
+
+TEST_CASE("[Modules][GodotPhysics2D] Deterministic results don't depend on the thread count") {
+	ProjectSettings *project_settings = ProjectSettings::get_singleton();
+	GodotPhysicsServer2D *server = memnew(GodotPhysicsServer2D);
+	server->init();
+	server->set_active(true);
+
+	const Variant previous_deterministic = project_settings->get_setting("physics/2d/solver/deterministic");
+	project_settings->set_setting("physics/2d/solver/deterministic", true);
+
+	RID shape = server->rectangle_shape_create();
+	server->shape_set_data(shape, Vector2(10.0, 10.0));
+
+	// Several pyramids, so there are several islands to spread across threads.
+	LocalVector<uint64_t> single_thread_hashes;
+	server->set_step_max_tasks(1);
+	Scene scene = create_scene(server, shape, false, 3);
+	for (int i = 0; i < 120; i++) {
+		server->step(1.0 / 60.0);
+		server->flush_queries();
+		single_thread_hashes.push_back(server->space_get_state_hash(scene.space));
+	}
+	free_scene(server, scene);
+
+	server->set_step_max_tasks(-1);
+	scene = create_scene(server, shape, true, 3);
+	int diverged_step = -1;
+	for (int i = 0; i < 120 && diverged_step == -1; i++) {
+		server->step(1.0 / 60.0);
+		server->flush_queries();
+		if (server->space_get_state_hash(scene.space) != single_thread_hashes[i]) {
+			diverged_step = i;
+		}
+	}
+	CHECK_MESSAGE(diverged_step == -1, "Stepping on one thread and on every worker thread should give the same results.");
+	free_scene(server, scene);
+
+	server->free(shape);
+
+	project_settings->set_setting("physics/2d/solver/deterministic", previous_deterministic);
+	server->finish();
+	memdelete(server);
+}
+
+} // namespace TestGodotSpace2D
@@ -451,6 +451,21 @@ bool GodotBodyPair3D::pre_solve(real_t p_step) {
 	return do_process;
 }
 
+bool GodotBodyPair3D::is_pre_solve_island_local() const {
+	// Impulses are only applied to rigid bodies, which belong to a single island. Static and kinematic
+	// bodies are shared between islands, so contacts can't be reported to them in parallel.
+	if (space->is_debugging_contacts()) {
+		return false;
+	}
+	if (A->get_mode() <= PhysicsServer3D::BODY_MODE_KINEMATIC && A->can_report_contacts()) {
+		return false;
+	}
+	if (B->get_mode() <= PhysicsServer3D::BODY_MODE_KINEMATIC && B->can_report_contacts()) {
+		return false;
+	}
+	return true;
+}
+
 void GodotBodyPair3D::solve(real_t p_step) {
 	if (!collided) {
 		return;
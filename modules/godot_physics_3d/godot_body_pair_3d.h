@@ -106,6 +106,7 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 public:
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
+	virtual bool is_pre_solve_island_local() const override;
 	virtual void solve(real_t p_step) override;
 
 	GodotBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotBody3D *p_B, int p_shape_B);
@@ -65,5 +65,8 @@ public:
 
 	virtual void update() = 0;
 
+	// Called before culls run on several threads at once, to flush any work they would otherwise do lazily.
+	virtual void prepare_concurrent_queries() {}
+
 	virtual ~GodotBroadPhase3D();
 };
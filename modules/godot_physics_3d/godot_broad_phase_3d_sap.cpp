@@ -0,0 +1,358 @@
+/**************************************************************************/
+/*  godot_broad_phase_3d_sap.cpp                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "godot_broad_phase_3d_sap.h"
+
+#include "godot_collision_object_3d.h"
+
+#include "core/templates/sort_array.h"
+
+GodotBroadPhase3DSAP::ID GodotBroadPhase3DSAP::create(GodotCollisionObject3D *p_object, int p_subindex, const AABB &p_aabb, bool p_static) {
+	ERR_FAIL_NULL_V(p_object, 0);
+
+	ID id;
+	if (free_ids.size()) {
+		id = free_ids[free_ids.size() - 1];
+		free_ids.resize(free_ids.size() - 1);
+	} else {
+		elements.push_back(Element());
+		id = elements.size();
+	}
+
+	Element &e = elements[id - 1];
+	e.owner = p_object;
+	e.aabb = p_aabb;
+	e.subindex = p_subindex;
+	e._static = p_static;
+
+	added_ids.push_back(id);
+	sort_needed = true;
+	return id;
+}
+
+void GodotBroadPhase3DSAP::move(ID p_id, const AABB &p_aabb) {
+	ERR_FAIL_COND(!p_id || p_id > elements.size() || !elements[p_id - 1].owner);
+	Element &e = elements[p_id - 1];
+	e.aabb = p_aabb;
+	sort_needed = true;
+}
+
+void GodotBroadPhase3DSAP::set_static(ID p_id, bool p_static) {
+	ERR_FAIL_COND(!p_id || p_id > elements.size() || !elements[p_id - 1].owner);
+	// Pairs between two static elements are dropped on the next update.
+	elements[p_id - 1]._static = p_static;
+}
+
+void GodotBroadPhase3DSAP::remove(ID p_id) {
+	ERR_FAIL_COND(!p_id || p_id > elements.size() || !elements[p_id - 1].owner);
+	Element &e = elements[p_id - 1];
+
+	while (e.pairs.size()) {
+		const ID other = e.pairs[e.pairs.size() - 1];
+		HashMap<uint64_t, Pair>::Iterator E = pair_map.find(_get_pair_key(p_id, other));
+		void *data = E ? E->value.data : nullptr;
+		if (E) {
+			pair_map.remove(E);
+		}
+		_unpair(p_id, other, data);
+	}
+
+	e.owner = nullptr;
+	removed_ids.push_back(p_id);
+	sort_needed = true;
+}
+
+GodotCollisionObject3D *GodotBroadPhase3DSAP::get_object(ID p_id) const {
+	ERR_FAIL_COND_V(!p_id || p_id > elements.size(), nullptr);
+	GodotCollisionObject3D *it = elements[p_id - 1].owner;
+	ERR_FAIL_NULL_V(it, nullptr);
+	return it;
+}
+
+bool GodotBroadPhase3DSAP::is_static(ID p_id) const {
+	ERR_FAIL_COND_V(!p_id || p_id > elements.size(), false);
+	return elements[p_id - 1]._static;
+}
+
+int GodotBroadPhase3DSAP::get_subindex(ID p_id) const {
+	ERR_FAIL_COND_V(!p_id || p_id > elements.size(), 0);
+	return elements[p_id - 1].subindex;
+}
+
+void GodotBroadPhase3DSAP::_sort() {
+	// Drop removed elements, their IDs can be reused from now on.
+	uint32_t live_count = 0;
+	for (uint32_t i = 0; i < sorted_ids.size(); i++) {
+		if (elements[sorted_ids[i] - 1].owner) {
+			sorted_ids[live_count++] = sorted_ids[i];
+		}
+	}
+	sorted_ids.resize(live_count);
+	uint32_t added_count = 0;
+	for (uint32_t i = 0; i < added_ids.size(); i++) {
+		if (elements[added_ids[i] - 1].owner) {
+			added_ids[added_count++] = added_ids[i];
+		}
+	}
+	added_ids.resize(added_count);
+	for (const ID id : removed_ids) {
+		free_ids.push_back(id);
+	}
+	removed_ids.clear();
+
+	SortArray<ID, SortByMinX> sorter;
+	sorter.compare.elements = elements.ptr();
+
+	// Elements usually only move a little between updates, so the order is nearly kept and an
+	// insertion sort runs in close to linear time. Teleported elements can make it quadratic,
+	// so past a budget of moves it gives up and the rest is sorted from scratch.
+	ID *ids = sorted_ids.ptr();
+	uint64_t move_budget = uint64_t(live_count) * 4 + 64;
+	for (uint32_t i = 0; i < live_count; i++) {
+		const ID id = ids[i];
+		const real_t x = elements[id - 1].aabb.position.x;
+		uint32_t j = i;
+		while (j > 0 && elements[ids[j - 1] - 1].aabb.position.x > x && move_budget > 0) {
+			ids[j] = ids[j - 1];
+			j--;
+			move_budget--;
+		}
+		ids[j] = id;
+		if (move_budget == 0) {
+			sorter.sort(ids, live_count);
+			break;
+		}
+	}
+
+	// Newly created elements come in creation order, sort them on their own and merge them in.
+	if (added_count > 0) {
+		sorter.sort(added_ids.ptr(), added_count);
+		LocalVector<ID> merged;
+		merged.resize(live_count + added_count);
+		uint32_t from_sorted = 0;
+		uint32_t from_added = 0;
+		for (uint32_t i = 0; i < merged.size(); i++) {
+			if (from_added == added_count || (from_sorted < live_count && !sorter.compare(added_ids[from_added], sorted_ids[from_sorted]))) {
+				merged[i] = sorted_ids[from_sorted++];
+			} else {
+				merged[i] = added_ids[from_added++];
+			}
+		}
+		sorted_ids = std::move(merged);
+		added_ids.clear();
+	}
+
+	// A single large element (a floor, terrain) would widen every cull window to the whole list.
+	real_t total_size_x = 0.0;
+	for (const ID id : sorted_ids) {
+		total_size_x += elements[id - 1].aabb.size.x;
+	}
+	const real_t large_size_x = sorted_ids.is_empty() ? 0.0 : total_size_x / sorted_ids.size() * LARGE_ELEMENT_FACTOR;
+	max_size_x = 0.0;
+	large_ids.clear();
+	for (const ID id : sorted_ids) {
+		const real_t size_x = elements[id - 1].aabb.size.x;
+		if (size_x > large_size_x) {
+			large_ids.push_back(id);
+		} else {
+			max_size_x = MAX(max_size_x, size_x);
+		}
+	}
+
+	sort_needed = false;
+}
+
+void GodotBroadPhase3DSAP::_unpair(ID p_a, ID p_b, void *p_data) {
+	Element &a = elements[p_a - 1];
+	Element &b = elements[p_b - 1];
+	a.pairs.erase_unordered(p_b);
+	b.pairs.erase_unordered(p_a);
+
+	if (unpair_callback) {
+		if (p_a > p_b) {
+			unpair_callback(b.owner, b.subindex, a.owner, a.subindex, p_data, unpair_userdata);
+		} else {
+			unpair_callback(a.owner, a.subindex, b.owner, b.subindex, p_data, unpair_userdata);
+		}
+	}
+}
+
+template <typename T>
+int GodotBroadPhase3DSAP::_cull(const AABB &p_bounds, const T &p_test, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices) {
+	if (sort_needed) {
+		_sort();
+	}
+
+	// No regular element starting before the window can reach the bounds.
+	const real_t window_begin = p_bounds.position.x - max_size_x;
+	const real_t window_end = p_bounds.position.x + p_bounds.size.x;
+	uint32_t low = 0;
+	uint32_t high = sorted_ids.size();
+	while (low < high) {
+		const uint32_t middle = (low + high) / 2;
+		if (elements[sorted_ids[middle] - 1].aabb.position.x < window_begin) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+
+	int count = 0;
+	// Large elements starting before the window aren't part of the scan below.
+	for (uint32_t i = 0; i < large_ids.size() && count < p_max_results; i++) {
+		const Element &e = elements[large_ids[i] - 1];
+		if (e.aabb.position.x >= window_begin || !p_test(e.aabb)) {
+			continue;
+		}
+		p_results[count] = e.owner;
+		if (p_result_indices) {
+			p_result_indices[count] = e.subindex;
+		}
+		count++;
+	}
+
+	for (uint32_t i = low; i < sorted_ids.size() && count < p_max_results; i++) {
+		const Element &e = elements[sorted_ids[i] - 1];
+		if (e.aabb.position.x > window_end) {
+			break;
+		}
+		if (!p_test(e.aabb)) {
+			continue;
+		}
+		p_results[count] = e.owner;
+		if (p_result_indices) {
+			p_result_indices[count] = e.subindex;
+		}
+		count++;
+	}
+
+	return count;
+}
+
+int GodotBroadPhase3DSAP::cull_point(const Vector3 &p_point, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices) {
+	return _cull(AABB(p_point, Vector3()), [&](const AABB &p_aabb) { return p_aabb.has_point(p_point); }, p_results, p_max_results, p_result_indices);
+}
+
+int GodotBroadPhase3DSAP::cull_segment(const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices) {
+	AABB bounds(p_from, Vector3());
+	bounds.expand_to(p_to);
+	return _cull(bounds, [&](const AABB &p_aabb) { return p_aabb.intersects_segment(p_from, p_to); }, p_results, p_max_results, p_result_indices);
+}
+
+int GodotBroadPhase3DSAP::cull_aabb(const AABB &p_aabb, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices) {
+	return _cull(p_aabb, [&](const AABB &p_other) { return p_other.intersects_inclusive(p_aabb); }, p_results, p_max_results, p_result_indices);
+}
+
+void GodotBroadPhase3DSAP::set_pair_callback(PairCallback p_pair_callback, void *p_userdata) {
+	pair_callback = p_pair_callback;
+	pair_userdata = p_userdata;
+}
+
+void GodotBroadPhase3DSAP::set_unpair_callback(UnpairCallback p_unpair_callback, void *p_userdata) {
+	unpair_callback = p_unpair_callback;
+	unpair_userdata = p_userdata;
+}
+
+void GodotBroadPhase3DSAP::prepare_concurrent_queries() {
+	if (sort_needed) {
+		_sort();
+	}
+}
+
+void GodotBroadPhase3DSAP::update() {
+	if (sort_needed) {
+		_sort();
+	}
+
+	pass++;
+
+	// Sweep along X, each element only needs testing against the elements
+	// starting before it ends.
+	const uint32_t count = sorted_ids.size();
+	const ID *ids = sorted_ids.ptr();
+	for (uint32_t i = 0; i < count; i++) {
+		const ID id_a = ids[i];
+		Element &a = elements[id_a - 1];
+		const AABB aabb_a = a.aabb.grow(PAIRING_MARGIN);
+		const real_t end_x = aabb_a.position.x + aabb_a.size.x + PAIRING_MARGIN;
+
+		for (uint32_t j = i + 1; j < count; j++) {
+			const ID id_b = ids[j];
+			Element &b = elements[id_b - 1];
+			if (b.aabb.position.x > end_x) {
+				break;
+			}
+			if (a._static && b._static) {
+				continue;
+			}
+			if (a.owner == b.owner || !aabb_a.intersects_inclusive(b.aabb.grow(PAIRING_MARGIN))) {
+				continue;
+			}
+
+			const ID id_low = MIN(id_a, id_b);
+			const ID id_high = MAX(id_a, id_b);
+			Element &low = elements[id_low - 1];
+			Element &high = elements[id_high - 1];
+			if (!low.owner->interacts_with(high.owner)) {
+				continue;
+			}
+
+			const uint64_t key = _get_pair_key(id_low, id_high);
+			Pair *pair = pair_map.getptr(key);
+			if (!pair) {
+				pair = &pair_map.insert(key, Pair())->value;
+				low.pairs.push_back(id_high);
+				high.pairs.push_back(id_low);
+				if (pair_callback) {
+					pair->data = pair_callback(low.owner, low.subindex, high.owner, high.subindex, pair_userdata);
+				}
+			}
+			pair->pass = pass;
+		}
+	}
+
+	// Pairs not found in this sweep no longer overlap.
+	LocalVector<uint64_t> stale_keys;
+	for (const KeyValue<uint64_t, Pair> &E : pair_map) {
+		if (E.value.pass != pass) {
+			stale_keys.push_back(E.key);
+		}
+	}
+	for (const uint64_t key : stale_keys) {
+		HashMap<uint64_t, Pair>::Iterator E = pair_map.find(key);
+		void *data = E->value.data;
+		pair_map.remove(E);
+		_unpair(ID(key >> 32), ID(key & 0xFFFFFFFF), data);
+	}
+}
+
+GodotBroadPhase3D *GodotBroadPhase3DSAP::_create() {
+	return memnew(GodotBroadPhase3DSAP);
+}
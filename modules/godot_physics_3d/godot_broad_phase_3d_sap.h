@@ -0,0 +1,118 @@
+/**************************************************************************/
+/*  godot_broad_phase_3d_sap.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "godot_broad_phase_3d.h"
+
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+
+// Sweep and prune broadphase, sorting elements along the X axis. Pairs are
+// found with a single sweep per update, which suits scenes with many moving
+// bodies of similar sizes better than maintaining a tree. Culling searches a
+// window of the sorted elements bounded by the largest regular element, much
+// larger elements (such as floors) are kept in a list that is always tested.
+class GodotBroadPhase3DSAP : public GodotBroadPhase3D {
+	struct Element {
+		GodotCollisionObject3D *owner = nullptr; // nullptr once removed.
+		AABB aabb;
+		int subindex = 0;
+		bool _static = false;
+		LocalVector<ID> pairs;
+	};
+
+	struct Pair {
+		void *data = nullptr;
+		uint64_t pass = 0;
+	};
+
+	// Pairs form when the AABBs grown by this margin overlap, as in the BVH broadphase.
+	static constexpr real_t PAIRING_MARGIN = 0.1;
+
+	LocalVector<Element> elements; // Indexed by ID - 1.
+	LocalVector<ID> free_ids;
+	LocalVector<ID> removed_ids; // Reused after the next sort, once they left sorted_ids.
+	LocalVector<ID> sorted_ids; // Sorted by minimum X, may contain removed IDs until the next sort.
+	LocalVector<ID> added_ids; // Created since the last sort, merged into sorted_ids by the next one.
+	LocalVector<ID> large_ids; // Elements much larger than the others along X, left out of max_size_x.
+	bool sort_needed = false;
+	real_t max_size_x = 0.0;
+
+	// Elements larger than this many times the average size along X are culled separately.
+	static constexpr real_t LARGE_ELEMENT_FACTOR = 8.0;
+
+	struct SortByMinX {
+		const Element *elements = nullptr;
+		_FORCE_INLINE_ bool operator()(ID p_a, ID p_b) const {
+			return elements[p_a - 1].aabb.position.x < elements[p_b - 1].aabb.position.x;
+		}
+	};
+
+	HashMap<uint64_t, Pair> pair_map;
+	uint64_t pass = 0;
+
+	PairCallback pair_callback = nullptr;
+	void *pair_userdata = nullptr;
+	UnpairCallback unpair_callback = nullptr;
+	void *unpair_userdata = nullptr;
+
+	_FORCE_INLINE_ static uint64_t _get_pair_key(ID p_a, ID p_b) {
+		return p_a < p_b ? ((uint64_t(p_a) << 32) | p_b) : ((uint64_t(p_b) << 32) | p_a);
+	}
+
+	void _sort();
+	void _unpair(ID p_a, ID p_b, void *p_data);
+	template <typename T>
+	int _cull(const AABB &p_bounds, const T &p_test, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices);
+
+public:
+	// 0 is an invalid ID
+	virtual ID create(GodotCollisionObject3D *p_object, int p_subindex = 0, const AABB &p_aabb = AABB(), bool p_static = false) override;
+	virtual void move(ID p_id, const AABB &p_aabb) override;
+	virtual void set_static(ID p_id, bool p_static) override;
+	virtual void remove(ID p_id) override;
+
+	virtual GodotCollisionObject3D *get_object(ID p_id) const override;
+	virtual bool is_static(ID p_id) const override;
+	virtual int get_subindex(ID p_id) const override;
+
+	virtual int cull_point(const Vector3 &p_point, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices = nullptr) override;
+	virtual int cull_segment(const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices = nullptr) override;
+	virtual int cull_aabb(const AABB &p_aabb, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices = nullptr) override;
+
+	virtual void set_pair_callback(PairCallback p_pair_callback, void *p_userdata) override;
+	virtual void set_unpair_callback(UnpairCallback p_unpair_callback, void *p_userdata) override;
+
+	virtual void update() override;
+	virtual void prepare_concurrent_queries() override;
+
+	static GodotBroadPhase3D *_create();
+};
@@ -72,6 +72,8 @@ public:
 
 	virtual bool setup(real_t p_step) = 0;
 	virtual bool pre_solve(real_t p_step) = 0;
+	// Whether pre_solve() only writes to bodies of the constraint's own island, so it can run in parallel with other islands.
+	virtual bool is_pre_solve_island_local() const { return false; }
 	virtual void solve(real_t p_step) = 0;
 
 	virtual ~GodotConstraint3D() {}
@@ -32,12 +32,14 @@
 
 #include "godot_body_direct_state_3d.h"
 #include "godot_broad_phase_3d_bvh.h"
+#include "godot_broad_phase_3d_sap.h"
 #include "joints/godot_cone_twist_joint_3d.h"
 #include "joints/godot_generic_6dof_joint_3d.h"
 #include "joints/godot_hinge_joint_3d.h"
 #include "joints/godot_pin_joint_3d.h"
 #include "joints/godot_slider_joint_3d.h"
 
+#include "core/config/project_settings.h"
 #include "core/debugger/engine_debugger.h"
 #include "core/os/os.h"
 
@@ -1670,8 +1672,10 @@ void GodotPhysicsServer3D::flush_queries() {
 		uint64_t total_time[GodotSpace3D::ELAPSED_TIME_MAX];
 		static const char *time_name[GodotSpace3D::ELAPSED_TIME_MAX] = {
 			"integrate_forces",
+			"broadphase",
 			"generate_islands",
 			"setup_constraints",
+			"pre_solve_constraints",
 			"solve_constraints",
 			"integrate_velocities"
 		};
@@ -1767,7 +1771,11 @@ void GodotPhysicsServer3D::_shape_col_cbk(const Vector3 &p_point_A, int p_index_
 GodotPhysicsServer3D *GodotPhysicsServer3D::godot_singleton = nullptr;
 GodotPhysicsServer3D::GodotPhysicsServer3D(bool p_using_threads) {
 	godot_singleton = this;
-	GodotBroadPhase3D::create_func = GodotBroadPhase3DBVH::_create;
+	if (int(GLOBAL_GET("physics/3d/broadphase")) == 1) {
+		GodotBroadPhase3D::create_func = GodotBroadPhase3DSAP::_create;
+	} else {
+		GodotBroadPhase3D::create_func = GodotBroadPhase3DBVH::_create;
+	}
 
 	using_threads = p_using_threads;
 }
@@ -41,6 +41,35 @@
 class GodotPhysicsDirectSpaceState3D : public PhysicsDirectSpaceState3D {
 	GDCLASS(GodotPhysicsDirectSpaceState3D, PhysicsDirectSpaceState3D);
 
+	enum {
+		BATCH_CHUNK_SIZE = 64, // Batched queries per task, each task allocates its own cull buffers.
+	};
+
+	struct RayBatch {
+		const RayParameters *parameters = nullptr;
+		const Vector3 *from_to = nullptr;
+		int count = 0;
+		RayResult *results = nullptr;
+		uint8_t *hits = nullptr;
+	};
+
+	struct MotionBatch {
+		const ShapeParameters *parameters = nullptr;
+		GodotShape3D *shape = nullptr;
+		const Transform3D *transforms = nullptr;
+		const Vector3 *motions = nullptr;
+		int count = 0;
+		real_t *closest_safe = nullptr;
+		real_t *closest_unsafe = nullptr;
+	};
+
+	// These only read from the space, using the given cull buffers, so they can run concurrently.
+	bool _intersect_ray(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, RayResult &r_result, GodotCollisionObject3D **r_cull_results, int *r_cull_subindices) const;
+	bool _cast_motion(const ShapeParameters &p_parameters, GodotShape3D *p_shape, const Transform3D &p_transform, const Vector3 &p_motion, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info, GodotCollisionObject3D **r_cull_results, int *r_cull_subindices) const;
+
+	void _intersect_ray_batch_chunk(uint32_t p_chunk, const RayBatch *p_batch);
+	void _cast_motion_batch_chunk(uint32_t p_chunk, const MotionBatch *p_batch);
+
 public:
 	GodotSpace3D *space = nullptr;
 
@@ -52,6 +81,9 @@ public:
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) override;
 	virtual Vector3 get_closest_point_to_object_volume(RID p_object, const Vector3 p_point) const override;
 
+	virtual void intersect_ray_batch(const RayParameters &p_parameters, const Vector3 *p_from_to, int p_ray_count, RayResult *r_results, uint8_t *r_hits) override;
+	virtual void cast_motion_batch(const ShapeParameters &p_parameters, const Transform3D *p_transforms, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) override;
+
 	GodotPhysicsDirectSpaceState3D();
 };
 
@@ -59,8 +91,10 @@ class GodotSpace3D {
 public:
 	enum ElapsedTime {
 		ELAPSED_TIME_INTEGRATE_FORCES,
+		ELAPSED_TIME_BROADPHASE,
 		ELAPSED_TIME_GENERATE_ISLANDS,
 		ELAPSED_TIME_SETUP_CONSTRAINTS,
+		ELAPSED_TIME_PRE_SOLVE_CONSTRAINTS,
 		ELAPSED_TIME_SOLVE_CONSTRAINTS,
 		ELAPSED_TIME_INTEGRATE_VELOCITIES,
 		ELAPSED_TIME_MAX
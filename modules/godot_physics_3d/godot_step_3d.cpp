@@ -117,17 +117,40 @@ void GodotStep3D::_setup_constraint(uint32_t p_constraint_index, void *p_userdat
 	constraint->setup(delta);
 }
 
-void GodotStep3D::_pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const {
-	uint32_t constraint_count = p_constraint_island.size();
+void GodotStep3D::_pre_solve_island_local(uint32_t p_island_index, void *p_userdata) {
+	const LocalVector<GodotConstraint3D *> &constraint_island = constraint_islands[p_island_index];
+	LocalVector<uint8_t> &results = pre_solve_results[p_island_index];
+
+	uint32_t constraint_count = constraint_island.size();
+	results.resize(constraint_count);
+	for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
+		GodotConstraint3D *constraint = constraint_island[constraint_index];
+		if (!constraint->is_pre_solve_island_local()) {
+			results[constraint_index] = PRE_SOLVE_DEFERRED;
+		} else {
+			results[constraint_index] = constraint->pre_solve(delta) ? PRE_SOLVE_KEEP : PRE_SOLVE_DISCARD;
+		}
+	}
+}
+
+void GodotStep3D::_pre_solve_island(uint32_t p_island_index) {
+	LocalVector<GodotConstraint3D *> &constraint_island = constraint_islands[p_island_index];
+	const LocalVector<uint8_t> &results = pre_solve_results[p_island_index];
+
+	uint32_t constraint_count = constraint_island.size();
 	uint32_t valid_constraint_count = 0;
 	for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
-		GodotConstraint3D *constraint = p_constraint_island[constraint_index];
-		if (p_constraint_island[constraint_index]->pre_solve(delta)) {
+		GodotConstraint3D *constraint = constraint_island[constraint_index];
+		bool keep = results[constraint_index] == PRE_SOLVE_KEEP;
+		if (results[constraint_index] == PRE_SOLVE_DEFERRED) {
+			keep = constraint->pre_solve(delta);
+		}
+		if (keep) {
 			// Keep this constraint for solving.
-			p_constraint_island[valid_constraint_count++] = constraint;
+			constraint_island[valid_constraint_count++] = constraint;
 		}
 	}
-	p_constraint_island.resize(valid_constraint_count);
+	constraint_island.resize(valid_constraint_count);
 }
 
 void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
@@ -158,6 +181,10 @@ void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	}
 }
 
+void GodotStep3D::_solve_soft_body_constraints(uint32_t p_soft_body_index, void *p_userdata) {
+	active_soft_bodies[p_soft_body_index]->solve_constraints(delta);
+}
+
 void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const {
 	bool can_sleep = true;
 
@@ -212,21 +239,30 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* UPDATE SOFT BODY MOTION */
 
+	active_soft_bodies.clear();
+
 	const SelfList<GodotSoftBody3D> *sb = soft_body_list->first();
 	while (sb) {
 		sb->self()->predict_motion(p_delta);
+		active_soft_bodies.push_back(sb->self());
 		sb = sb->next();
 		active_count++;
 	}
 
 	p_space->set_active_objects(active_count);
 
+	{ //profile
+		profile_endtime = OS::get_singleton()->get_ticks_usec();
+		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_INTEGRATE_FORCES, profile_endtime - profile_begtime);
+		profile_begtime = profile_endtime;
+	}
+
 	// Update the broadphase to register collision pairs.
 	p_space->update();
 
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
-		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_INTEGRATE_FORCES, profile_endtime - profile_begtime);
+		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_BROADPHASE, profile_endtime - profile_begtime);
 		profile_begtime = profile_endtime;
 	}
 
@@ -355,9 +391,23 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* PRE-SOLVE CONSTRAINT ISLANDS */
 
-	// WARNING: This doesn't run on threads, because it involves thread-unsafe processing.
+	// Constraints only touching bodies of their own island are pre-solved on threads first. The others
+	// involve thread-unsafe processing (e.g. area queries, contacts reported to static bodies), so they
+	// run afterwards on this thread, in island order, which keeps the results deterministic.
+	if (pre_solve_results.size() < island_count) {
+		pre_solve_results.resize(island_count);
+	}
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_pre_solve_island_local, nullptr, island_count, -1, true, SNAME("Physics3DConstraintPreSolveIslands"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
 	for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
-		_pre_solve_island(constraint_islands[island_index]);
+		_pre_solve_island(island_index);
+	}
+
+	{ //profile
+		profile_endtime = OS::get_singleton()->get_ticks_usec();
+		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_PRE_SOLVE_CONSTRAINTS, profile_endtime - profile_begtime);
+		profile_begtime = profile_endtime;
 	}
 
 	/* SOLVE CONSTRAINT ISLANDS */
@@ -390,11 +440,9 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* UPDATE SOFT BODY CONSTRAINTS */
 
-	sb = soft_body_list->first();
-	while (sb) {
-		sb->self()->solve_constraints(p_delta);
-		sb = sb->next();
-	}
+	// Soft bodies only move their own nodes here, so each one can be solved on its own thread.
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_soft_body_constraints, nullptr, active_soft_bodies.size(), -1, true, SNAME("Physics3DSoftBodyConstraints"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
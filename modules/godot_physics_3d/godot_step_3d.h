@@ -43,12 +43,22 @@ class GodotStep3D {
 	LocalVector<LocalVector<GodotBody3D *>> body_islands;
 	LocalVector<LocalVector<GodotConstraint3D *>> constraint_islands;
 	LocalVector<GodotConstraint3D *> all_constraints;
+	LocalVector<LocalVector<uint8_t>> pre_solve_results; // One entry per constraint of each island, see PreSolveResult.
+	LocalVector<GodotSoftBody3D *> active_soft_bodies;
+
+	enum PreSolveResult : uint8_t {
+		PRE_SOLVE_DISCARD,
+		PRE_SOLVE_KEEP,
+		PRE_SOLVE_DEFERRED, // Not island local, pre-solved on the calling thread afterwards.
+	};
 
 	void _populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _populate_island_soft_body(GodotSoftBody3D *p_soft_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
-	void _pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const;
+	void _pre_solve_island_local(uint32_t p_island_index, void *p_userdata = nullptr);
+	void _pre_solve_island(uint32_t p_island_index);
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
+	void _solve_soft_body_constraints(uint32_t p_soft_body_index, void *p_userdata = nullptr);
 	void _check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const;
 
 public:
@@ -0,0 +1,161 @@
+/**************************************************************************/
+/*  test_broad_phase_3d.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../godot_body_3d.h"
+#include "../godot_broad_phase_3d_bvh.h"
+#include "../godot_broad_phase_3d_sap.h"
+
+#include "core/math/random_pcg.h"
+#include "core/templates/hash_set.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotBroadPhase3D {
+
+// Bodies are registered with their index as subindex, to identify pairs.
+struct PairRecorder {
+	HashSet<uint64_t> pairs;
+
+	static uint64_t get_key(int p_a, int p_b) {
+		return p_a < p_b ? ((uint64_t(p_a) << 32) | uint32_t(p_b)) : ((uint64_t(p_b) << 32) | uint32_t(p_a));
+	}
+
+	static void *pair(GodotCollisionObject3D *p_a, int p_subindex_a, GodotCollisionObject3D *p_b, int p_subindex_b, void *p_userdata) {
+		PairRecorder *self = static_cast<PairRecorder *>(p_userdata);
+		CHECK_FALSE(self->pairs.has(get_key(p_subindex_a, p_subindex_b)));
+		self->pairs.insert(get_key(p_subindex_a, p_subindex_b));
+		return nullptr;
+	}
+
+	static void unpair(GodotCollisionObject3D *p_a, int p_subindex_a, GodotCollisionObject3D *p_b, int p_subindex_b, void *p_data, void *p_userdata) {
+		PairRecorder *self = static_cast<PairRecorder *>(p_userdata);
+		CHECK(self->pairs.has(get_key(p_subindex_a, p_subindex_b)));
+		self->pairs.erase(get_key(p_subindex_a, p_subindex_b));
+	}
+};
+
+static AABB random_box(RandomPCG &p_rng) {
+	const Vector3 position(p_rng.random(-50.0f, 50.0f), p_rng.random(-50.0f, 50.0f), p_rng.random(-50.0f, 50.0f));
+	return AABB(position, Vector3(p_rng.random(0.5f, 4.0f), p_rng.random(0.5f, 4.0f), p_rng.random(0.5f, 4.0f)));
+}
+
+static void check_broad_phase(GodotBroadPhase3D *p_broad_phase, bool p_exact_margin) {
+	const int count = 400;
+	RandomPCG rng(1234);
+	PairRecorder recorder;
+	p_broad_phase->set_pair_callback(PairRecorder::pair, &recorder);
+	p_broad_phase->set_unpair_callback(PairRecorder::unpair, &recorder);
+
+	LocalVector<GodotBody3D *> bodies;
+	LocalVector<AABB> boxes;
+	LocalVector<GodotBroadPhase3D::ID> ids;
+	for (int i = 0; i < count; i++) {
+		bodies.push_back(memnew(GodotBody3D));
+		// The first element is a static floor much larger than the others.
+		boxes.push_back(i == 0 ? AABB(Vector3(-60, -1, -60), Vector3(120, 2, 120)) : random_box(rng));
+		ids.push_back(p_broad_phase->create(bodies[i], i, boxes[i], i % 10 == 0));
+	}
+
+	for (int step = 0; step < 4; step++) {
+		for (int i = 0; i < count; i += 2) {
+			if (i % 50 == 2) {
+				// Teleport some elements far from where they were.
+				boxes[i] = random_box(rng);
+			} else {
+				boxes[i].position += Vector3(rng.random(-1.0f, 1.0f), rng.random(-1.0f, 1.0f), rng.random(-1.0f, 1.0f));
+			}
+			p_broad_phase->move(ids[i], boxes[i]);
+		}
+		p_broad_phase->update();
+
+		for (int i = 0; i < count; i++) {
+			for (int j = i + 1; j < count; j++) {
+				if (p_broad_phase->is_static(ids[i]) && p_broad_phase->is_static(ids[j])) {
+					CHECK_FALSE(recorder.pairs.has(PairRecorder::get_key(i, j)));
+				} else if (boxes[i].intersects_inclusive(boxes[j])) {
+					// Overlapping shapes always pair, the margin may pair close ones too.
+					CHECK(recorder.pairs.has(PairRecorder::get_key(i, j)));
+				} else if (p_exact_margin && !boxes[i].grow(0.1).intersects_inclusive(boxes[j].grow(0.1))) {
+					CHECK_FALSE(recorder.pairs.has(PairRecorder::get_key(i, j)));
+				}
+			}
+		}
+	}
+
+	GodotCollisionObject3D *results[count];
+	int result_indices[count];
+	const AABB query(Vector3(-10, -10, -10), Vector3(20, 20, 20));
+	const int result_count = p_broad_phase->cull_aabb(query, results, count, result_indices);
+	int expected_count = 0;
+	for (int i = 0; i < count; i++) {
+		if (boxes[i].intersects_inclusive(query)) {
+			expected_count++;
+		}
+	}
+	CHECK_EQ(result_count, expected_count);
+	for (int i = 0; i < result_count; i++) {
+		CHECK(boxes[result_indices[i]].intersects_inclusive(query));
+		CHECK_EQ(results[i], bodies[result_indices[i]]);
+	}
+
+	const Vector3 point = boxes[7].get_center();
+	const int point_count = p_broad_phase->cull_point(point, results, count, result_indices);
+	bool found = false;
+	for (int i = 0; i < point_count; i++) {
+		CHECK(boxes[result_indices[i]].has_point(point));
+		found = found || result_indices[i] == 7;
+	}
+	CHECK(found);
+
+	for (int i = 0; i < count; i++) {
+		p_broad_phase->remove(ids[i]);
+	}
+	CHECK(recorder.pairs.is_empty());
+
+	for (GodotBody3D *body : bodies) {
+		memdelete(body);
+	}
+}
+
+TEST_CASE("[Physics][GodotPhysics3D] BVH broadphase pairs and culls") {
+	GodotBroadPhase3D *broad_phase = GodotBroadPhase3DBVH::_create();
+	check_broad_phase(broad_phase, false);
+	memdelete(broad_phase);
+}
+
+TEST_CASE("[Physics][GodotPhysics3D] Sweep and prune broadphase pairs and culls") {
+	GodotBroadPhase3D *broad_phase = GodotBroadPhase3DSAP::_create();
+	check_broad_phase(broad_phase, true);
+	memdelete(broad_phase);
+}
+
+} // namespace TestGodotBroadPhase3D
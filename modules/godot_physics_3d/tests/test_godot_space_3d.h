@@ -0,0 +1,165 @@
+/**************************************************************************/
+/*  test_godot_space_3d.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../godot_physics_server_3d.h"
+
+#include "core/config/project_settings.h"
+#include "core/math/random_pcg.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotSpace3D {
+
+// Batched queries must give the same results as the same queries run one by one.
+static void check_batched_queries(PhysicsServer3D *p_server) {
+	RID space = p_server->space_create();
+	p_server->space_set_active(space, true);
+
+	RID box = p_server->box_shape_create();
+	p_server->shape_set_data(box, Vector3(1.0, 1.0, 1.0));
+
+	LocalVector<RID> bodies;
+	for (int x = 0; x < 8; x++) {
+		for (int z = 0; z < 8; z++) {
+			RID body = p_server->body_create();
+			p_server->body_set_mode(body, PhysicsServer3D::BODY_MODE_STATIC);
+			p_server->body_add_shape(body, box);
+			p_server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(x * 4.0, (x + z) % 3, z * 4.0)));
+			p_server->body_set_collision_layer(body, (x % 2) ? 1 : 2);
+			p_server->body_set_space(body, space);
+			bodies.push_back(body);
+		}
+	}
+
+	PhysicsDirectSpaceState3D *space_state = p_server->space_get_direct_state(space);
+	REQUIRE(space_state != nullptr);
+
+	PhysicsDirectSpaceState3D::RayParameters ray_parameters;
+	ray_parameters.collision_mask = 1;
+	ray_parameters.exclude.insert(bodies[1]);
+
+	RandomPCG rng(42);
+	const int ray_count = 1000;
+	LocalVector<Vector3> from_to;
+	for (int i = 0; i < ray_count; i++) {
+		from_to.push_back(Vector3(rng.random(-4.0f, 32.0f), 10.0, rng.random(-4.0f, 32.0f)));
+		from_to.push_back(Vector3(rng.random(-4.0f, 32.0f), -10.0, rng.random(-4.0f, 32.0f)));
+	}
+
+	LocalVector<PhysicsDirectSpaceState3D::RayResult> batch_results;
+	batch_results.resize(ray_count);
+	LocalVector<uint8_t> batch_hits;
+	batch_hits.resize(ray_count);
+	space_state->intersect_ray_batch(ray_parameters, from_to.ptr(), ray_count, batch_results.ptr(), batch_hits.ptr());
+
+	int hit_count = 0;
+	int mismatch_count = 0;
+	for (int i = 0; i < ray_count; i++) {
+		ray_parameters.from = from_to[i * 2 + 0];
+		ray_parameters.to = from_to[i * 2 + 1];
+		PhysicsDirectSpaceState3D::RayResult result;
+		const bool hit = space_state->intersect_ray(ray_parameters, result);
+		hit_count += hit;
+		if (hit != bool(batch_hits[i]) || (hit && (result.rid != batch_results[i].rid || !result.position.is_equal_approx(batch_results[i].position) || !result.normal.is_equal_approx(batch_results[i].normal)))) {
+			mismatch_count++;
+		}
+	}
+	CHECK_MESSAGE(hit_count > 0, "Some of the rays should hit the boxes.");
+	CHECK_MESSAGE(hit_count < ray_count, "Some of the rays should miss the boxes.");
+	CHECK_MESSAGE(mismatch_count == 0, "Batched rays should give the same results as single rays.");
+
+	PhysicsDirectSpaceState3D::ShapeParameters shape_parameters;
+	shape_parameters.shape_rid = box;
+	shape_parameters.collision_mask = 1;
+
+	const int cast_count = 200;
+	LocalVector<Transform3D> transforms;
+	LocalVector<Vector3> motions;
+	for (int i = 0; i < cast_count; i++) {
+		transforms.push_back(Transform3D(Basis(), Vector3(rng.random(-4.0f, 32.0f), 10.0, rng.random(-4.0f, 32.0f))));
+		motions.push_back(Vector3(rng.random(-2.0f, 2.0f), -20.0, rng.random(-2.0f, 2.0f)));
+	}
+
+	LocalVector<real_t> batch_safe;
+	batch_safe.resize(cast_count);
+	LocalVector<real_t> batch_unsafe;
+	batch_unsafe.resize(cast_count);
+	space_state->cast_motion_batch(shape_parameters, transforms.ptr(), motions.ptr(), cast_count, batch_safe.ptr(), batch_unsafe.ptr());
+
+	int blocked_count = 0;
+	mismatch_count = 0;
+	for (int i = 0; i < cast_count; i++) {
+		shape_parameters.transform = transforms[i];
+		shape_parameters.motion = motions[i];
+		real_t closest_safe = 1.0;
+		real_t closest_unsafe = 1.0;
+		space_state->cast_motion(shape_parameters, closest_safe, closest_unsafe);
+		blocked_count += closest_safe < 1.0;
+		if (closest_safe != batch_safe[i] || closest_unsafe != batch_unsafe[i]) {
+			mismatch_count++;
+		}
+	}
+	CHECK_MESSAGE(blocked_count > 0, "Some of the casts should be blocked by the boxes.");
+	CHECK_MESSAGE(mismatch_count == 0, "Batched casts should give the same results as single casts.");
+
+	for (const RID &body : bodies) {
+		p_server->free(body);
+	}
+	p_server->free(box);
+	p_server->free(space);
+}
+
+TEST_CASE("[Modules][GodotPhysics3D] Batched queries match single queries") {
+	ProjectSettings *project_settings = ProjectSettings::get_singleton();
+
+	SUBCASE("BVH broadphase") {
+		GodotPhysicsServer3D *server = memnew(GodotPhysicsServer3D);
+		server->init();
+		check_batched_queries(server);
+		server->finish();
+		memdelete(server);
+	}
+
+	SUBCASE("Sweep and prune broadphase") {
+		// The broadphase is picked when the server is created.
+		const Variant previous_broadphase = project_settings->get_setting("physics/3d/broadphase");
+		project_settings->set_setting("physics/3d/broadphase", 1);
+		GodotPhysicsServer3D *server = memnew(GodotPhysicsServer3D);
+		server->init();
+		check_batched_queries(server);
+		server->finish();
+		memdelete(server);
+		project_settings->set_setting("physics/3d/broadphase", previous_broadphase);
+	}
+}
+
+} // namespace TestGodotSpace3D
@@ -51,6 +51,7 @@ void JoltProjectSettings::register_settings() {
 	GLOBAL_DEF(PropertyInfo(Variant::BOOL, "physics/jolt_physics_3d/simulation/body_pair_contact_cache_enabled"), true);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/jolt_physics_3d/simulation/body_pair_contact_cache_distance_threshold", PROPERTY_HINT_RANGE, U"0,0.01,0.00001,or_greater,suffix:m"), 0.001f);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/jolt_physics_3d/simulation/body_pair_contact_cache_angle_threshold", PROPERTY_HINT_RANGE, U"0,180,0.01,radians_as_degrees"), Math::deg_to_rad(2.0f));
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "physics/jolt_physics_3d/simulation/job_dispatch_mode", PROPERTY_HINT_ENUM, U"Worker Thread Pool,Dedicated Threads"), JOLT_JOB_DISPATCH_MODE_WORKER_THREAD_POOL);
 
 	GLOBAL_DEF(PropertyInfo(Variant::BOOL, "physics/jolt_physics_3d/queries/use_enhanced_internal_edge_removal"), false);
 	GLOBAL_DEF_RST(PropertyInfo(Variant::BOOL, "physics/jolt_physics_3d/queries/enable_ray_cast_face_index"), false);
@@ -98,6 +99,7 @@ void JoltProjectSettings::read_settings() {
 	body_pair_cache_distance_sq = body_pair_cache_distance * body_pair_cache_distance;
 	float body_pair_cache_angle = GLOBAL_GET("physics/jolt_physics_3d/simulation/body_pair_contact_cache_angle_threshold");
 	body_pair_cache_angle_cos_div2 = Math::cos(body_pair_cache_angle / 2.0f);
+	job_dispatch_mode = (JoltJobDispatchMode)(int)GLOBAL_GET("physics/jolt_physics_3d/simulation/job_dispatch_mode");
 
 	use_enhanced_internal_edge_removal_for_queries = GLOBAL_GET("physics/jolt_physics_3d/queries/use_enhanced_internal_edge_removal");
 	enable_ray_cast_face_index = GLOBAL_GET("physics/jolt_physics_3d/queries/enable_ray_cast_face_index");
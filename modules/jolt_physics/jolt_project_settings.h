@@ -37,6 +37,11 @@ enum JoltJointWorldNode : int {
 	JOLT_JOINT_WORLD_NODE_B,
 };
 
+enum JoltJobDispatchMode : int {
+	JOLT_JOB_DISPATCH_MODE_WORKER_THREAD_POOL,
+	JOLT_JOB_DISPATCH_MODE_DEDICATED_THREADS,
+};
+
 class JoltProjectSettings {
 public:
 	inline static int simulation_velocity_steps;
@@ -57,6 +62,7 @@ public:
 	inline static bool body_pair_contact_cache_enabled;
 	inline static float body_pair_cache_distance_sq;
 	inline static float body_pair_cache_angle_cos_div2;
+	inline static JoltJobDispatchMode job_dispatch_mode;
 
 	inline static bool use_enhanced_internal_edge_removal_for_queries;
 	inline static bool enable_ray_cast_face_index;
@@ -140,10 +140,19 @@ JPH::JobHandle JoltJobSystem::CreateJob(const char *p_name, JPH::ColorArg p_colo
 }
 
 void JoltJobSystem::QueueJob(JPH::JobSystem::Job *p_job) {
-	static_cast<Job *>(p_job)->queue();
+	if (use_dedicated_threads) {
+		_push_queued_jobs(&p_job, 1);
+	} else {
+		static_cast<Job *>(p_job)->queue();
+	}
 }
 
 void JoltJobSystem::QueueJobs(JPH::JobSystem::Job **p_jobs, JPH::uint p_job_count) {
+	if (use_dedicated_threads) {
+		_push_queued_jobs(p_jobs, p_job_count);
+		return;
+	}
+
 	for (JPH::uint i = 0; i < p_job_count; ++i) {
 		QueueJob(p_jobs[i]);
 	}
@@ -159,10 +168,86 @@ void JoltJobSystem::_reclaim_jobs() {
 	}
 }
 
+void JoltJobSystem::_push_queued_jobs(JPH::JobSystem::Job **p_jobs, JPH::uint p_job_count) {
+	queued_jobs_lock.lock();
+
+	for (JPH::uint i = 0; i < p_job_count; ++i) {
+		// Released by `Job::_execute` once the job has run.
+		p_jobs[i]->AddRef();
+
+		DEV_ASSERT(queued_jobs_count < queued_jobs.size());
+		queued_jobs[(queued_jobs_head + queued_jobs_count) % queued_jobs.size()] = static_cast<Job *>(p_jobs[i]);
+		queued_jobs_count++;
+	}
+
+	queued_jobs_lock.unlock();
+
+	queued_jobs_semaphore.post(p_job_count);
+}
+
+JoltJobSystem::Job *JoltJobSystem::_pop_queued_job() {
+	queued_jobs_lock.lock();
+
+	DEV_ASSERT(queued_jobs_count > 0);
+	Job *job = queued_jobs[queued_jobs_head];
+	queued_jobs_head = (queued_jobs_head + 1) % queued_jobs.size();
+	queued_jobs_count--;
+
+	queued_jobs_lock.unlock();
+
+	return job;
+}
+
+void JoltJobSystem::_thread_loop(void *p_user_data) {
+	JoltJobSystem *job_system = static_cast<JoltJobSystem *>(p_user_data);
+
+	Thread::set_name("Jolt Physics");
+
+	while (true) {
+		job_system->queued_jobs_semaphore.wait();
+
+		if (job_system->exiting.load(std::memory_order_acquire)) {
+			break;
+		}
+
+		Job::_execute(job_system->_pop_queued_job());
+	}
+}
+
 JoltJobSystem::JoltJobSystem() :
 		JPH::JobSystemWithBarrier(JPH::cMaxPhysicsBarriers),
 		thread_count(MAX(1, WorkerThreadPool::get_singleton()->get_thread_count())) {
 	jobs.Init(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsJobs);
+
+#ifdef THREADS_ENABLED
+	use_dedicated_threads = JoltProjectSettings::job_dispatch_mode == JOLT_JOB_DISPATCH_MODE_DEDICATED_THREADS;
+#endif
+
+	if (use_dedicated_threads) {
+		// Jolt creates lots of tiny jobs, which this lets us hand to threads of our own without going through
+		// the task bookkeeping of `WorkerThreadPool`. Barriers still help out with their jobs while waiting.
+		queued_jobs.resize(JPH::cMaxPhysicsJobs);
+
+		for (int i = 0; i < thread_count; ++i) {
+			Thread *thread = memnew(Thread);
+			thread->start(&_thread_loop, this);
+			threads.push_back(thread);
+		}
+	}
+}
+
+JoltJobSystem::~JoltJobSystem() {
+	if (threads.is_empty()) {
+		return;
+	}
+
+	exiting.store(true, std::memory_order_release);
+	queued_jobs_semaphore.post(threads.size());
+
+	for (Thread *thread : threads) {
+		thread->wait_to_finish();
+		memdelete(thread);
+	}
 }
 
 void JoltJobSystem::pre_step() {
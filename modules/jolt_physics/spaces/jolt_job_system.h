@@ -30,8 +30,11 @@
 
 #pragma once
 
+#include "core/os/semaphore.h"
 #include "core/os/spin_lock.h"
+#include "core/os/thread.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 
 #include "Jolt/Jolt.h"
 
@@ -42,6 +45,8 @@
 
 class JoltJobSystem final : public JPH::JobSystemWithBarrier {
 	class Job : public JPH::JobSystem::Job {
+		friend class JoltJobSystem;
+
 		inline static std::atomic<Job *> completed_head = nullptr;
 
 #ifdef DEBUG_ENABLED
@@ -80,7 +85,19 @@ class JoltJobSystem final : public JPH::JobSystemWithBarrier {
 
 	JPH::FixedSizeFreeList<Job> jobs;
 
+	// Jobs waiting for one of the dedicated threads, in a ring buffer that can hold every job at once.
+	// Each queued job posts the semaphore once, so a woken thread always finds a job to run.
+	LocalVector<Job *> queued_jobs;
+	uint32_t queued_jobs_head = 0;
+	uint32_t queued_jobs_count = 0;
+	SpinLock queued_jobs_lock;
+	Semaphore queued_jobs_semaphore;
+
+	LocalVector<Thread *> threads;
+	std::atomic<bool> exiting = false;
+
 	int thread_count = 0;
+	bool use_dedicated_threads = false;
 
 	virtual int GetMaxConcurrency() const override;
 
@@ -91,8 +108,14 @@ class JoltJobSystem final : public JPH::JobSystemWithBarrier {
 
 	void _reclaim_jobs();
 
+	void _push_queued_jobs(JPH::JobSystem::Job **p_jobs, JPH::uint p_job_count);
+	Job *_pop_queued_job();
+
+	static void _thread_loop(void *p_user_data);
+
 public:
 	JoltJobSystem();
+	~JoltJobSystem();
 
 	void pre_step();
 	void post_step();
@@ -44,6 +44,8 @@
 #include "jolt_query_filter_3d.h"
 #include "jolt_space_3d.h"
 
+#include "core/object/worker_thread_pool.h"
+
 #include "Jolt/Geometry/GJKClosestPoint.h"
 #include "Jolt/Physics/Body/Body.h"
 #include "Jolt/Physics/Body/BodyFilter.h"
@@ -392,7 +394,7 @@ bool JoltPhysicsDirectSpaceState3D::_body_motion_collide(const JoltBody3D &p_bod
 	return count > 0;
 }
 
-int JoltPhysicsDirectSpaceState3D::_try_get_face_index(const JPH::Body &p_body, const JPH::SubShapeID &p_sub_shape_id) {
+int JoltPhysicsDirectSpaceState3D::_try_get_face_index(const JPH::Body &p_body, const JPH::SubShapeID &p_sub_shape_id) const {
 	if (!JoltProjectSettings::enable_ray_cast_face_index) {
 		return -1;
 	}
@@ -461,15 +463,9 @@ JoltPhysicsDirectSpaceState3D::JoltPhysicsDirectSpaceState3D(JoltSpace3D *p_spac
 		space(p_space) {
 }
 
-bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
-	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "intersect_ray must not be called while the physics space is being stepped.");
-
-	space->try_optimize();
-
-	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude, p_parameters.pick_ray);
-
-	const JPH::RVec3 from = to_jolt_r(p_parameters.from);
-	const JPH::RVec3 to = to_jolt_r(p_parameters.to);
+bool JoltPhysicsDirectSpaceState3D::_intersect_ray(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, const JoltQueryFilter3D &p_query_filter, RayResult &r_result) const {
+	const JPH::RVec3 from = to_jolt_r(p_from);
+	const JPH::RVec3 to = to_jolt_r(p_to);
 	const JPH::Vec3 vector = JPH::Vec3(to - from);
 	const JPH::RRayCast ray(from, vector);
 
@@ -480,7 +476,7 @@ bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_paramet
 	settings.mBackFaceModeTriangles = back_face_mode;
 
 	JoltQueryCollectorClosest<JPH::CastRayCollector> collector;
-	space->get_narrow_phase_query().CastRay(ray, settings, collector, query_filter, query_filter, query_filter);
+	space->get_narrow_phase_query().CastRay(ray, settings, collector, p_query_filter, p_query_filter, p_query_filter);
 
 	if (!collector.had_hit()) {
 		return false;
@@ -524,6 +520,16 @@ bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_paramet
 	return true;
 }
 
+bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
+	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "intersect_ray must not be called while the physics space is being stepped.");
+
+	space->try_optimize();
+
+	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude, p_parameters.pick_ray);
+
+	return _intersect_ray(p_parameters, p_parameters.from, p_parameters.to, query_filter, r_result);
+}
+
 int JoltPhysicsDirectSpaceState3D::intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
 	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "intersect_point must not be called while the physics space is being stepped.");
 
@@ -619,6 +625,23 @@ int JoltPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_para
 	return hit_count;
 }
 
+void JoltPhysicsDirectSpaceState3D::_cast_motion(const ShapeParameters &p_parameters, const JPH::ShapeRefC &p_jolt_shape, const Transform3D &p_transform, const Vector3 &p_motion, const JoltQueryFilter3D &p_query_filter, real_t &r_closest_safe, real_t &r_closest_unsafe) const {
+	Transform3D transform = p_transform;
+	JOLT_ENSURE_SCALE_NOT_ZERO(transform, "cast_motion (maybe from ShapeCast3D?) was passed an invalid transform.");
+
+	Vector3 scale;
+	JoltMath::decompose(transform, scale);
+	JOLT_ENSURE_SCALE_VALID(p_jolt_shape, scale, "cast_motion (maybe from ShapeCast3D?) was passed an invalid transform.");
+
+	const Vector3 com_scaled = to_godot(p_jolt_shape->GetCenterOfMass());
+	Transform3D transform_com = transform.translated_local(com_scaled);
+
+	JPH::CollideShapeSettings settings;
+	settings.mMaxSeparationDistance = (float)p_parameters.margin;
+
+	_cast_motion_impl(*p_jolt_shape, transform_com, scale, p_motion, JoltProjectSettings::use_enhanced_internal_edge_removal_for_queries, true, settings, p_query_filter, p_query_filter, p_query_filter, JPH::ShapeFilter(), r_closest_safe, r_closest_unsafe);
+}
+
 bool JoltPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parameters, real_t &r_closest_safe, real_t &r_closest_unsafe, ShapeRestInfo *r_info) {
 	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "cast_motion must not be called while the physics space is being stepped.");
 	ERR_FAIL_COND_V_MSG(r_info != nullptr, false, "Providing rest info as part of cast_motion is not supported when using Jolt Physics.");
@@ -631,21 +654,8 @@ bool JoltPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_paramet
 	const JPH::ShapeRefC jolt_shape = shape->try_build();
 	ERR_FAIL_NULL_V(jolt_shape, false);
 
-	Transform3D transform = p_parameters.transform;
-	JOLT_ENSURE_SCALE_NOT_ZERO(transform, "cast_motion (maybe from ShapeCast3D?) was passed an invalid transform.");
-
-	Vector3 scale;
-	JoltMath::decompose(transform, scale);
-	JOLT_ENSURE_SCALE_VALID(jolt_shape, scale, "cast_motion (maybe from ShapeCast3D?) was passed an invalid transform.");
-
-	const Vector3 com_scaled = to_godot(jolt_shape->GetCenterOfMass());
-	Transform3D transform_com = transform.translated_local(com_scaled);
-
-	JPH::CollideShapeSettings settings;
-	settings.mMaxSeparationDistance = (float)p_parameters.margin;
-
 	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude);
-	_cast_motion_impl(*jolt_shape, transform_com, scale, p_parameters.motion, JoltProjectSettings::use_enhanced_internal_edge_removal_for_queries, true, settings, query_filter, query_filter, query_filter, JPH::ShapeFilter(), r_closest_safe, r_closest_unsafe);
+	_cast_motion(p_parameters, jolt_shape, p_parameters.transform, p_parameters.motion, query_filter, r_closest_safe, r_closest_unsafe);
 
 	return true;
 }
@@ -911,3 +921,97 @@ bool JoltPhysicsDirectSpaceState3D::body_test_motion(const JoltBody3D &p_body, c
 
 	return collided;
 }
+
+void JoltPhysicsDirectSpaceState3D::_intersect_ray_batch_chunk(uint32_t p_chunk, const RayBatch *p_batch) {
+	const int begin = p_chunk * BATCH_CHUNK_SIZE;
+	const int end = MIN(begin + BATCH_CHUNK_SIZE, p_batch->count);
+	for (int i = begin; i < end; i++) {
+		const Vector3 &from = p_batch->from_to[i * 2 + 0];
+		const Vector3 &to = p_batch->from_to[i * 2 + 1];
+		p_batch->hits[i] = _intersect_ray(*p_batch->parameters, from, to, *p_batch->query_filter, p_batch->results[i]);
+	}
+}
+
+void JoltPhysicsDirectSpaceState3D::intersect_ray_batch(const RayParameters &p_parameters, const Vector3 *p_from_to, int p_ray_count, RayResult *r_results, uint8_t *r_hits) {
+	ERR_FAIL_COND_MSG(space->is_stepping(), "intersect_ray_batch must not be called while the physics space is being stepped.");
+
+	if (p_ray_count <= 0) {
+		return;
+	}
+
+	// Jolt's narrow phase queries are safe to run concurrently, as long as nothing modifies the space.
+	space->try_optimize();
+
+	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude, p_parameters.pick_ray);
+
+	RayBatch batch;
+	batch.parameters = &p_parameters;
+	batch.query_filter = &query_filter;
+	batch.from_to = p_from_to;
+	batch.count = p_ray_count;
+	batch.results = r_results;
+	batch.hits = r_hits;
+
+	const int chunk_count = (p_ray_count + BATCH_CHUNK_SIZE - 1) / BATCH_CHUNK_SIZE;
+	if (chunk_count == 1) {
+		// Not worth waking up the thread pool for.
+		_intersect_ray_batch_chunk(0, &batch);
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &JoltPhysicsDirectSpaceState3D::_intersect_ray_batch_chunk, &batch, chunk_count, -1, true, SNAME("JoltIntersectRayBatch"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+void JoltPhysicsDirectSpaceState3D::_cast_motion_batch_chunk(uint32_t p_chunk, const MotionBatch *p_batch) {
+	const int begin = p_chunk * BATCH_CHUNK_SIZE;
+	const int end = MIN(begin + BATCH_CHUNK_SIZE, p_batch->count);
+	for (int i = begin; i < end; i++) {
+		p_batch->closest_safe[i] = 1.0;
+		p_batch->closest_unsafe[i] = 1.0;
+		_cast_motion(*p_batch->parameters, *p_batch->jolt_shape, p_batch->transforms[i], p_batch->motions[i], *p_batch->query_filter, p_batch->closest_safe[i], p_batch->closest_unsafe[i]);
+	}
+}
+
+void JoltPhysicsDirectSpaceState3D::cast_motion_batch(const ShapeParameters &p_parameters, const Transform3D *p_transforms, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) {
+	for (int i = 0; i < p_count; i++) {
+		r_closest_safe[i] = 1.0;
+		r_closest_unsafe[i] = 1.0;
+	}
+
+	ERR_FAIL_COND_MSG(space->is_stepping(), "cast_motion_batch must not be called while the physics space is being stepped.");
+
+	if (p_count <= 0) {
+		return;
+	}
+
+	space->try_optimize();
+
+	JoltShape3D *shape = JoltPhysicsServer3D::get_singleton()->get_shape(p_parameters.shape_rid);
+	ERR_FAIL_NULL(shape);
+
+	const JPH::ShapeRefC jolt_shape = shape->try_build();
+	ERR_FAIL_NULL(jolt_shape);
+
+	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude);
+
+	MotionBatch batch;
+	batch.parameters = &p_parameters;
+	batch.jolt_shape = &jolt_shape;
+	batch.query_filter = &query_filter;
+	batch.transforms = p_transforms;
+	batch.motions = p_motions;
+	batch.count = p_count;
+	batch.closest_safe = r_closest_safe;
+	batch.closest_unsafe = r_closest_unsafe;
+
+	const int chunk_count = (p_count + BATCH_CHUNK_SIZE - 1) / BATCH_CHUNK_SIZE;
+	if (chunk_count == 1) {
+		// Not worth waking up the thread pool for.
+		_cast_motion_batch_chunk(0, &batch);
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &JoltPhysicsDirectSpaceState3D::_cast_motion_batch_chunk, &batch, chunk_count, -1, true, SNAME("JoltCastMotionBatch"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
@@ -43,6 +43,7 @@
 #include "Jolt/Physics/Collision/ShapeFilter.h"
 
 class JoltBody3D;
+class JoltQueryFilter3D;
 class JoltShape3D;
 class JoltSpace3D;
 
@@ -53,13 +54,43 @@ class JoltPhysicsDirectSpaceState3D final : public PhysicsDirectSpaceState3D {
 
 	static void _bind_methods() {}
 
+	enum {
+		BATCH_CHUNK_SIZE = 64, // Batched queries per task, a single query is too small to be worth a task.
+	};
+
+	struct RayBatch {
+		const RayParameters *parameters = nullptr;
+		const JoltQueryFilter3D *query_filter = nullptr;
+		const Vector3 *from_to = nullptr;
+		int count = 0;
+		RayResult *results = nullptr;
+		uint8_t *hits = nullptr;
+	};
+
+	struct MotionBatch {
+		const ShapeParameters *parameters = nullptr;
+		const JPH::ShapeRefC *jolt_shape = nullptr;
+		const JoltQueryFilter3D *query_filter = nullptr;
+		const Transform3D *transforms = nullptr;
+		const Vector3 *motions = nullptr;
+		int count = 0;
+		real_t *closest_safe = nullptr;
+		real_t *closest_unsafe = nullptr;
+	};
+
+	bool _intersect_ray(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, const JoltQueryFilter3D &p_query_filter, RayResult &r_result) const;
+	void _cast_motion(const ShapeParameters &p_parameters, const JPH::ShapeRefC &p_jolt_shape, const Transform3D &p_transform, const Vector3 &p_motion, const JoltQueryFilter3D &p_query_filter, real_t &r_closest_safe, real_t &r_closest_unsafe) const;
+
+	void _intersect_ray_batch_chunk(uint32_t p_chunk, const RayBatch *p_batch);
+	void _cast_motion_batch_chunk(uint32_t p_chunk, const MotionBatch *p_batch);
+
 	bool _cast_motion_impl(const JPH::Shape &p_jolt_shape, const Transform3D &p_transform_com, const Vector3 &p_scale, const Vector3 &p_motion, bool p_use_edge_removal, bool p_ignore_overlaps, const JPH::CollideShapeSettings &p_settings, const JPH::BroadPhaseLayerFilter &p_broad_phase_layer_filter, const JPH::ObjectLayerFilter &p_object_layer_filter, const JPH::BodyFilter &p_body_filter, const JPH::ShapeFilter &p_shape_filter, real_t &r_closest_safe, real_t &r_closest_unsafe) const;
 
 	bool _body_motion_recover(const JoltBody3D &p_body, const Transform3D &p_transform, float p_margin, const HashSet<RID> &p_excluded_bodies, const HashSet<ObjectID> &p_excluded_objects, Vector3 &r_recovery) const;
 	bool _body_motion_cast(const JoltBody3D &p_body, const Transform3D &p_transform, const Vector3 &p_scale, const Vector3 &p_motion, bool p_collide_separation_ray, const HashSet<RID> &p_excluded_bodies, const HashSet<ObjectID> &p_excluded_objects, real_t &r_safe_fraction, real_t &r_unsafe_fraction) const;
 	bool _body_motion_collide(const JoltBody3D &p_body, const Transform3D &p_transform, const Vector3 &p_motion, float p_margin, int p_max_collisions, const HashSet<RID> &p_excluded_bodies, const HashSet<ObjectID> &p_excluded_objects, PhysicsServer3D::MotionResult *r_result) const;
 
-	int _try_get_face_index(const JPH::Body &p_body, const JPH::SubShapeID &p_sub_shape_id);
+	int _try_get_face_index(const JPH::Body &p_body, const JPH::SubShapeID &p_sub_shape_id) const;
 
 	void _generate_manifold(const JPH::CollideShapeResult &p_hit, JPH::ContactPoints &r_contact_points1, JPH::ContactPoints &r_contact_points2 JPH_IF_DEBUG_RENDERER(, JPH::RVec3Arg p_center_of_mass)) const;
 
@@ -78,6 +109,9 @@ public:
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) override;
 	virtual Vector3 get_closest_point_to_object_volume(RID p_object, Vector3 p_point) const override;
 
+	virtual void intersect_ray_batch(const RayParameters &p_parameters, const Vector3 *p_from_to, int p_ray_count, RayResult *r_results, uint8_t *r_hits) override;
+	virtual void cast_motion_batch(const ShapeParameters &p_parameters, const Transform3D *p_transforms, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) override;
+
 	bool body_test_motion(const JoltBody3D &p_body, const PhysicsServer3D::MotionParameters &p_parameters, PhysicsServer3D::MotionResult *r_result) const;
 
 	JoltSpace3D &get_space() const { return *space; }
@@ -174,6 +174,10 @@ void MultiplayerSpawner::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_spawn_function", "spawn_function"), &MultiplayerSpawner::set_spawn_function);
 	ADD_PROPERTY(PropertyInfo(Variant::CALLABLE, "spawn_function", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NONE), "set_spawn_function", "get_spawn_function");
 
+	ClassDB::bind_method(D_METHOD("set_use_instance_pool", "enabled"), &MultiplayerSpawner::set_use_instance_pool);
+	ClassDB::bind_method(D_METHOD("is_using_instance_pool"), &MultiplayerSpawner::is_using_instance_pool);
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_instance_pool"), "set_use_instance_pool", "is_using_instance_pool");
+
 	ADD_SIGNAL(MethodInfo("despawned", PropertyInfo(Variant::OBJECT, "node", PROPERTY_HINT_RESOURCE_TYPE, "Node")));
 	ADD_SIGNAL(MethodInfo("spawned", PropertyInfo(Variant::OBJECT, "node", PROPERTY_HINT_RESOURCE_TYPE, "Node")));
 }
@@ -300,7 +304,20 @@ Node *MultiplayerSpawner::instantiate_scene(int p_id) {
 		sc.cache = ResourceLoader::load(sc.path);
 	}
 	ERR_FAIL_COND_V_MSG(sc.cache.is_null(), nullptr, "Invalid spawnable scene: " + sc.path);
-	return sc.cache->instantiate();
+	return use_instance_pool ? sc.cache->instantiate_pooled() : sc.cache->instantiate();
+}
+
+bool MultiplayerSpawner::release_scene_instance(int p_idx, Node *p_node) {
+	ERR_FAIL_NULL_V(p_node, false);
+	if (!use_instance_pool || p_idx < 0 || (uint32_t)p_idx >= spawnable_scenes.size()) {
+		return false;
+	}
+	SpawnableScene &sc = spawnable_scenes[p_idx];
+	if (sc.cache.is_null()) {
+		return false;
+	}
+	sc.cache->release_instance(p_node);
+	return true;
 }
 
 Node *MultiplayerSpawner::instantiate_custom(const Variant &p_data) {
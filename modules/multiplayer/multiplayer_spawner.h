@@ -67,6 +67,7 @@ private:
 	HashMap<ObjectID, SpawnInfo> tracked_nodes;
 	uint32_t spawn_limit = 0;
 	Callable spawn_function;
+	bool use_instance_pool = false;
 
 	void _update_spawn_node();
 	void _track(Node *p_node, const Variant &p_argument, int p_scene_id = INVALID_ID);
@@ -104,6 +105,8 @@ public:
 	void set_spawn_limit(uint32_t p_limit) { spawn_limit = p_limit; }
 	void set_spawn_function(Callable p_spawn_function) { spawn_function = p_spawn_function; }
 	Callable get_spawn_function() const { return spawn_function; }
+	void set_use_instance_pool(bool p_enabled) { use_instance_pool = p_enabled; }
+	bool is_using_instance_pool() const { return use_instance_pool; }
 
 	const Variant get_spawn_argument(const ObjectID &p_id) const;
 	int find_spawnable_scene_index_from_object(const ObjectID &p_id) const;
@@ -111,6 +114,7 @@ public:
 	Node *spawn(const Variant &p_data = Variant());
 	Node *instantiate_custom(const Variant &p_data);
 	Node *instantiate_scene(int p_idx);
+	bool release_scene_instance(int p_idx, Node *p_node);
 
 	MultiplayerSpawner() {}
 };
@@ -669,10 +669,14 @@ Error SceneReplicationInterface::on_despawn_receive(int p_from, const uint8_t *p
 	ERR_FAIL_NULL_V(spawner, ERR_DOES_NOT_EXIST);
 	ERR_FAIL_COND_V(p_from != spawner->get_multiplayer_authority(), ERR_UNAUTHORIZED);
 
+	// Read before removal, the spawner stops tracking the node when it exits the tree.
+	const int scene_id = spawner->find_spawnable_scene_index_from_object(oid);
 	if (node->get_parent() != nullptr) {
 		node->get_parent()->remove_child(node);
 	}
-	node->queue_free();
+	if (!spawner->release_scene_instance(scene_id, node)) {
+		node->queue_free();
+	}
 	spawner->emit_signal(SNAME("despawned"), node);
 
 	return OK;
@@ -441,6 +441,16 @@ Vector2 GodotNavigationServer2D::map_get_random_point(RID p_map, uint32_t p_navi
 	return map->get_random_point(p_navigation_layers, p_uniformly);
 }
 
+PackedVector2Array GodotNavigationServer2D::map_get_flow_directions(RID p_map, const Vector2 &p_target_position, const PackedVector2Array &p_positions, uint32_t p_navigation_layers) const {
+	const NavMap2D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, PackedVector2Array());
+
+	PackedVector2Array directions;
+	directions.resize(p_positions.size());
+	map->get_flow_directions(p_target_position, p_positions.ptr(), p_positions.size(), p_navigation_layers, directions.ptrw());
+	return directions;
+}
+
 RID GodotNavigationServer2D::region_create() {
 	MutexLock lock(operations_mutex);
 
@@ -1347,6 +1357,15 @@ void GodotNavigationServer2D::query_path(const Ref<NavigationPathQueryParameters
 	NavMeshQueries2D::map_query_path(map, p_query_parameters, p_query_result, p_callback);
 }
 
+Dictionary GodotNavigationServer2D::query_path_batch(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, const PackedVector2Array &p_start_target_positions) {
+	ERR_FAIL_COND_V(p_query_parameters.is_null(), Dictionary());
+
+	NavMap2D *map = map_owner.get_or_null(p_query_parameters->get_map());
+	ERR_FAIL_NULL_V(map, Dictionary());
+
+	return NavMeshQueries2D::map_query_path_batch(map, p_query_parameters, p_start_target_positions);
+}
+
 RID GodotNavigationServer2D::source_geometry_parser_create() {
 	RWLockWrite write_lock(geometry_parser_rwlock);
 
@@ -142,6 +142,7 @@ public:
 	virtual bool map_get_use_async_iterations(RID p_map) const override;
 
 	virtual Vector2 map_get_random_point(RID p_map, uint32_t p_navigation_layers, bool p_uniformly) const override;
+	virtual PackedVector2Array map_get_flow_directions(RID p_map, const Vector2 &p_target_position, const PackedVector2Array &p_positions, uint32_t p_navigation_layers = 1) const override;
 
 	virtual RID region_create() override;
 	virtual uint32_t region_get_iteration_id(RID p_region) const override;
@@ -315,6 +316,7 @@ public:
 	virtual uint32_t obstacle_get_avoidance_layers(RID p_obstacle) const override;
 
 	virtual void query_path(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback = Callable()) override;
+	virtual Dictionary query_path_batch(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, const PackedVector2Array &p_start_target_positions) override;
 
 	COMMAND_1(free, RID, p_object);
 
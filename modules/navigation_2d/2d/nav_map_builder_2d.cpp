@@ -391,6 +391,12 @@ void NavMapBuilder2D::_build_update_map_iteration(NavMapIterationBuild2D &r_buil
 
 	map_iteration->navmesh_polygon_count = r_build.polygon_count;
 
+	map_iteration->flow_field_cache_mutex.lock();
+	map_iteration->flow_field_cache.clear();
+	map_iteration->flow_field_cache.set_capacity(NavMapIteration2D::FLOW_FIELD_CACHE_SIZE);
+	map_iteration->polygon_lookup_grid.clear();
+	map_iteration->flow_field_cache_mutex.unlock();
+
 	map_iteration->path_query_slots_mutex.lock();
 	for (NavMeshQueries2D::PathQuerySlot &p_path_query_slot : map_iteration->path_query_slots) {
 		p_path_query_slot.traversable_polys.clear();
@@ -36,6 +36,7 @@
 
 #include "core/math/math_defs.h"
 #include "core/os/semaphore.h"
+#include "core/templates/lru.h"
 
 struct NavLinkIteration2D;
 class NavRegion2D;
@@ -71,6 +72,8 @@ struct NavMapIterationBuild2D {
 };
 
 struct NavMapIteration2D {
+	static constexpr uint32_t FLOW_FIELD_CACHE_SIZE = 8;
+
 	mutable SafeNumeric<uint32_t> users;
 	RWLock rwlock;
 
@@ -84,6 +87,12 @@ struct NavMapIteration2D {
 
 	HashMap<NavRegion2D *, uint32_t> region_ptr_to_region_id;
 
+	// Flow fields of earlier queries, keyed by their goal polygon, and the grid used to find the polygons of sampled positions.
+	// Both are built on demand and cleared whenever the iteration is rebuilt.
+	mutable LRUCache<Nav2D::FlowFieldKey, Nav2D::FlowField, Nav2D::FlowFieldKey> flow_field_cache;
+	mutable Nav2D::PolygonLookupGrid polygon_lookup_grid;
+	mutable Mutex flow_field_cache_mutex;
+
 	LocalVector<NavMeshQueries2D::PathQuerySlot> path_query_slots;
 	Mutex path_query_slots_mutex;
 	Semaphore path_query_slots_semaphore;
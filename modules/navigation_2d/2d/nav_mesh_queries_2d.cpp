@@ -31,6 +31,7 @@
 #include "nav_mesh_queries_2d.h"
 
 #include "../nav_base_2d.h"
+#include "../nav_link_2d.h"
 #include "../nav_map_2d.h"
 #include "../triangle2.h"
 #include "nav_region_iteration_2d.h"
@@ -146,18 +147,12 @@ void NavMeshQueries2D::_query_task_push_back_point_with_metadata(NavMeshPathQuer
 	p_query_task.path_points.push_back(p_point);
 }
 
-void NavMeshQueries2D::map_query_path(NavMap2D *p_map, const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback) {
-	ERR_FAIL_NULL(p_map);
-	ERR_FAIL_COND(p_query_parameters.is_null());
-	ERR_FAIL_COND(p_query_result.is_null());
-
+void NavMeshQueries2D::query_task_set_parameters(NavMeshPathQueryTask2D &r_query_task, const Ref<NavigationPathQueryParameters2D> &p_query_parameters) {
 	using namespace NavigationUtilities;
 
-	NavMeshQueries2D::NavMeshPathQueryTask2D query_task;
-	query_task.start_position = p_query_parameters->get_start_position();
-	query_task.target_position = p_query_parameters->get_target_position();
-	query_task.navigation_layers = p_query_parameters->get_navigation_layers();
-	query_task.callback = p_callback;
+	r_query_task.start_position = p_query_parameters->get_start_position();
+	r_query_task.target_position = p_query_parameters->get_target_position();
+	r_query_task.navigation_layers = p_query_parameters->get_navigation_layers();
 
 	const TypedArray<RID> &_excluded_regions = p_query_parameters->get_excluded_regions();
 	const TypedArray<RID> &_included_regions = p_query_parameters->get_included_regions();
@@ -165,52 +160,62 @@ void NavMeshQueries2D::map_query_path(NavMap2D *p_map, const Ref<NavigationPathQ
 	uint32_t _excluded_region_count = _excluded_regions.size();
 	uint32_t _included_region_count = _included_regions.size();
 
-	query_task.exclude_regions = _excluded_region_count > 0;
-	query_task.include_regions = _included_region_count > 0;
+	r_query_task.exclude_regions = _excluded_region_count > 0;
+	r_query_task.include_regions = _included_region_count > 0;
 
-	if (query_task.exclude_regions) {
-		query_task.excluded_regions.resize(_excluded_region_count);
+	if (r_query_task.exclude_regions) {
+		r_query_task.excluded_regions.resize(_excluded_region_count);
 		for (uint32_t i = 0; i < _excluded_region_count; i++) {
-			query_task.excluded_regions[i] = _excluded_regions[i];
+			r_query_task.excluded_regions[i] = _excluded_regions[i];
 		}
 	}
 
-	if (query_task.include_regions) {
-		query_task.included_regions.resize(_included_region_count);
+	if (r_query_task.include_regions) {
+		r_query_task.included_regions.resize(_included_region_count);
 		for (uint32_t i = 0; i < _included_region_count; i++) {
-			query_task.included_regions[i] = _included_regions[i];
+			r_query_task.included_regions[i] = _included_regions[i];
 		}
 	}
 
 	switch (p_query_parameters->get_pathfinding_algorithm()) {
 		case NavigationPathQueryParameters2D::PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR: {
-			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+			r_query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
 		} break;
 		default: {
 			WARN_PRINT("No match for used PathfindingAlgorithm - fallback to default");
-			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+			r_query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
 		} break;
 	}
 
 	switch (p_query_parameters->get_path_postprocessing()) {
 		case NavigationPathQueryParameters2D::PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
+			r_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
 		} break;
 		case NavigationPathQueryParameters2D::PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED;
+			r_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED;
 		} break;
 		case NavigationPathQueryParameters2D::PathPostProcessing::PATH_POSTPROCESSING_NONE: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_NONE;
+			r_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_NONE;
 		} break;
 		default: {
 			WARN_PRINT("No match for used PathPostProcessing - fallback to default");
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
+			r_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
 		} break;
 	}
 
-	query_task.metadata_flags = (int64_t)p_query_parameters->get_metadata_flags();
-	query_task.simplify_path = p_query_parameters->get_simplify_path();
-	query_task.simplify_epsilon = p_query_parameters->get_simplify_epsilon();
+	r_query_task.metadata_flags = (int64_t)p_query_parameters->get_metadata_flags();
+	r_query_task.simplify_path = p_query_parameters->get_simplify_path();
+	r_query_task.simplify_epsilon = p_query_parameters->get_simplify_epsilon();
+}
+
+void NavMeshQueries2D::map_query_path(NavMap2D *p_map, const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback) {
+	ERR_FAIL_NULL(p_map);
+	ERR_FAIL_COND(p_query_parameters.is_null());
+	ERR_FAIL_COND(p_query_result.is_null());
+
+	NavMeshQueries2D::NavMeshPathQueryTask2D query_task;
+	query_task_set_parameters(query_task, p_query_parameters);
+	query_task.callback = p_callback;
 	query_task.status = NavMeshPathQueryTask2D::TaskStatus::QUERY_STARTED;
 
 	p_map->query_path(query_task);
@@ -230,6 +235,47 @@ void NavMeshQueries2D::map_query_path(NavMap2D *p_map, const Ref<NavigationPathQ
 	}
 }
 
+Dictionary NavMeshQueries2D::map_query_path_batch(NavMap2D *p_map, const Ref<NavigationPathQueryParameters2D> &p_query_parameters, const PackedVector2Array &p_start_target_positions) {
+	ERR_FAIL_NULL_V(p_map, Dictionary());
+	ERR_FAIL_COND_V(p_query_parameters.is_null(), Dictionary());
+	ERR_FAIL_COND_V_MSG(p_start_target_positions.size() % 2 != 0, Dictionary(), "Path queries must be given as pairs of positions, start and target.");
+
+	const uint32_t query_count = p_start_target_positions.size() / 2;
+
+	NavMeshQueries2D::NavMeshPathQueryTask2D query_template;
+	query_task_set_parameters(query_template, p_query_parameters);
+	// Batched queries only return the path points.
+	query_template.metadata_flags = 0;
+
+	LocalVector<LocalVector<Vector2>> paths;
+	p_map->query_path_batch(query_template, p_start_target_positions.ptr(), query_count, paths);
+
+	PackedInt32Array path_offsets;
+	path_offsets.resize(query_count + 1);
+	int32_t *path_offsets_ptr = path_offsets.ptrw();
+	int32_t path_point_count = 0;
+	for (uint32_t i = 0; i < query_count; i++) {
+		path_offsets_ptr[i] = path_point_count;
+		path_point_count += paths[i].size();
+	}
+	path_offsets_ptr[query_count] = path_point_count;
+
+	PackedVector2Array path_points;
+	path_points.resize(path_point_count);
+	Vector2 *path_points_ptr = path_points.ptrw();
+	for (uint32_t i = 0; i < query_count; i++) {
+		if (!paths[i].is_empty()) {
+			memcpy(path_points_ptr + path_offsets_ptr[i], paths[i].ptr(), paths[i].size() * sizeof(Vector2));
+		}
+	}
+
+	Dictionary d;
+	d["path_points"] = path_points;
+	d["path_offsets"] = path_offsets;
+
+	return d;
+}
+
 void NavMeshQueries2D::_query_task_find_start_end_positions(NavMeshPathQueryTask2D &p_query_task, const NavMapIteration2D &p_map_iteration) {
 	real_t begin_d = FLT_MAX;
 	real_t end_d = FLT_MAX;
@@ -856,6 +902,331 @@ Vector2 NavMeshQueries2D::map_iteration_get_random_point(const NavMapIteration2D
 	}
 }
 
+static Vector2 _polygon_get_closest_point(const Polygon &p_polygon, const Vector2 &p_point) {
+	Vector2 closest_point;
+	real_t closest_distance_squared = FLT_MAX;
+	for (uint32_t point_id = 2; point_id < p_polygon.vertices.size(); point_id++) {
+		const Triangle2 triangle(p_polygon.vertices[0], p_polygon.vertices[point_id - 1], p_polygon.vertices[point_id]);
+		const Vector2 point = triangle.get_closest_point_to(p_point);
+		const real_t distance_squared = point.distance_squared_to(p_point);
+		if (distance_squared < closest_distance_squared) {
+			closest_point = point;
+			closest_distance_squared = distance_squared;
+		}
+	}
+	return closest_point;
+}
+
+void NavMeshQueries2D::map_iteration_build_polygon_lookup_grid(const NavMapIteration2D &p_map_iteration, PolygonLookupGrid &r_grid) {
+	r_grid.clear();
+	r_grid.built = true;
+
+	Rect2 bounds;
+	uint32_t polygon_count = 0;
+	for (const NavRegionIteration2D &region : p_map_iteration.region_iterations) {
+		if (!region.get_enabled()) {
+			continue;
+		}
+		for (const Polygon &polygon : region.get_navmesh_polygons()) {
+			if (polygon_count == 0) {
+				bounds.position = polygon.vertices[0];
+			}
+			for (const Vector2 &vertex : polygon.vertices) {
+				bounds.expand_to(vertex);
+			}
+			polygon_count++;
+		}
+	}
+
+	if (polygon_count == 0) {
+		return;
+	}
+
+	// Aim for about one polygon per cell.
+	r_grid.origin = bounds.position;
+	r_grid.cell_size = MAX(Math::sqrt(bounds.size.x * bounds.size.y / polygon_count), real_t(0.01));
+	r_grid.size = Vector2i(int(bounds.size.x / r_grid.cell_size) + 1, int(bounds.size.y / r_grid.cell_size) + 1);
+
+	const uint32_t cell_count = r_grid.size.x * r_grid.size.y;
+	r_grid.cell_offsets.resize(cell_count + 1);
+	for (uint32_t &cell_offset : r_grid.cell_offsets) {
+		cell_offset = 0;
+	}
+
+	// Count the polygons of each cell first, then fill them in.
+	for (uint32_t pass = 0; pass < 2; pass++) {
+		for (const NavRegionIteration2D &region : p_map_iteration.region_iterations) {
+			if (!region.get_enabled()) {
+				continue;
+			}
+			for (const Polygon &polygon : region.get_navmesh_polygons()) {
+				Vector2 polygon_min = polygon.vertices[0];
+				Vector2 polygon_max = polygon.vertices[0];
+				for (const Vector2 &vertex : polygon.vertices) {
+					polygon_min = polygon_min.min(vertex);
+					polygon_max = polygon_max.max(vertex);
+				}
+
+				const int min_x = CLAMP(int((polygon_min.x - r_grid.origin.x) / r_grid.cell_size), 0, r_grid.size.x - 1);
+				const int min_z = CLAMP(int((polygon_min.y - r_grid.origin.y) / r_grid.cell_size), 0, r_grid.size.y - 1);
+				const int max_x = CLAMP(int((polygon_max.x - r_grid.origin.x) / r_grid.cell_size), 0, r_grid.size.x - 1);
+				const int max_z = CLAMP(int((polygon_max.y - r_grid.origin.y) / r_grid.cell_size), 0, r_grid.size.y - 1);
+
+				for (int z = min_z; z <= max_z; z++) {
+					for (int x = min_x; x <= max_x; x++) {
+						const uint32_t cell_index = z * r_grid.size.x + x;
+						if (pass == 0) {
+							r_grid.cell_offsets[cell_index + 1]++;
+						} else {
+							r_grid.cell_polygons[r_grid.cell_offsets[cell_index]++] = &polygon;
+						}
+					}
+				}
+			}
+		}
+
+		if (pass == 0) {
+			for (uint32_t cell_index = 0; cell_index < cell_count; cell_index++) {
+				r_grid.cell_offsets[cell_index + 1] += r_grid.cell_offsets[cell_index];
+			}
+			r_grid.cell_polygons.resize(r_grid.cell_offsets[cell_count]);
+		} else {
+			// Filling advanced each offset to the start of the next cell.
+			for (uint32_t cell_index = cell_count; cell_index > 0; cell_index--) {
+				r_grid.cell_offsets[cell_index] = r_grid.cell_offsets[cell_index - 1];
+			}
+			r_grid.cell_offsets[0] = 0;
+		}
+	}
+}
+
+const Polygon *NavMeshQueries2D::polygon_lookup_grid_get_polygon(const PolygonLookupGrid &p_grid, const Vector2 &p_point, uint32_t p_navigation_layers, Vector2 &r_closest_point) {
+	if (p_grid.cell_polygons.is_empty()) {
+		return nullptr;
+	}
+
+	const int cell_x = int(Math::floor((p_point.x - p_grid.origin.x) / p_grid.cell_size));
+	const int cell_z = int(Math::floor((p_point.y - p_grid.origin.y) / p_grid.cell_size));
+
+	const Polygon *closest_polygon = nullptr;
+	real_t closest_distance_squared = FLT_MAX;
+
+	// Also search the neighbor cells so that points just off the navigation mesh still find their polygon.
+	for (int z = MAX(cell_z - 1, 0); z <= MIN(cell_z + 1, p_grid.size.y - 1); z++) {
+		for (int x = MAX(cell_x - 1, 0); x <= MIN(cell_x + 1, p_grid.size.x - 1); x++) {
+			const uint32_t cell_index = z * p_grid.size.x + x;
+			for (uint32_t i = p_grid.cell_offsets[cell_index]; i < p_grid.cell_offsets[cell_index + 1]; i++) {
+				const Polygon *polygon = p_grid.cell_polygons[i];
+				if ((polygon->owner->get_navigation_layers() & p_navigation_layers) == 0) {
+					continue;
+				}
+
+				const Vector2 point = _polygon_get_closest_point(*polygon, p_point);
+				const real_t distance_squared = point.distance_squared_to(p_point);
+				if (distance_squared < closest_distance_squared) {
+					closest_polygon = polygon;
+					closest_distance_squared = distance_squared;
+					r_closest_point = point;
+				}
+			}
+		}
+	}
+
+	return closest_polygon;
+}
+
+void NavMeshQueries2D::map_iteration_build_flow_field(const NavMapIteration2D &p_map_iteration, const Polygon *p_goal_polygon, uint32_t p_navigation_layers, FlowField &r_flow_field) {
+	const uint32_t polygon_count = p_map_iteration.navmesh_polygon_count;
+
+	r_flow_field.goal_polygon = p_goal_polygon;
+	r_flow_field.pathway_starts.resize(polygon_count);
+	r_flow_field.pathway_ends.resize(polygon_count);
+	r_flow_field.next_polygon_ids.resize(polygon_count);
+	r_flow_field.distances.resize(polygon_count);
+	for (uint32_t polygon_id = 0; polygon_id < polygon_count; polygon_id++) {
+		r_flow_field.next_polygon_ids[polygon_id] = UINT32_MAX;
+		r_flow_field.distances[polygon_id] = FLT_MAX;
+	}
+
+	// Connections are directed, so the search from the goal follows them backwards.
+	struct IncomingConnection {
+		const Polygon *polygon = nullptr;
+		Vector2 pathway_start;
+		Vector2 pathway_end;
+	};
+
+	LocalVector<uint32_t> incoming_offsets;
+	incoming_offsets.resize(polygon_count + 1);
+	for (uint32_t &incoming_offset : incoming_offsets) {
+		incoming_offset = 0;
+	}
+	LocalVector<IncomingConnection> incoming_connections;
+
+	LocalVector<const LocalVector<Polygon> *> polygon_sets;
+	polygon_sets.reserve(p_map_iteration.region_iterations.size() + p_map_iteration.link_iterations.size());
+	for (const NavRegionIteration2D &region : p_map_iteration.region_iterations) {
+		polygon_sets.push_back(&region.get_navmesh_polygons());
+	}
+	for (const NavLinkIteration2D &link : p_map_iteration.link_iterations) {
+		polygon_sets.push_back(&link.get_navmesh_polygons());
+	}
+
+	for (uint32_t pass = 0; pass < 2; pass++) {
+		for (const LocalVector<Polygon> *polygons : polygon_sets) {
+			for (const Polygon &polygon : *polygons) {
+				if ((polygon.owner->get_navigation_layers() & p_navigation_layers) == 0) {
+					continue;
+				}
+				for (const Edge &edge : polygon.edges) {
+					for (const Edge::Connection &connection : edge.connections) {
+						if (pass == 0) {
+							incoming_offsets[connection.polygon->id + 1]++;
+						} else {
+							IncomingConnection &incoming_connection = incoming_connections[incoming_offsets[connection.polygon->id]++];
+							incoming_connection.polygon = &polygon;
+							incoming_connection.pathway_start = connection.pathway_start;
+							incoming_connection.pathway_end = connection.pathway_end;
+						}
+					}
+				}
+			}
+		}
+
+		if (pass == 0) {
+			for (uint32_t polygon_id = 0; polygon_id < polygon_count; polygon_id++) {
+				incoming_offsets[polygon_id + 1] += incoming_offsets[polygon_id];
+			}
+			incoming_connections.resize(incoming_offsets[polygon_count]);
+		} else {
+			for (uint32_t polygon_id = polygon_count; polygon_id > 0; polygon_id--) {
+				incoming_offsets[polygon_id] = incoming_offsets[polygon_id - 1];
+			}
+			incoming_offsets[0] = 0;
+		}
+	}
+
+	LocalVector<NavigationPoly> navigation_polys;
+	navigation_polys.resize(polygon_count);
+	for (NavigationPoly &navigation_poly : navigation_polys) {
+		navigation_poly.reset();
+	}
+
+	Heap<NavigationPoly *, NavPolyTravelCostGreaterThan, NavPolyHeapIndexer> traversable_polys;
+	traversable_polys.reserve(polygon_count * 0.25);
+
+	Vector2 goal_center;
+	for (const Vector2 &vertex : p_goal_polygon->vertices) {
+		goal_center += vertex;
+	}
+	goal_center /= p_goal_polygon->vertices.size();
+
+	// The `entry` of each polygon is the middle of the pathway it is left through towards the goal.
+	NavigationPoly &goal_poly = navigation_polys[p_goal_polygon->id];
+	goal_poly.poly = p_goal_polygon;
+	goal_poly.entry = goal_center;
+	goal_poly.traveled_distance = 0.0;
+	traversable_polys.push(&goal_poly);
+	r_flow_field.distances[p_goal_polygon->id] = 0.0;
+
+	while (!traversable_polys.is_empty()) {
+		const NavigationPoly *least_cost_poly = traversable_polys.pop();
+		const Polygon *polygon = least_cost_poly->poly;
+		const real_t polygon_travel_cost = polygon->owner->get_travel_cost();
+
+		for (uint32_t i = incoming_offsets[polygon->id]; i < incoming_offsets[polygon->id + 1]; i++) {
+			const IncomingConnection &incoming_connection = incoming_connections[i];
+			const Vector2 pathway_center = (incoming_connection.pathway_start + incoming_connection.pathway_end) * 0.5;
+
+			real_t traveled_distance = least_cost_poly->traveled_distance + pathway_center.distance_to(least_cost_poly->entry) * polygon_travel_cost;
+			if (incoming_connection.polygon->owner != polygon->owner) {
+				traveled_distance += polygon->owner->get_enter_cost();
+			}
+
+			NavigationPoly &neighbor_poly = navigation_polys[incoming_connection.polygon->id];
+			if (traveled_distance >= neighbor_poly.traveled_distance) {
+				continue;
+			}
+
+			neighbor_poly.traveled_distance = traveled_distance;
+			neighbor_poly.entry = pathway_center;
+
+			const uint32_t neighbor_id = incoming_connection.polygon->id;
+			r_flow_field.pathway_starts[neighbor_id] = incoming_connection.pathway_start;
+			r_flow_field.pathway_ends[neighbor_id] = incoming_connection.pathway_end;
+			r_flow_field.next_polygon_ids[neighbor_id] = polygon->id;
+			r_flow_field.distances[neighbor_id] = traveled_distance;
+
+			if (neighbor_poly.traversable_poly_index != traversable_polys.INVALID_INDEX) {
+				traversable_polys.shift(neighbor_poly.traversable_poly_index);
+			} else {
+				neighbor_poly.poly = incoming_connection.polygon;
+				traversable_polys.push(&neighbor_poly);
+			}
+		}
+	}
+}
+
+Vector2 NavMeshQueries2D::flow_field_get_direction(const FlowField &p_flow_field, const Polygon *p_polygon, const Vector2 &p_position, const Vector2 &p_target_position) {
+	uint32_t polygon_id = p_polygon->id;
+	// Positions right on a pathway move on with the pathway of the polygon that follows.
+	for (uint32_t step = 0; step < 2; step++) {
+		if (polygon_id == p_flow_field.goal_polygon->id) {
+			return (p_target_position - p_position).normalized();
+		}
+		if (p_flow_field.next_polygon_ids[polygon_id] == UINT32_MAX) {
+			// The goal can not be reached from here.
+			return Vector2();
+		}
+
+		const Vector2 pathway_point = Geometry2D::get_closest_point_to_segment(p_position, p_flow_field.pathway_starts[polygon_id], p_flow_field.pathway_ends[polygon_id]);
+		const Vector2 direction = pathway_point - p_position;
+		if (direction.length_squared() > CMP_EPSILON2) {
+			return direction.normalized();
+		}
+		polygon_id = p_flow_field.next_polygon_ids[polygon_id];
+	}
+	return Vector2();
+}
+
+void NavMeshQueries2D::map_iteration_get_flow_directions(const NavMapIteration2D &p_map_iteration, const Vector2 &p_target_position, const Vector2 *p_positions, uint32_t p_position_count, uint32_t p_navigation_layers, Vector2 *r_directions) {
+	for (uint32_t i = 0; i < p_position_count; i++) {
+		r_directions[i] = Vector2();
+	}
+
+	// The flow field stays in the cache while the directions are read from it.
+	MutexLock lock(p_map_iteration.flow_field_cache_mutex);
+
+	PolygonLookupGrid &polygon_lookup_grid = p_map_iteration.polygon_lookup_grid;
+	if (!polygon_lookup_grid.built) {
+		map_iteration_build_polygon_lookup_grid(p_map_iteration, polygon_lookup_grid);
+	}
+
+	Vector2 goal_point;
+	const Polygon *goal_polygon = polygon_lookup_grid_get_polygon(polygon_lookup_grid, p_target_position, p_navigation_layers, goal_point);
+	if (goal_polygon == nullptr) {
+		return;
+	}
+
+	FlowFieldKey flow_field_key;
+	flow_field_key.goal_polygon_id = goal_polygon->id;
+	flow_field_key.navigation_layers = p_navigation_layers;
+
+	const FlowField *flow_field = p_map_iteration.flow_field_cache.getptr(flow_field_key);
+	if (flow_field == nullptr) {
+		FlowField new_flow_field;
+		map_iteration_build_flow_field(p_map_iteration, goal_polygon, p_navigation_layers, new_flow_field);
+		flow_field = &p_map_iteration.flow_field_cache.insert(flow_field_key, new_flow_field)->data;
+	}
+
+	for (uint32_t i = 0; i < p_position_count; i++) {
+		Vector2 closest_point;
+		const Polygon *polygon = polygon_lookup_grid_get_polygon(polygon_lookup_grid, p_positions[i], p_navigation_layers, closest_point);
+		if (polygon != nullptr) {
+			r_directions[i] = flow_field_get_direction(*flow_field, polygon, p_positions[i], goal_point);
+		}
+	}
+}
+
 Vector2 NavMeshQueries2D::polygons_get_closest_point(const LocalVector<Polygon> &p_polygons, const Vector2 &p_point) {
 	ClosestPointQueryResult cp = polygons_get_closest_point_info(p_polygons, p_point);
 	return cp.point;
@@ -123,7 +123,16 @@ public:
 	static Nav2D::ClosestPointQueryResult map_iteration_get_closest_point_info(const NavMapIteration2D &p_map_iteration, const Vector2 &p_point);
 	static Vector2 map_iteration_get_random_point(const NavMapIteration2D &p_map_iteration, uint32_t p_navigation_layers, bool p_uniformly);
 
+	static void map_iteration_build_polygon_lookup_grid(const NavMapIteration2D &p_map_iteration, Nav2D::PolygonLookupGrid &r_grid);
+	static const Nav2D::Polygon *polygon_lookup_grid_get_polygon(const Nav2D::PolygonLookupGrid &p_grid, const Vector2 &p_point, uint32_t p_navigation_layers, Vector2 &r_closest_point);
+	static void map_iteration_build_flow_field(const NavMapIteration2D &p_map_iteration, const Nav2D::Polygon *p_goal_polygon, uint32_t p_navigation_layers, Nav2D::FlowField &r_flow_field);
+	static Vector2 flow_field_get_direction(const Nav2D::FlowField &p_flow_field, const Nav2D::Polygon *p_polygon, const Vector2 &p_position, const Vector2 &p_target_position);
+	static void map_iteration_get_flow_directions(const NavMapIteration2D &p_map_iteration, const Vector2 &p_target_position, const Vector2 *p_positions, uint32_t p_position_count, uint32_t p_navigation_layers, Vector2 *r_directions);
+
 	static void map_query_path(NavMap2D *p_map, const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback);
+	static Dictionary map_query_path_batch(NavMap2D *p_map, const Ref<NavigationPathQueryParameters2D> &p_query_parameters, const PackedVector2Array &p_start_target_positions);
+
+	static void query_task_set_parameters(NavMeshPathQueryTask2D &r_query_task, const Ref<NavigationPathQueryParameters2D> &p_query_parameters);
 
 	static void query_task_map_iteration_get_path(NavMeshPathQueryTask2D &p_query_task, const NavMapIteration2D &p_map_iteration);
 	static void _query_task_push_back_point_with_metadata(NavMeshPathQueryTask2D &p_query_task, const Vector2 &p_point, const Nav2D::Polygon *p_point_polygon);
@@ -131,32 +131,96 @@ void NavMap2D::query_path(NavMeshQueries2D::NavMeshPathQueryTask2D &p_query_task
 
 	GET_MAP_ITERATION();
 
-	map_iteration.path_query_slots_semaphore.wait();
+	p_query_task.path_query_slot = _acquire_path_query_slot(map_iteration);
+	ERR_FAIL_NULL_MSG(p_query_task.path_query_slot, "No unused NavMap2D path query slot found! This should never happen :(.");
 
-	map_iteration.path_query_slots_mutex.lock();
-	for (NavMeshQueries2D::PathQuerySlot &p_path_query_slot : map_iteration.path_query_slots) {
+	NavMeshQueries2D::query_task_map_iteration_get_path(p_query_task, map_iteration);
+
+	_release_path_query_slot(map_iteration, p_query_task.path_query_slot);
+	p_query_task.path_query_slot = nullptr;
+}
+
+void NavMap2D::query_path_batch(const NavMeshQueries2D::NavMeshPathQueryTask2D &p_query_template, const Vector2 *p_start_target_positions, uint32_t p_query_count, LocalVector<LocalVector<Vector2>> &r_paths) {
+	r_paths.clear();
+	r_paths.resize(p_query_count);
+
+	if (iteration_id == 0 || p_query_count == 0) {
+		return;
+	}
+
+	GET_MAP_ITERATION();
+
+	PathQueryBatch batch;
+	batch.map_iteration = &map_iteration;
+	batch.query_template = &p_query_template;
+	batch.start_target_positions = p_start_target_positions;
+	batch.query_count = p_query_count;
+	batch.paths = r_paths.ptr();
+
+	// One task per path query slot, each task takes the next query until the batch is done.
+	const uint32_t task_count = MIN(map_iteration.path_query_slots.size(), p_query_count);
+	if (task_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap2D::_query_path_batch_task, &batch, task_count, -1, true, SNAME("NavMapQueryPathBatch2D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_query_path_batch_task(0, &batch);
+	}
+}
+
+void NavMap2D::_query_path_batch_task(uint32_t p_index, PathQueryBatch *p_batch) {
+	NavMapIteration2D &map_iteration = *p_batch->map_iteration;
+
+	NavMeshQueries2D::NavMeshPathQueryTask2D query_task = *p_batch->query_template;
+	query_task.path_query_slot = _acquire_path_query_slot(map_iteration);
+	ERR_FAIL_NULL_MSG(query_task.path_query_slot, "No unused NavMap2D path query slot found! This should never happen :(.");
+
+	while (true) {
+		const uint32_t query_index = p_batch->next_query.postincrement();
+		if (query_index >= p_batch->query_count) {
+			break;
+		}
+
+		query_task.start_position = p_batch->start_target_positions[query_index * 2 + 0];
+		query_task.target_position = p_batch->start_target_positions[query_index * 2 + 1];
+		query_task.begin_polygon = nullptr;
+		query_task.end_polygon = nullptr;
+		query_task.status = NavMeshQueries2D::NavMeshPathQueryTask2D::TaskStatus::QUERY_STARTED;
+
+		NavMeshQueries2D::query_task_map_iteration_get_path(query_task, map_iteration);
+
+		p_batch->paths[query_index] = query_task.path_points;
+	}
+
+	_release_path_query_slot(map_iteration, query_task.path_query_slot);
+}
+
+NavMeshQueries2D::PathQuerySlot *NavMap2D::_acquire_path_query_slot(NavMapIteration2D &r_map_iteration) {
+	r_map_iteration.path_query_slots_semaphore.wait();
+
+	NavMeshQueries2D::PathQuerySlot *path_query_slot = nullptr;
+
+	r_map_iteration.path_query_slots_mutex.lock();
+	for (NavMeshQueries2D::PathQuerySlot &p_path_query_slot : r_map_iteration.path_query_slots) {
 		if (!p_path_query_slot.in_use) {
 			p_path_query_slot.in_use = true;
-			p_query_task.path_query_slot = &p_path_query_slot;
+			path_query_slot = &p_path_query_slot;
 			break;
 		}
 	}
-	map_iteration.path_query_slots_mutex.unlock();
+	r_map_iteration.path_query_slots_mutex.unlock();
 
-	if (p_query_task.path_query_slot == nullptr) {
-		map_iteration.path_query_slots_semaphore.post();
-		ERR_FAIL_NULL_MSG(p_query_task.path_query_slot, "No unused NavMap2D path query slot found! This should never happen :(.");
+	if (path_query_slot == nullptr) {
+		r_map_iteration.path_query_slots_semaphore.post();
 	}
+	return path_query_slot;
+}
 
-	NavMeshQueries2D::query_task_map_iteration_get_path(p_query_task, map_iteration);
-
-	map_iteration.path_query_slots_mutex.lock();
-	uint32_t used_slot_index = p_query_task.path_query_slot->slot_index;
-	map_iteration.path_query_slots[used_slot_index].in_use = false;
-	p_query_task.path_query_slot = nullptr;
-	map_iteration.path_query_slots_mutex.unlock();
+void NavMap2D::_release_path_query_slot(NavMapIteration2D &r_map_iteration, NavMeshQueries2D::PathQuerySlot *p_path_query_slot) {
+	r_map_iteration.path_query_slots_mutex.lock();
+	r_map_iteration.path_query_slots[p_path_query_slot->slot_index].in_use = false;
+	r_map_iteration.path_query_slots_mutex.unlock();
 
-	map_iteration.path_query_slots_semaphore.post();
+	r_map_iteration.path_query_slots_semaphore.post();
 }
 
 Vector2 NavMap2D::get_closest_point(const Vector2 &p_point) const {
@@ -276,6 +340,20 @@ Vector2 NavMap2D::get_random_point(uint32_t p_navigation_layers, bool p_uniforml
 	return NavMeshQueries2D::map_iteration_get_random_point(map_iteration, p_navigation_layers, p_uniformly);
 }
 
+void NavMap2D::get_flow_directions(const Vector2 &p_target_position, const Vector2 *p_positions, uint32_t p_position_count, uint32_t p_navigation_layers, Vector2 *r_directions) const {
+	if (iteration_id == 0) {
+		NAVMAP_ITERATION_ZERO_ERROR_MSG();
+		for (uint32_t i = 0; i < p_position_count; i++) {
+			r_directions[i] = Vector2();
+		}
+		return;
+	}
+
+	GET_MAP_ITERATION_CONST();
+
+	NavMeshQueries2D::map_iteration_get_flow_directions(map_iteration, p_target_position, p_positions, p_position_count, p_navigation_layers, r_directions);
+}
+
 void NavMap2D::_build_iteration() {
 	if (!iteration_dirty || iteration_building || iteration_ready) {
 		return;
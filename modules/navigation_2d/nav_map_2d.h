@@ -128,6 +128,19 @@ class NavMap2D : public NavRid2D {
 	void _build_iteration();
 	void _sync_iteration();
 
+	struct PathQueryBatch {
+		NavMapIteration2D *map_iteration = nullptr;
+		const NavMeshQueries2D::NavMeshPathQueryTask2D *query_template = nullptr;
+		const Vector2 *start_target_positions = nullptr;
+		uint32_t query_count = 0;
+		SafeNumeric<uint32_t> next_query;
+		LocalVector<Vector2> *paths = nullptr;
+	};
+
+	NavMeshQueries2D::PathQuerySlot *_acquire_path_query_slot(NavMapIteration2D &r_map_iteration);
+	void _release_path_query_slot(NavMapIteration2D &r_map_iteration, NavMeshQueries2D::PathQuerySlot *p_path_query_slot);
+	void _query_path_batch_task(uint32_t p_index, PathQueryBatch *p_batch);
+
 public:
 	NavMap2D();
 	~NavMap2D();
@@ -163,6 +176,8 @@ public:
 	Vector2 get_merge_rasterizer_cell_size() const;
 
 	void query_path(NavMeshQueries2D::NavMeshPathQueryTask2D &p_query_task);
+	// Runs one path query per start and target pair with the parameters of `p_query_template`.
+	void query_path_batch(const NavMeshQueries2D::NavMeshPathQueryTask2D &p_query_template, const Vector2 *p_start_target_positions, uint32_t p_query_count, LocalVector<LocalVector<Vector2>> &r_paths);
 
 	Vector2 get_closest_point(const Vector2 &p_point) const;
 	Nav2D::ClosestPointQueryResult get_closest_point_info(const Vector2 &p_point) const;
@@ -198,6 +213,8 @@ public:
 	}
 
 	Vector2 get_random_point(uint32_t p_navigation_layers, bool p_uniformly) const;
+	// Writes the direction towards `p_target_position` along the map's flow field for each position.
+	void get_flow_directions(const Vector2 &p_target_position, const Vector2 *p_positions, uint32_t p_position_count, uint32_t p_navigation_layers, Vector2 *r_directions) const;
 
 	void sync();
 	void step(double p_delta_time);
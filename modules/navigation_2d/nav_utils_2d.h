@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/math/vector2i.h"
 #include "core/math/vector3.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/hashfuncs.h"
@@ -171,6 +172,48 @@ struct NavPolyHeapIndexer {
 	}
 };
 
+struct FlowFieldKey {
+	uint32_t goal_polygon_id = UINT32_MAX;
+	uint32_t navigation_layers = 0;
+
+	static uint32_t hash(const FlowFieldKey &p_key) {
+		uint32_t h = hash_murmur3_one_32(p_key.goal_polygon_id);
+		h = hash_murmur3_one_32(p_key.navigation_layers, h);
+		return hash_fmix32(h);
+	}
+
+	bool operator==(const FlowFieldKey &p_key) const {
+		return goal_polygon_id == p_key.goal_polygon_id && navigation_layers == p_key.navigation_layers;
+	}
+};
+
+/// The pathway each polygon is left through on the shortest route towards a goal polygon, indexed by polygon id.
+/// Polygons that can not reach the goal have no next polygon and an infinite distance.
+struct FlowField {
+	const Polygon *goal_polygon = nullptr;
+	LocalVector<Vector2> pathway_starts;
+	LocalVector<Vector2> pathway_ends;
+	LocalVector<uint32_t> next_polygon_ids;
+	LocalVector<real_t> distances;
+};
+
+/// The polygons overlapping each cell of a uniform grid, stored in CSR layout.
+struct PolygonLookupGrid {
+	bool built = false;
+	Vector2 origin;
+	real_t cell_size = 1.0;
+	Vector2i size;
+	LocalVector<uint32_t> cell_offsets;
+	LocalVector<const Polygon *> cell_polygons;
+
+	void clear() {
+		built = false;
+		size = Vector2i();
+		cell_offsets.clear();
+		cell_polygons.clear();
+	}
+};
+
 struct ClosestPointQueryResult {
 	Vector2 point;
 	RID owner;
@@ -381,6 +381,16 @@ Vector3 GodotNavigationServer3D::map_get_random_point(RID p_map, uint32_t p_navi
 	return map->get_random_point(p_navigation_layers, p_uniformly);
 }
 
+PackedVector3Array GodotNavigationServer3D::map_get_flow_directions(RID p_map, const Vector3 &p_target_position, const PackedVector3Array &p_positions, uint32_t p_navigation_layers) const {
+	const NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, PackedVector3Array());
+
+	PackedVector3Array directions;
+	directions.resize(p_positions.size());
+	map->get_flow_directions(p_target_position, p_positions.ptr(), p_positions.size(), p_navigation_layers, directions.ptrw());
+	return directions;
+}
+
 RID GodotNavigationServer3D::region_create() {
 	MutexLock lock(operations_mutex);
 
@@ -1382,6 +1392,10 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 	int _new_pm_edge_connection_count = 0;
 	int _new_pm_edge_free_count = 0;
 	int _new_pm_obstacle_count = 0;
+	int _new_pm_path_cache_hit_count = 0;
+	int _new_pm_path_cache_miss_count = 0;
+	int _new_pm_path_cluster_count = 0;
+	int _new_pm_hierarchical_path_query_count = 0;
 
 	MutexLock lock(operations_mutex);
 	for (uint32_t i(0); i < active_maps.size(); i++) {
@@ -1398,6 +1412,10 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 		_new_pm_edge_connection_count += active_maps[i]->get_pm_edge_connection_count();
 		_new_pm_edge_free_count += active_maps[i]->get_pm_edge_free_count();
 		_new_pm_obstacle_count += active_maps[i]->get_pm_obstacle_count();
+		_new_pm_path_cache_hit_count += active_maps[i]->get_pm_path_cache_hit_count();
+		_new_pm_path_cache_miss_count += active_maps[i]->get_pm_path_cache_miss_count();
+		_new_pm_path_cluster_count += active_maps[i]->get_pm_path_cluster_count();
+		_new_pm_hierarchical_path_query_count += active_maps[i]->get_pm_hierarchical_path_query_count();
 	}
 
 	pm_region_count = _new_pm_region_count;
@@ -1409,6 +1427,10 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 	pm_edge_connection_count = _new_pm_edge_connection_count;
 	pm_edge_free_count = _new_pm_edge_free_count;
 	pm_obstacle_count = _new_pm_obstacle_count;
+	pm_path_cache_hit_count = _new_pm_path_cache_hit_count;
+	pm_path_cache_miss_count = _new_pm_path_cache_miss_count;
+	pm_path_cluster_count = _new_pm_path_cluster_count;
+	pm_hierarchical_path_query_count = _new_pm_hierarchical_path_query_count;
 }
 
 void GodotNavigationServer3D::init() {
@@ -1436,6 +1458,15 @@ void GodotNavigationServer3D::query_path(const Ref<NavigationPathQueryParameters
 	NavMeshQueries3D::map_query_path(map, p_query_parameters, p_query_result, p_callback);
 }
 
+Dictionary GodotNavigationServer3D::query_path_batch(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, const PackedVector3Array &p_start_target_positions) {
+	ERR_FAIL_COND_V(p_query_parameters.is_null(), Dictionary());
+
+	NavMap3D *map = map_owner.get_or_null(p_query_parameters->get_map());
+	ERR_FAIL_NULL_V(map, Dictionary());
+
+	return NavMeshQueries3D::map_query_path_batch(map, p_query_parameters, p_start_target_positions);
+}
+
 RID GodotNavigationServer3D::source_geometry_parser_create() {
 	RWLockWrite write_lock(geometry_parser_rwlock);
 
@@ -1523,6 +1554,18 @@ int GodotNavigationServer3D::get_process_info(ProcessInfo p_info) const {
 		case INFO_OBSTACLE_COUNT: {
 			return pm_obstacle_count;
 		} break;
+		case INFO_PATH_CACHE_HIT_COUNT: {
+			return pm_path_cache_hit_count;
+		} break;
+		case INFO_PATH_CACHE_MISS_COUNT: {
+			return pm_path_cache_miss_count;
+		} break;
+		case INFO_PATH_CLUSTER_COUNT: {
+			return pm_path_cluster_count;
+		} break;
+		case INFO_HIERARCHICAL_PATH_QUERY_COUNT: {
+			return pm_hierarchical_path_query_count;
+		} break;
 	}
 
 	return 0;
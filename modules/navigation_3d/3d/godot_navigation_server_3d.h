@@ -92,6 +92,10 @@ class GodotNavigationServer3D : public NavigationServer3D {
 	int pm_edge_connection_count = 0;
 	int pm_edge_free_count = 0;
 	int pm_obstacle_count = 0;
+	int pm_path_cache_hit_count = 0;
+	int pm_path_cache_miss_count = 0;
+	int pm_path_cluster_count = 0;
+	int pm_hierarchical_path_query_count = 0;
 
 public:
 	GodotNavigationServer3D();
@@ -145,6 +149,7 @@ public:
 	virtual bool map_get_use_async_iterations(RID p_map) const override;
 
 	virtual Vector3 map_get_random_point(RID p_map, uint32_t p_navigation_layers, bool p_uniformly) const override;
+	virtual PackedVector3Array map_get_flow_directions(RID p_map, const Vector3 &p_target_position, const PackedVector3Array &p_positions, uint32_t p_navigation_layers = 1) const override;
 
 	virtual RID region_create() override;
 	virtual uint32_t region_get_iteration_id(RID p_region) const override;
@@ -289,6 +294,7 @@ public:
 	virtual void finish() override;
 
 	virtual void query_path(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) override;
+	virtual Dictionary query_path_batch(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, const PackedVector3Array &p_start_target_positions) override;
 
 	int get_process_info(ProcessInfo p_info) const override;
 
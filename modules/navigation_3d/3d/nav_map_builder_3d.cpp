@@ -59,6 +59,7 @@ void NavMapBuilder3D::build_navmap_iteration(NavMapIterationBuild3D &r_build) {
 	performance_data.pm_edge_merge_count = 0;
 	performance_data.pm_edge_connection_count = 0;
 	performance_data.pm_edge_free_count = 0;
+	performance_data.pm_path_cluster_count = 0;
 
 	_build_step_gather_region_polygons(r_build);
 
@@ -70,6 +71,9 @@ void NavMapBuilder3D::build_navmap_iteration(NavMapIterationBuild3D &r_build) {
 
 	_build_step_navlink_connections(r_build);
 
+	_build_step_path_hierarchy(r_build);
+	performance_data.pm_path_cluster_count = r_build.map_iteration->path_clusters.size();
+
 	_build_update_map_iteration(r_build);
 }
 
@@ -387,17 +391,229 @@ void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild3D &r_
 	r_build.polygon_count = polygon_count;
 }
 
+void NavMapBuilder3D::_build_step_path_hierarchy(NavMapIterationBuild3D &r_build) {
+	NavMapIteration3D *map_iteration = r_build.map_iteration;
+
+	LocalVector<uint32_t> &polygon_clusters = map_iteration->polygon_clusters;
+	LocalVector<PathCluster> &path_clusters = map_iteration->path_clusters;
+	LocalVector<PathClusterLink> &path_cluster_links = map_iteration->path_cluster_links;
+
+	polygon_clusters.clear();
+	path_clusters.clear();
+	path_cluster_links.clear();
+
+	const real_t cluster_size = r_build.path_hierarchy_cluster_size;
+	if (cluster_size <= 0.0) {
+		return;
+	}
+
+	const uint32_t polygon_count = r_build.polygon_count;
+	const Vector3 cluster_cell_size = Vector3(cluster_size, cluster_size, cluster_size);
+
+	// Index all polygons of the map by id.
+	LocalVector<const Polygon *> polygons;
+	LocalVector<Vector3> polygon_centers;
+	polygons.resize(polygon_count);
+	polygon_centers.resize(polygon_count);
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		polygons[i] = nullptr;
+	}
+
+	for (const NavRegionIteration3D &region : map_iteration->region_iterations) {
+		if (!region.get_enabled()) {
+			continue;
+		}
+		for (const Polygon &polygon : region.navmesh_polygons) {
+			polygons[polygon.id] = &polygon;
+		}
+	}
+	for (const NavLinkIteration3D &link : map_iteration->link_iterations) {
+		if (!link.get_enabled()) {
+			continue;
+		}
+		for (const Polygon &polygon : link.navmesh_polygons) {
+			if (polygon.id < polygon_count) {
+				polygons[polygon.id] = &polygon;
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		if (polygons[i] == nullptr || polygons[i]->vertices.is_empty()) {
+			continue;
+		}
+		Vector3 center;
+		for (const Vector3 &vertex : polygons[i]->vertices) {
+			center += vertex;
+		}
+		polygon_centers[i] = center / polygons[i]->vertices.size();
+	}
+
+	// Flood fill the connected polygons of the same owner that share a cluster cell.
+	polygon_clusters.resize(polygon_count);
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		polygon_clusters[i] = UINT32_MAX;
+	}
+
+	LocalVector<uint32_t> polygon_stack;
+	for (uint32_t polygon_id = 0; polygon_id < polygon_count; polygon_id++) {
+		const Polygon *polygon = polygons[polygon_id];
+		if (polygon == nullptr || polygon_clusters[polygon_id] != UINT32_MAX) {
+			continue;
+		}
+
+		const uint32_t cluster_id = path_clusters.size();
+		PathCluster cluster;
+		cluster.owner = polygon->owner;
+
+		polygon_clusters[polygon_id] = cluster_id;
+
+		// Links are kept as clusters of their own so the hierarchy does not lose their costs.
+		if (polygon->owner->get_type() == NavigationUtilities::PathSegmentType::PATH_SEGMENT_TYPE_LINK) {
+			cluster.center = polygon_centers[polygon_id];
+			path_clusters.push_back(cluster);
+			continue;
+		}
+
+		const uint64_t cell_key = get_point_key(polygon_centers[polygon_id], cluster_cell_size).key;
+		Vector3 center_sum;
+		uint32_t member_count = 0;
+
+		polygon_stack.push_back(polygon_id);
+		while (!polygon_stack.is_empty()) {
+			const uint32_t current_id = polygon_stack[polygon_stack.size() - 1];
+			polygon_stack.remove_at(polygon_stack.size() - 1);
+
+			center_sum += polygon_centers[current_id];
+			member_count++;
+
+			for (const Edge &edge : polygons[current_id]->edges) {
+				for (const Edge::Connection &connection : edge.connections) {
+					const uint32_t other_id = connection.polygon->id;
+					if (other_id >= polygon_count || polygon_clusters[other_id] != UINT32_MAX) {
+						continue;
+					}
+					if (connection.polygon->owner != cluster.owner) {
+						continue;
+					}
+					if (get_point_key(polygon_centers[other_id], cluster_cell_size).key != cell_key) {
+						continue;
+					}
+					polygon_clusters[other_id] = cluster_id;
+					polygon_stack.push_back(other_id);
+				}
+			}
+		}
+
+		cluster.center = center_sum / member_count;
+		path_clusters.push_back(cluster);
+	}
+
+	// Group the polygon ids by cluster.
+	const uint32_t cluster_count = path_clusters.size();
+	LocalVector<uint32_t> cluster_polygon_offsets;
+	LocalVector<uint32_t> cluster_polygons;
+	cluster_polygon_offsets.resize(cluster_count + 1);
+	for (uint32_t i = 0; i <= cluster_count; i++) {
+		cluster_polygon_offsets[i] = 0;
+	}
+	for (uint32_t polygon_id = 0; polygon_id < polygon_count; polygon_id++) {
+		if (polygon_clusters[polygon_id] != UINT32_MAX) {
+			cluster_polygon_offsets[polygon_clusters[polygon_id] + 1]++;
+		}
+	}
+	for (uint32_t i = 0; i < cluster_count; i++) {
+		cluster_polygon_offsets[i + 1] += cluster_polygon_offsets[i];
+	}
+	cluster_polygons.resize(cluster_polygon_offsets[cluster_count]);
+	{
+		LocalVector<uint32_t> cluster_fill = cluster_polygon_offsets;
+		for (uint32_t polygon_id = 0; polygon_id < polygon_count; polygon_id++) {
+			if (polygon_clusters[polygon_id] != UINT32_MAX) {
+				cluster_polygons[cluster_fill[polygon_clusters[polygon_id]]++] = polygon_id;
+			}
+		}
+	}
+
+	// Connect the clusters through the cheapest polygon connection between them.
+	for (uint32_t cluster_id = 0; cluster_id < cluster_count; cluster_id++) {
+		PathCluster &cluster = path_clusters[cluster_id];
+		cluster.link_begin = path_cluster_links.size();
+
+		for (uint32_t i = cluster_polygon_offsets[cluster_id]; i < cluster_polygon_offsets[cluster_id + 1]; i++) {
+			for (const Edge &edge : polygons[cluster_polygons[i]]->edges) {
+				for (const Edge::Connection &connection : edge.connections) {
+					const uint32_t other_id = connection.polygon->id;
+					if (other_id >= polygon_count || polygon_clusters[other_id] == UINT32_MAX) {
+						continue;
+					}
+					const uint32_t other_cluster_id = polygon_clusters[other_id];
+					if (other_cluster_id == cluster_id) {
+						continue;
+					}
+
+					const PathCluster &other_cluster = path_clusters[other_cluster_id];
+					const Vector3 portal = (connection.pathway_start + connection.pathway_end) * 0.5;
+					real_t cost = cluster.center.distance_to(portal) * cluster.owner->get_travel_cost() +
+							portal.distance_to(other_cluster.center) * other_cluster.owner->get_travel_cost();
+					if (other_cluster.owner != cluster.owner) {
+						cost += cluster.owner->get_enter_cost();
+					}
+
+					bool link_found = false;
+					for (uint32_t link_index = cluster.link_begin; link_index < path_cluster_links.size(); link_index++) {
+						PathClusterLink &link = path_cluster_links[link_index];
+						if (link.cluster == other_cluster_id) {
+							link.cost = MIN(link.cost, cost);
+							link_found = true;
+							break;
+						}
+					}
+					if (!link_found) {
+						PathClusterLink link;
+						link.cluster = other_cluster_id;
+						link.cost = cost;
+						path_cluster_links.push_back(link);
+					}
+				}
+			}
+		}
+
+		cluster.link_count = path_cluster_links.size() - cluster.link_begin;
+	}
+}
+
 void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_build) {
 	NavMapIteration3D *map_iteration = r_build.map_iteration;
 
 	map_iteration->navmesh_polygon_count = r_build.polygon_count;
 
+	// Cached corridors point at the polygons of the previous build.
+	map_iteration->path_corridor_cache_mutex.lock();
+	map_iteration->path_corridor_cache.clear();
+	map_iteration->path_corridor_cache_size = r_build.path_corridor_cache_size;
+	if (r_build.path_corridor_cache_size > 0) {
+		map_iteration->path_corridor_cache.set_capacity(r_build.path_corridor_cache_size);
+	}
+	map_iteration->path_corridor_cache_mutex.unlock();
+
+	map_iteration->flow_field_cache_mutex.lock();
+	map_iteration->flow_field_cache.clear();
+	map_iteration->flow_field_cache.set_capacity(NavMapIteration3D::FLOW_FIELD_CACHE_SIZE);
+	map_iteration->polygon_lookup_grid.clear();
+	map_iteration->flow_field_cache_mutex.unlock();
+
 	map_iteration->path_query_slots_mutex.lock();
 	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : map_iteration->path_query_slots) {
 		p_path_query_slot.traversable_polys.clear();
 		p_path_query_slot.traversable_polys.reserve(map_iteration->navmesh_polygon_count * 0.25);
 		p_path_query_slot.path_corridor.clear();
 		p_path_query_slot.path_corridor.resize(map_iteration->navmesh_polygon_count);
+		p_path_query_slot.traversable_clusters.clear();
+		p_path_query_slot.cluster_corridor.clear();
+		p_path_query_slot.cluster_corridor.resize(map_iteration->path_clusters.size());
+		p_path_query_slot.clusters_in_corridor.clear();
+		p_path_query_slot.clusters_in_corridor.resize(map_iteration->path_clusters.size());
 	}
 	map_iteration->path_query_slots_mutex.unlock();
 }
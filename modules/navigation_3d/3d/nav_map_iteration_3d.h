@@ -36,6 +36,7 @@
 
 #include "core/math/math_defs.h"
 #include "core/os/semaphore.h"
+#include "core/templates/lru.h"
 
 struct NavLinkIteration3D;
 class NavRegion3D;
@@ -47,6 +48,8 @@ struct NavMapIterationBuild3D {
 	bool use_edge_connections = true;
 	real_t edge_connection_margin;
 	real_t link_connection_radius;
+	real_t path_hierarchy_cluster_size = 0.0;
+	uint32_t path_corridor_cache_size = 0;
 	Nav3D::PerformanceData performance_data;
 	int polygon_count = 0;
 	int free_edge_count = 0;
@@ -71,6 +74,8 @@ struct NavMapIterationBuild3D {
 };
 
 struct NavMapIteration3D {
+	static constexpr uint32_t FLOW_FIELD_CACHE_SIZE = 8;
+
 	mutable SafeNumeric<uint32_t> users;
 	RWLock rwlock;
 
@@ -86,6 +91,23 @@ struct NavMapIteration3D {
 
 	HashMap<NavRegion3D *, uint32_t> region_ptr_to_region_id;
 
+	// The path hierarchy used by hierarchical path queries, empty when disabled.
+	// The clusters are connected by `path_cluster_links`, grouped by source cluster.
+	LocalVector<uint32_t> polygon_clusters; // Cluster of each polygon, indexed by polygon id.
+	LocalVector<Nav3D::PathCluster> path_clusters;
+	LocalVector<Nav3D::PathClusterLink> path_cluster_links;
+
+	// Path corridors of earlier queries, keyed by their begin and end polygons. Cleared whenever the iteration is rebuilt.
+	uint32_t path_corridor_cache_size = 0;
+	mutable LRUCache<Nav3D::PathCorridorKey, LocalVector<Nav3D::PathCorridorStep>, Nav3D::PathCorridorKey> path_corridor_cache;
+	mutable Mutex path_corridor_cache_mutex;
+
+	// Flow fields of earlier queries, keyed by their goal polygon, and the grid used to find the polygons of sampled positions.
+	// Both are built on demand and cleared whenever the iteration is rebuilt.
+	mutable LRUCache<Nav3D::FlowFieldKey, Nav3D::FlowField, Nav3D::FlowFieldKey> flow_field_cache;
+	mutable Nav3D::PolygonLookupGrid polygon_lookup_grid;
+	mutable Mutex flow_field_cache_mutex;
+
 	LocalVector<NavMeshQueries3D::PathQuerySlot> path_query_slots;
 	Mutex path_query_slots_mutex;
 	Semaphore path_query_slots_semaphore;
@@ -48,6 +48,35 @@ bool NavMeshGenerator3D::baking_use_high_priority_threads = true;
 HashSet<Ref<NavigationMesh>> NavMeshGenerator3D::baking_navmeshes;
 HashMap<WorkerThreadPool::TaskID, NavMeshGenerator3D::NavMeshGeneratorTask3D *> NavMeshGenerator3D::generator_tasks;
 LocalVector<NavMeshGeometryParser3D *> NavMeshGenerator3D::generator_parsers;
+Mutex NavMeshGenerator3D::tile_cache_mutex;
+HashMap<ObjectID, NavMeshGenerator3D::NavMeshTileCache3D *> NavMeshGenerator3D::tile_caches;
+
+/// Source geometry of one tile, gathered before the dirty tiles are baked in parallel.
+struct NavMeshTileSource3D {
+	uint32_t hash = HASH_MURMUR3_SEED;
+	float min_y = FLT_MAX;
+	float max_y = -FLT_MAX;
+	LocalVector<int> indices;
+	LocalVector<int> projected_obstructions;
+};
+
+struct NavMeshGenerator3D::NavMeshTileBakeTask3D {
+	Ref<NavigationMesh> navigation_mesh;
+	const float *verts = nullptr;
+	int nverts = 0;
+	const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> *projected_obstructions = nullptr;
+
+	rcConfig config;
+	float tile_world_size = 0.0;
+	bool clip_to_config_bounds = false;
+
+	LocalVector<NavMeshTileSource3D> tile_sources;
+
+	// One entry per tile that is baked.
+	LocalVector<Vector2i> tile_keys;
+	LocalVector<uint32_t> tile_source_indices;
+	LocalVector<NavMeshTile3D> tiles;
+};
 
 NavMeshGenerator3D *NavMeshGenerator3D::get_singleton() {
 	return singleton;
@@ -70,6 +99,8 @@ NavMeshGenerator3D::~NavMeshGenerator3D() {
 }
 
 void NavMeshGenerator3D::sync() {
+	generator_free_orphaned_tile_caches();
+
 	if (generator_tasks.is_empty()) {
 		return;
 	}
@@ -121,6 +152,12 @@ void NavMeshGenerator3D::cleanup() {
 		generator_parsers.clear();
 		generator_parsers_rwlock.write_unlock();
 	}
+
+	MutexLock tile_cache_lock(tile_cache_mutex);
+	for (KeyValue<ObjectID, NavMeshTileCache3D *> &E : tile_caches) {
+		memdelete(E.value);
+	}
+	tile_caches.clear();
 }
 
 void NavMeshGenerator3D::finish() {
@@ -215,6 +252,18 @@ bool NavMeshGenerator3D::is_baking(Ref<NavigationMesh> p_navigation_mesh) {
 	return baking_navmeshes.has(p_navigation_mesh);
 }
 
+int NavMeshGenerator3D::get_baked_tile_count(Ref<NavigationMesh> p_navigation_mesh) {
+	ERR_FAIL_COND_V(p_navigation_mesh.is_null(), 0);
+	MutexLock tile_cache_lock(tile_cache_mutex);
+	NavMeshTileCache3D **tile_cache_ptr = tile_caches.getptr(p_navigation_mesh->get_instance_id());
+	return tile_cache_ptr != nullptr ? (*tile_cache_ptr)->baked_tile_count : 0;
+}
+
+int NavMeshGenerator3D::get_tile_cache_count() {
+	MutexLock tile_cache_lock(tile_cache_mutex);
+	return tile_caches.size();
+}
+
 void NavMeshGenerator3D::generator_thread_bake(void *p_arg) {
 	NavMeshGeneratorTask3D *generator_task = static_cast<NavMeshGeneratorTask3D *>(p_arg);
 
@@ -287,12 +336,11 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 		return;
 	}
 
-	rcHeightfield *hf = nullptr;
-	rcCompactHeightfield *chf = nullptr;
-	rcContourSet *cset = nullptr;
-	rcPolyMesh *poly_mesh = nullptr;
-	rcPolyMeshDetail *detail_mesh = nullptr;
-	rcContext ctx;
+	if (p_navigation_mesh->get_tile_size() > 0.0) {
+		generator_bake_tiles(p_navigation_mesh, source_geometry_vertices, source_geometry_indices, projected_obstructions);
+		return;
+	}
+	generator_free_tile_cache(p_navigation_mesh->get_instance_id());
 
 	// added to keep track of steps, no functionality right now
 	String bake_state = "";
@@ -304,10 +352,39 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 	const int *tris = source_geometry_indices.ptr();
 	const int ntris = source_geometry_indices.size() / 3;
 
+	rcConfig cfg;
+	generator_create_recast_config(p_navigation_mesh, verts, nverts, cfg);
+
+	bake_state = "Calculating grid size..."; // step #2
+	rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &cfg.width, &cfg.height);
+
+	// ~30000000 seems to be around sweetspot where Editor baking breaks
+	if ((cfg.width * cfg.height) > 30000000 && GLOBAL_GET("navigation/baking/use_crash_prevention_checks")) {
+		ERR_FAIL_MSG("Baking interrupted."
+					 "\nNavigationMesh baking process would likely crash the engine."
+					 "\nSource geometry is suspiciously big for the current Cell Size and Cell Height in the NavMesh Resource bake settings."
+					 "\nIf baking does not crash the engine or fail, the resulting NavigationMesh will create serious pathfinding performance issues."
+					 "\nIt is advised to increase Cell Size and/or Cell Height in the NavMesh Resource bake settings or reduce the size / scale of the source geometry."
+					 "\nIf you would like to try baking anyway, disable the 'navigation/baking/use_crash_prevention_checks' project setting.");
+		return;
+	}
+
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+	if (!generator_build_recast_polygons(p_navigation_mesh, cfg, verts, nverts, tris, ntris, projected_obstructions, nav_vertices, nav_polygons)) {
+		return;
+	}
+
+	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
+
+	bake_state = "Baking finished."; // step #12
+}
+
+void NavMeshGenerator3D::generator_create_recast_config(const Ref<NavigationMesh> &p_navigation_mesh, const float *p_verts, int p_nverts, rcConfig &r_config) {
 	float bmin[3], bmax[3];
-	rcCalcBounds(verts, nverts, bmin, bmax);
+	rcCalcBounds(p_verts, p_nverts, bmin, bmax);
 
-	rcConfig cfg;
+	rcConfig &cfg = r_config;
 	memset(&cfg, 0, sizeof(cfg));
 
 	cfg.cs = p_navigation_mesh->get_cell_size();
@@ -372,38 +449,37 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 		cfg.bmax[1] = cfg.bmin[1] + baking_aabb.size[1];
 		cfg.bmax[2] = cfg.bmin[2] + baking_aabb.size[2];
 	}
+}
 
-	bake_state = "Calculating grid size..."; // step #2
-	rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &cfg.width, &cfg.height);
+bool NavMeshGenerator3D::generator_build_recast_polygons(const Ref<NavigationMesh> &p_navigation_mesh, const rcConfig &p_config, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons) {
+	const rcConfig &cfg = p_config;
+	rcHeightfield *hf = nullptr;
+	rcCompactHeightfield *chf = nullptr;
+	rcContourSet *cset = nullptr;
+	rcPolyMesh *poly_mesh = nullptr;
+	rcPolyMeshDetail *detail_mesh = nullptr;
+	rcContext ctx;
 
-	// ~30000000 seems to be around sweetspot where Editor baking breaks
-	if ((cfg.width * cfg.height) > 30000000 && GLOBAL_GET("navigation/baking/use_crash_prevention_checks")) {
-		ERR_FAIL_MSG("Baking interrupted."
-					 "\nNavigationMesh baking process would likely crash the engine."
-					 "\nSource geometry is suspiciously big for the current Cell Size and Cell Height in the NavMesh Resource bake settings."
-					 "\nIf baking does not crash the engine or fail, the resulting NavigationMesh will create serious pathfinding performance issues."
-					 "\nIt is advised to increase Cell Size and/or Cell Height in the NavMesh Resource bake settings or reduce the size / scale of the source geometry."
-					 "\nIf you would like to try baking anyway, disable the 'navigation/baking/use_crash_prevention_checks' project setting.");
-		return;
-	}
+	// added to keep track of steps, no functionality right now
+	String bake_state = "";
 
 	bake_state = "Creating heightfield..."; // step #3
 	hf = rcAllocHeightfield();
 
-	ERR_FAIL_NULL(hf);
-	ERR_FAIL_COND(!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch));
+	ERR_FAIL_NULL_V(hf, false);
+	ERR_FAIL_COND_V(!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch), false);
 
 	bake_state = "Marking walkable triangles..."; // step #4
 	{
 		Vector<unsigned char> tri_areas;
-		tri_areas.resize(ntris);
+		tri_areas.resize(p_ntris);
 
-		ERR_FAIL_COND(tri_areas.is_empty());
+		ERR_FAIL_COND_V(tri_areas.is_empty(), false);
 
-		memset(tri_areas.ptrw(), 0, ntris * sizeof(unsigned char));
-		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, verts, nverts, tris, ntris, tri_areas.ptrw());
+		memset(tri_areas.ptrw(), 0, p_ntris * sizeof(unsigned char));
+		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, p_verts, p_nverts, p_tris, p_ntris, tri_areas.ptrw());
 
-		ERR_FAIL_COND(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *hf, cfg.walkableClimb));
+		ERR_FAIL_COND_V(!rcRasterizeTriangles(&ctx, p_verts, p_nverts, p_tris, tri_areas.ptr(), p_ntris, *hf, cfg.walkableClimb), false);
 	}
 
 	if (p_navigation_mesh->get_filter_low_hanging_obstacles()) {
@@ -420,15 +496,15 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 
 	chf = rcAllocCompactHeightfield();
 
-	ERR_FAIL_NULL(chf);
-	ERR_FAIL_COND(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf));
+	ERR_FAIL_NULL_V(chf, false);
+	ERR_FAIL_COND_V(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf), false);
 
 	rcFreeHeightField(hf);
 	hf = nullptr;
 
 	// Add obstacles to the source geometry. Those will be affected by e.g. agent_radius.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (projected_obstruction.carve) {
 				continue;
 			}
@@ -445,11 +521,11 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 
 	bake_state = "Eroding walkable area..."; // step #6
 
-	ERR_FAIL_COND(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf));
+	ERR_FAIL_COND_V(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf), false);
 
 	// Carve obstacles to the eroded geometry. Those will NOT be affected by e.g. agent_radius because that step is already done.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (!projected_obstruction.carve) {
 				continue;
 			}
@@ -467,30 +543,30 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 	bake_state = "Partitioning..."; // step #7
 
 	if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
-		ERR_FAIL_COND(!rcBuildDistanceField(&ctx, *chf));
-		ERR_FAIL_COND(!rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildDistanceField(&ctx, *chf), false);
+		ERR_FAIL_COND_V(!rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea), false);
 	} else if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
-		ERR_FAIL_COND(!rcBuildRegionsMonotone(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildRegionsMonotone(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea), false);
 	} else {
-		ERR_FAIL_COND(!rcBuildLayerRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea));
+		ERR_FAIL_COND_V(!rcBuildLayerRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea), false);
 	}
 
 	bake_state = "Creating contours..."; // step #8
 
 	cset = rcAllocContourSet();
 
-	ERR_FAIL_NULL(cset);
-	ERR_FAIL_COND(!rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset));
+	ERR_FAIL_NULL_V(cset, false);
+	ERR_FAIL_COND_V(!rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset), false);
 
 	bake_state = "Creating polymesh..."; // step #9
 
 	poly_mesh = rcAllocPolyMesh();
-	ERR_FAIL_NULL(poly_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh));
+	ERR_FAIL_NULL_V(poly_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh), false);
 
 	detail_mesh = rcAllocPolyMeshDetail();
-	ERR_FAIL_NULL(detail_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh));
+	ERR_FAIL_NULL_V(detail_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh), false);
 
 	rcFreeCompactHeightfield(chf);
 	chf = nullptr;
@@ -542,7 +618,8 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 		}
 	}
 
-	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
+	r_vertices = nav_vertices;
+	r_polygons = nav_polygons;
 
 	bake_state = "Cleanup..."; // step #11
 
@@ -551,7 +628,458 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 	rcFreePolyMeshDetail(detail_mesh);
 	detail_mesh = nullptr;
 
-	bake_state = "Baking finished."; // step #12
+	return true;
+}
+
+void NavMeshGenerator3D::generator_bake_tiles(Ref<NavigationMesh> p_navigation_mesh, const Vector<float> &p_source_geometry_vertices, const Vector<int> &p_source_geometry_indices, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions) {
+	const float *verts = p_source_geometry_vertices.ptr();
+	const int nverts = p_source_geometry_vertices.size() / 3;
+	const int *tris = p_source_geometry_indices.ptr();
+	const int ntris = p_source_geometry_indices.size() / 3;
+
+	NavMeshTileBakeTask3D bake_task;
+	bake_task.navigation_mesh = p_navigation_mesh;
+	bake_task.verts = verts;
+	bake_task.nverts = nverts;
+	bake_task.projected_obstructions = &p_projected_obstructions;
+	bake_task.clip_to_config_bounds = p_navigation_mesh->get_filter_baking_aabb().has_volume();
+
+	rcConfig &cfg = bake_task.config;
+	generator_create_recast_config(p_navigation_mesh, verts, nverts, cfg);
+
+	// Tiles are aligned to the world origin so they keep their bounds when the source geometry grows or shrinks.
+	const int tile_cells = MAX(1, (int)Math::ceil(p_navigation_mesh->get_tile_size() / cfg.cs));
+	const float tile_world_size = tile_cells * cfg.cs;
+	bake_task.tile_world_size = tile_world_size;
+
+	// Each tile rasterizes the geometry of its neighbors up to this border so erosion matches across tile edges.
+	cfg.borderSize = MAX(cfg.borderSize, cfg.walkableRadius + 3);
+	const float border_world_size = cfg.borderSize * cfg.cs;
+
+	const int tile_min_x = (int)Math::floor(cfg.bmin[0] / tile_world_size);
+	const int tile_min_z = (int)Math::floor(cfg.bmin[2] / tile_world_size);
+	const int tile_count_x = (int)Math::floor(cfg.bmax[0] / tile_world_size) - tile_min_x + 1;
+	const int tile_count_z = (int)Math::floor(cfg.bmax[2] / tile_world_size) - tile_min_z + 1;
+
+	if ((int64_t)tile_count_x * tile_count_z > 1000000 && GLOBAL_GET("navigation/baking/use_crash_prevention_checks")) {
+		ERR_FAIL_MSG("Baking interrupted."
+					 "\nNavigationMesh tile_size is too small for the size of the source geometry."
+					 "\nIf you would like to try baking anyway, disable the 'navigation/baking/use_crash_prevention_checks' project setting.");
+	}
+
+	bake_task.tile_sources.resize(tile_count_x * tile_count_z);
+
+	for (int i = 0; i < ntris; i++) {
+		const int *tri = &tris[i * 3];
+		float tri_min[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+		float tri_max[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+		for (int j = 0; j < 3; j++) {
+			const float *v = &verts[tri[j] * 3];
+			for (int k = 0; k < 3; k++) {
+				tri_min[k] = MIN(tri_min[k], v[k]);
+				tri_max[k] = MAX(tri_max[k], v[k]);
+			}
+		}
+
+		const int x_begin = MAX(tile_min_x, (int)Math::floor((tri_min[0] - border_world_size) / tile_world_size));
+		const int x_end = MIN(tile_min_x + tile_count_x - 1, (int)Math::floor((tri_max[0] + border_world_size) / tile_world_size));
+		const int z_begin = MAX(tile_min_z, (int)Math::floor((tri_min[2] - border_world_size) / tile_world_size));
+		const int z_end = MIN(tile_min_z + tile_count_z - 1, (int)Math::floor((tri_max[2] + border_world_size) / tile_world_size));
+
+		for (int z = z_begin; z <= z_end; z++) {
+			for (int x = x_begin; x <= x_end; x++) {
+				NavMeshTileSource3D &tile_source = bake_task.tile_sources[(z - tile_min_z) * tile_count_x + (x - tile_min_x)];
+				for (int j = 0; j < 3; j++) {
+					const float *v = &verts[tri[j] * 3];
+					tile_source.indices.push_back(tri[j]);
+					tile_source.hash = hash_murmur3_one_float(v[0], tile_source.hash);
+					tile_source.hash = hash_murmur3_one_float(v[1], tile_source.hash);
+					tile_source.hash = hash_murmur3_one_float(v[2], tile_source.hash);
+				}
+				tile_source.min_y = MIN(tile_source.min_y, tri_min[1]);
+				tile_source.max_y = MAX(tile_source.max_y, tri_max[1]);
+			}
+		}
+	}
+
+	for (int i = 0; i < p_projected_obstructions.size(); i++) {
+		const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction = p_projected_obstructions[i];
+		if (projected_obstruction.vertices.is_empty() || projected_obstruction.vertices.size() % 3 != 0) {
+			continue;
+		}
+
+		float obstruction_min[2] = { FLT_MAX, FLT_MAX };
+		float obstruction_max[2] = { -FLT_MAX, -FLT_MAX };
+		for (int j = 0; j < projected_obstruction.vertices.size(); j += 3) {
+			obstruction_min[0] = MIN(obstruction_min[0], projected_obstruction.vertices[j]);
+			obstruction_max[0] = MAX(obstruction_max[0], projected_obstruction.vertices[j]);
+			obstruction_min[1] = MIN(obstruction_min[1], projected_obstruction.vertices[j + 2]);
+			obstruction_max[1] = MAX(obstruction_max[1], projected_obstruction.vertices[j + 2]);
+		}
+
+		const int x_begin = MAX(tile_min_x, (int)Math::floor((obstruction_min[0] - border_world_size) / tile_world_size));
+		const int x_end = MIN(tile_min_x + tile_count_x - 1, (int)Math::floor((obstruction_max[0] + border_world_size) / tile_world_size));
+		const int z_begin = MAX(tile_min_z, (int)Math::floor((obstruction_min[1] - border_world_size) / tile_world_size));
+		const int z_end = MIN(tile_min_z + tile_count_z - 1, (int)Math::floor((obstruction_max[1] + border_world_size) / tile_world_size));
+
+		for (int z = z_begin; z <= z_end; z++) {
+			for (int x = x_begin; x <= x_end; x++) {
+				NavMeshTileSource3D &tile_source = bake_task.tile_sources[(z - tile_min_z) * tile_count_x + (x - tile_min_x)];
+				tile_source.projected_obstructions.push_back(i);
+				for (const float value : projected_obstruction.vertices) {
+					tile_source.hash = hash_murmur3_one_float(value, tile_source.hash);
+				}
+				tile_source.hash = hash_murmur3_one_float(projected_obstruction.elevation, tile_source.hash);
+				tile_source.hash = hash_murmur3_one_float(projected_obstruction.height, tile_source.hash);
+				tile_source.hash = hash_murmur3_one_32(projected_obstruction.carve, tile_source.hash);
+			}
+		}
+	}
+
+	// Any change to the bake settings invalidates all tiles.
+	uint32_t settings_hash = hash_murmur3_one_float(tile_world_size);
+	settings_hash = hash_murmur3_one_float(cfg.cs, settings_hash);
+	settings_hash = hash_murmur3_one_float(cfg.ch, settings_hash);
+	settings_hash = hash_murmur3_one_float(cfg.walkableSlopeAngle, settings_hash);
+	settings_hash = hash_murmur3_one_float(cfg.maxSimplificationError, settings_hash);
+	settings_hash = hash_murmur3_one_float(cfg.detailSampleDist, settings_hash);
+	settings_hash = hash_murmur3_one_float(cfg.detailSampleMaxError, settings_hash);
+	settings_hash = hash_murmur3_one_32(cfg.borderSize, settings_hash);
+	settings_hash = hash_murmur3_one_32(cfg.walkableHeight, settings_hash);
+	settings_hash = hash_murmur3_one_32(cfg.walkableClimb, settings_hash);
+	settings_hash = hash_murmur3_one_32(cfg.walkableRadius, settings_hash);
+	settings_hash = hash_murmur3_one_32(cfg.maxEdgeLen, settings_hash);
+	settings_hash = hash_murmur3_one_32(cfg.minRegionArea, settings_hash);
+	settings_hash = hash_murmur3_one_32(cfg.mergeRegionArea, settings_hash);
+	settings_hash = hash_murmur3_one_32(cfg.maxVertsPerPoly, settings_hash);
+	settings_hash = hash_murmur3_one_32(p_navigation_mesh->get_sample_partition_type(), settings_hash);
+	settings_hash = hash_murmur3_one_32(p_navigation_mesh->get_filter_low_hanging_obstacles(), settings_hash);
+	settings_hash = hash_murmur3_one_32(p_navigation_mesh->get_filter_ledge_spans(), settings_hash);
+	settings_hash = hash_murmur3_one_32(p_navigation_mesh->get_filter_walkable_low_height_spans(), settings_hash);
+	if (bake_task.clip_to_config_bounds) {
+		for (int i = 0; i < 3; i++) {
+			settings_hash = hash_murmur3_one_float(cfg.bmin[i], settings_hash);
+			settings_hash = hash_murmur3_one_float(cfg.bmax[i], settings_hash);
+		}
+	}
+	settings_hash = hash_fmix32(settings_hash);
+
+	NavMeshTileCache3D *tile_cache = nullptr;
+	{
+		MutexLock tile_cache_lock(tile_cache_mutex);
+		NavMeshTileCache3D **tile_cache_ptr = tile_caches.getptr(p_navigation_mesh->get_instance_id());
+		if (tile_cache_ptr == nullptr) {
+			tile_cache = memnew(NavMeshTileCache3D);
+			tile_caches.insert(p_navigation_mesh->get_instance_id(), tile_cache);
+		} else {
+			tile_cache = *tile_cache_ptr;
+		}
+	}
+
+	// The navigation mesh can not bake twice at the same time, so its tiles are not shared with other threads from here on.
+	if (tile_cache->settings_hash != settings_hash) {
+		tile_cache->tiles.clear();
+		tile_cache->settings_hash = settings_hash;
+	}
+
+	LocalVector<Vector2i> removed_tile_keys;
+	for (const KeyValue<Vector2i, NavMeshTile3D> &E : tile_cache->tiles) {
+		const int x = E.key.x - tile_min_x;
+		const int z = E.key.y - tile_min_z;
+		if (x < 0 || x >= tile_count_x || z < 0 || z >= tile_count_z || bake_task.tile_sources[z * tile_count_x + x].indices.is_empty()) {
+			removed_tile_keys.push_back(E.key);
+		}
+	}
+	for (const Vector2i &tile_key : removed_tile_keys) {
+		tile_cache->tiles.erase(tile_key);
+	}
+
+	for (int z = 0; z < tile_count_z; z++) {
+		for (int x = 0; x < tile_count_x; x++) {
+			const uint32_t tile_source_index = z * tile_count_x + x;
+			NavMeshTileSource3D &tile_source = bake_task.tile_sources[tile_source_index];
+			if (tile_source.indices.is_empty()) {
+				continue;
+			}
+			tile_source.hash = hash_fmix32(tile_source.hash);
+
+			const Vector2i tile_key(tile_min_x + x, tile_min_z + z);
+			const NavMeshTile3D *cached_tile = tile_cache->tiles.getptr(tile_key);
+			if (cached_tile != nullptr && cached_tile->source_hash == tile_source.hash) {
+				continue;
+			}
+			bake_task.tile_keys.push_back(tile_key);
+			bake_task.tile_source_indices.push_back(tile_source_index);
+		}
+	}
+
+	bake_task.tiles.resize(bake_task.tile_keys.size());
+
+	if (use_threads && bake_task.tile_keys.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&NavMeshGenerator3D::generator_thread_bake_tile, &bake_task, bake_task.tile_keys.size(), -1, baking_use_high_priority_threads, SNAME("NavMeshGeneratorBakeTiles3D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < bake_task.tile_keys.size(); i++) {
+			generator_thread_bake_tile(&bake_task, i);
+		}
+	}
+
+	for (uint32_t i = 0; i < bake_task.tile_keys.size(); i++) {
+		tile_cache->tiles[bake_task.tile_keys[i]] = bake_task.tiles[i];
+	}
+	tile_cache->baked_tile_count = bake_task.tile_keys.size();
+
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+	generator_stitch_tiles(*tile_cache, tile_world_size, cfg, nav_vertices, nav_polygons);
+
+	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
+}
+
+void NavMeshGenerator3D::generator_thread_bake_tile(void *p_arg, uint32_t p_index) {
+	NavMeshTileBakeTask3D *bake_task = static_cast<NavMeshTileBakeTask3D *>(p_arg);
+	const Vector2i &tile_key = bake_task->tile_keys[p_index];
+	const NavMeshTileSource3D &tile_source = bake_task->tile_sources[bake_task->tile_source_indices[p_index]];
+	NavMeshTile3D &tile = bake_task->tiles[p_index];
+	tile.source_hash = tile_source.hash;
+
+	rcConfig cfg = bake_task->config;
+	const float border_world_size = cfg.borderSize * cfg.cs;
+
+	float tile_bmin[3] = { tile_key.x * bake_task->tile_world_size, 0.0f, tile_key.y * bake_task->tile_world_size };
+	float tile_bmax[3] = { tile_bmin[0] + bake_task->tile_world_size, 0.0f, tile_bmin[2] + bake_task->tile_world_size };
+	if (bake_task->clip_to_config_bounds) {
+		tile_bmin[0] = MAX(tile_bmin[0], bake_task->config.bmin[0]);
+		tile_bmin[2] = MAX(tile_bmin[2], bake_task->config.bmin[2]);
+		tile_bmax[0] = MIN(tile_bmax[0], bake_task->config.bmax[0]);
+		tile_bmax[2] = MIN(tile_bmax[2], bake_task->config.bmax[2]);
+	}
+
+	// The height range is snapped to one cell_height grid so all tiles quantize heights the same way.
+	// Without clipping, the baking bounds follow the geometry, so the grid is anchored at 0 to stay valid for cached tiles.
+	const float height_origin = bake_task->clip_to_config_bounds ? bake_task->config.bmin[1] : 0.0f;
+	cfg.bmin[0] = tile_bmin[0] - border_world_size;
+	cfg.bmin[1] = height_origin + Math::floor((tile_source.min_y - height_origin) / cfg.ch) * cfg.ch;
+	if (bake_task->clip_to_config_bounds) {
+		cfg.bmin[1] = MAX(cfg.bmin[1], bake_task->config.bmin[1]);
+	}
+	cfg.bmin[2] = tile_bmin[2] - border_world_size;
+	cfg.bmax[0] = tile_bmax[0] + border_world_size;
+	cfg.bmax[1] = MIN(bake_task->config.bmax[1], tile_source.max_y);
+	cfg.bmax[2] = tile_bmax[2] + border_world_size;
+	if (cfg.bmax[0] <= cfg.bmin[0] || cfg.bmax[2] <= cfg.bmin[2] || cfg.bmax[1] < cfg.bmin[1]) {
+		return;
+	}
+	rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &cfg.width, &cfg.height);
+
+	Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
+	projected_obstructions.resize(tile_source.projected_obstructions.size());
+	for (uint32_t i = 0; i < tile_source.projected_obstructions.size(); i++) {
+		projected_obstructions.write[i] = (*bake_task->projected_obstructions)[tile_source.projected_obstructions[i]];
+	}
+
+	generator_build_recast_polygons(bake_task->navigation_mesh, cfg, bake_task->verts, bake_task->nverts, tile_source.indices.ptr(), tile_source.indices.size() / 3, projected_obstructions, tile.vertices, tile.polygons);
+}
+
+void NavMeshGenerator3D::generator_stitch_tiles(const NavMeshTileCache3D &p_tile_cache, real_t p_tile_world_size, const rcConfig &p_config, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons) {
+	// Tiles are merged in a fixed order so the same tiles always give the same navigation mesh.
+	LocalVector<Vector2i> tile_keys;
+	tile_keys.reserve(p_tile_cache.tiles.size());
+	for (const KeyValue<Vector2i, NavMeshTile3D> &E : p_tile_cache.tiles) {
+		tile_keys.push_back(E.key);
+	}
+	tile_keys.sort();
+
+	const real_t border_distance = p_config.cs * 0.1;
+	const int32_t NO_LINE = INT32_MIN;
+
+	// Vertices on tile edges are merged with the vertices of the neighbor tiles by cell.
+	HashMap<Vector3i, int> edge_vertex_indices;
+	LocalVector<int32_t> vertex_line_x;
+	LocalVector<int32_t> vertex_line_z;
+	HashMap<int32_t, LocalVector<int>> line_x_vertices;
+	HashMap<int32_t, LocalVector<int>> line_z_vertices;
+
+	LocalVector<Vector3> vertices;
+	LocalVector<Vector<int>> polygons;
+	LocalVector<int> tile_vertex_indices;
+
+	for (const Vector2i &tile_key : tile_keys) {
+		const NavMeshTile3D &tile = p_tile_cache.tiles[tile_key];
+
+		tile_vertex_indices.resize(tile.vertices.size());
+		for (int i = 0; i < tile.vertices.size(); i++) {
+			Vector3 vertex = tile.vertices[i];
+			const int32_t line_x = (int32_t)Math::round(vertex.x / p_tile_world_size);
+			const int32_t line_z = (int32_t)Math::round(vertex.z / p_tile_world_size);
+			const bool on_line_x = Math::abs(vertex.x - line_x * p_tile_world_size) < border_distance;
+			const bool on_line_z = Math::abs(vertex.z - line_z * p_tile_world_size) < border_distance;
+
+			if (!on_line_x && !on_line_z) {
+				tile_vertex_indices[i] = vertices.size();
+				vertices.push_back(vertex);
+				vertex_line_x.push_back(NO_LINE);
+				vertex_line_z.push_back(NO_LINE);
+				continue;
+			}
+
+			const Vector3i vertex_cell((int)Math::round(vertex.x / p_config.cs), (int)Math::round(vertex.y / p_config.ch), (int)Math::round(vertex.z / p_config.cs));
+			const int *edge_vertex_index = edge_vertex_indices.getptr(vertex_cell);
+			if (edge_vertex_index != nullptr) {
+				tile_vertex_indices[i] = *edge_vertex_index;
+				continue;
+			}
+
+			const int vertex_index = vertices.size();
+			if (on_line_x) {
+				vertex.x = line_x * p_tile_world_size;
+				line_x_vertices[line_x].push_back(vertex_index);
+			}
+			if (on_line_z) {
+				vertex.z = line_z * p_tile_world_size;
+				line_z_vertices[line_z].push_back(vertex_index);
+			}
+			tile_vertex_indices[i] = vertex_index;
+			edge_vertex_indices.insert(vertex_cell, vertex_index);
+			vertices.push_back(vertex);
+			vertex_line_x.push_back(on_line_x ? line_x : NO_LINE);
+			vertex_line_z.push_back(on_line_z ? line_z : NO_LINE);
+		}
+
+		for (const Vector<int> &tile_polygon : tile.polygons) {
+			// Merging edge vertices can collapse tiny polygon edges.
+			Vector<int> polygon;
+			for (const int tile_vertex_index : tile_polygon) {
+				const int vertex_index = tile_vertex_indices[tile_vertex_index];
+				if (polygon.is_empty() || polygon[polygon.size() - 1] != vertex_index) {
+					polygon.push_back(vertex_index);
+				}
+			}
+			if (polygon.size() > 1 && polygon[0] == polygon[polygon.size() - 1]) {
+				polygon.resize(polygon.size() - 1);
+			}
+			if (polygon.size() >= 3) {
+				polygons.push_back(polygon);
+			}
+		}
+	}
+
+	struct VertexZComparator {
+		const Vector3 *vertices = nullptr;
+		bool operator()(int p_a, int p_b) const { return vertices[p_a].z < vertices[p_b].z; }
+	};
+	struct VertexXComparator {
+		const Vector3 *vertices = nullptr;
+		bool operator()(int p_a, int p_b) const { return vertices[p_a].x < vertices[p_b].x; }
+	};
+	for (KeyValue<int32_t, LocalVector<int>> &E : line_x_vertices) {
+		SortArray<int, VertexZComparator> sorter;
+		sorter.compare.vertices = vertices.ptr();
+		sorter.sort(E.value.ptr(), E.value.size());
+	}
+	for (KeyValue<int32_t, LocalVector<int>> &E : line_z_vertices) {
+		SortArray<int, VertexXComparator> sorter;
+		sorter.compare.vertices = vertices.ptr();
+		sorter.sort(E.value.ptr(), E.value.size());
+	}
+
+	// Tiles split their edges at different vertices, so polygon edges on tile edges get the vertices
+	// of the neighbor tile inserted. The edges then match on both sides and the polygons connect.
+	const real_t max_height_difference = MAX(p_config.walkableClimb, 1) * p_config.ch;
+	LocalVector<int> edge_vertices;
+	for (Vector<int> &polygon : polygons) {
+		Vector<int> stitched_polygon;
+		bool stitched = false;
+
+		for (int i = 0; i < polygon.size(); i++) {
+			const int a = polygon[i];
+			const int b = polygon[(i + 1) % polygon.size()];
+			stitched_polygon.push_back(a);
+
+			const LocalVector<int> *line_vertices = nullptr;
+			int axis = 0;
+			if (vertex_line_x[a] != NO_LINE && vertex_line_x[a] == vertex_line_x[b]) {
+				line_vertices = line_x_vertices.getptr(vertex_line_x[a]);
+				axis = Vector3::AXIS_Z;
+			} else if (vertex_line_z[a] != NO_LINE && vertex_line_z[a] == vertex_line_z[b]) {
+				line_vertices = line_z_vertices.getptr(vertex_line_z[a]);
+				axis = Vector3::AXIS_X;
+			}
+			if (line_vertices == nullptr) {
+				continue;
+			}
+
+			const Vector3 &from = vertices[a];
+			const Vector3 &to = vertices[b];
+			const real_t edge_length = to[axis] - from[axis];
+			if (Math::is_zero_approx(edge_length)) {
+				continue;
+			}
+
+			edge_vertices.clear();
+			for (const int vertex_index : *line_vertices) {
+				const Vector3 &vertex = vertices[vertex_index];
+				const real_t weight = (vertex[axis] - from[axis]) / edge_length;
+				if (weight <= CMP_EPSILON || weight >= 1.0 - CMP_EPSILON) {
+					continue;
+				}
+				if (Math::abs(Math::lerp(from.y, to.y, weight) - vertex.y) > max_height_difference) {
+					continue;
+				}
+				edge_vertices.push_back(vertex_index);
+			}
+
+			// The line vertices are sorted along the line, the edge may run the other way.
+			if (edge_length < 0.0) {
+				edge_vertices.reverse();
+			}
+			for (const int vertex_index : edge_vertices) {
+				stitched_polygon.push_back(vertex_index);
+			}
+			stitched = stitched || !edge_vertices.is_empty();
+		}
+
+		if (stitched) {
+			polygon = stitched_polygon;
+		}
+	}
+
+	r_vertices.resize(vertices.size());
+	for (uint32_t i = 0; i < vertices.size(); i++) {
+		r_vertices.write[i] = vertices[i];
+	}
+	r_polygons.resize(polygons.size());
+	for (uint32_t i = 0; i < polygons.size(); i++) {
+		r_polygons.write[i] = polygons[i];
+	}
+}
+
+void NavMeshGenerator3D::generator_free_tile_cache(ObjectID p_navigation_mesh_id) {
+	MutexLock tile_cache_lock(tile_cache_mutex);
+	NavMeshTileCache3D **tile_cache_ptr = tile_caches.getptr(p_navigation_mesh_id);
+	if (tile_cache_ptr != nullptr) {
+		memdelete(*tile_cache_ptr);
+		tile_caches.erase(p_navigation_mesh_id);
+	}
+}
+
+void NavMeshGenerator3D::generator_free_orphaned_tile_caches() {
+	MutexLock tile_cache_lock(tile_cache_mutex);
+	if (tile_caches.is_empty()) {
+		return;
+	}
+
+	// A navigation mesh that is baking is referenced by its task, so only caches that no bake can use are freed.
+	LocalVector<ObjectID> freed_navigation_mesh_ids;
+	for (const KeyValue<ObjectID, NavMeshTileCache3D *> &E : tile_caches) {
+		if (ObjectDB::get_instance(E.key) == nullptr) {
+			freed_navigation_mesh_ids.push_back(E.key);
+		}
+	}
+	for (const ObjectID &navigation_mesh_id : freed_navigation_mesh_ids) {
+		memdelete(tile_caches[navigation_mesh_id]);
+		tile_caches.erase(navigation_mesh_id);
+	}
 }
 
 bool NavMeshGenerator3D::generator_emit_callback(const Callable &p_callback) {
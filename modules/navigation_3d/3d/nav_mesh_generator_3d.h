@@ -38,6 +38,7 @@
 class Node;
 class NavigationMesh;
 class NavigationMeshSourceGeometryData3D;
+struct rcConfig;
 
 class NavMeshGenerator3D : public Object {
 	static NavMeshGenerator3D *singleton;
@@ -74,9 +75,36 @@ class NavMeshGenerator3D : public Object {
 
 	static HashSet<Ref<NavigationMesh>> baking_navmeshes;
 
+	/// Baked polygons of one tile, reused until the source geometry touching the tile changes.
+	struct NavMeshTile3D {
+		uint32_t source_hash = 0;
+		Vector<Vector3> vertices;
+		Vector<Vector<int>> polygons;
+	};
+
+	struct NavMeshTileCache3D {
+		uint32_t settings_hash = 0;
+		uint32_t baked_tile_count = 0; // Tiles baked by the last bake, the others were reused.
+		HashMap<Vector2i, NavMeshTile3D> tiles;
+	};
+
+	struct NavMeshTileBakeTask3D;
+
+	static Mutex tile_cache_mutex;
+	static HashMap<ObjectID, NavMeshTileCache3D *> tile_caches;
+
+	static void generator_thread_bake_tile(void *p_arg, uint32_t p_index);
+
 	static void generator_parse_geometry_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node, bool p_recurse_children);
 	static void generator_parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_root_node);
 	static void generator_bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data);
+	static void generator_create_recast_config(const Ref<NavigationMesh> &p_navigation_mesh, const float *p_verts, int p_nverts, rcConfig &r_config);
+	static bool generator_build_recast_polygons(const Ref<NavigationMesh> &p_navigation_mesh, const rcConfig &p_config, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons);
+
+	static void generator_bake_tiles(Ref<NavigationMesh> p_navigation_mesh, const Vector<float> &p_source_geometry_vertices, const Vector<int> &p_source_geometry_indices, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions);
+	static void generator_stitch_tiles(const NavMeshTileCache3D &p_tile_cache, real_t p_tile_world_size, const rcConfig &p_config, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons);
+	static void generator_free_tile_cache(ObjectID p_navigation_mesh_id);
+	static void generator_free_orphaned_tile_caches();
 
 	static bool generator_emit_callback(const Callable &p_callback);
 
@@ -93,6 +121,9 @@ public:
 	static void bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback = Callable());
 	static void bake_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback = Callable());
 	static bool is_baking(Ref<NavigationMesh> p_navigation_mesh);
+	// Used by tests to check that tiles are reused and that caches are freed with their navigation mesh.
+	static int get_baked_tile_count(Ref<NavigationMesh> p_navigation_mesh);
+	static int get_tile_cache_count();
 
 	NavMeshGenerator3D();
 	~NavMeshGenerator3D();
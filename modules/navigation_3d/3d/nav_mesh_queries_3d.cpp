@@ -31,6 +31,7 @@
 #include "nav_mesh_queries_3d.h"
 
 #include "../nav_base_3d.h"
+#include "../nav_link_3d.h"
 #include "../nav_map_3d.h"
 #include "nav_region_iteration_3d.h"
 
@@ -145,18 +146,12 @@ void NavMeshQueries3D::_query_task_push_back_point_with_metadata(NavMeshPathQuer
 	p_query_task.path_points.push_back(p_point);
 }
 
-void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) {
-	ERR_FAIL_NULL(map);
-	ERR_FAIL_COND(p_query_parameters.is_null());
-	ERR_FAIL_COND(p_query_result.is_null());
-
+void NavMeshQueries3D::query_task_set_parameters(NavMeshPathQueryTask3D &r_query_task, const Ref<NavigationPathQueryParameters3D> &p_query_parameters) {
 	using namespace NavigationUtilities;
 
-	NavMeshQueries3D::NavMeshPathQueryTask3D query_task;
-	query_task.start_position = p_query_parameters->get_start_position();
-	query_task.target_position = p_query_parameters->get_target_position();
-	query_task.navigation_layers = p_query_parameters->get_navigation_layers();
-	query_task.callback = p_callback;
+	r_query_task.start_position = p_query_parameters->get_start_position();
+	r_query_task.target_position = p_query_parameters->get_target_position();
+	r_query_task.navigation_layers = p_query_parameters->get_navigation_layers();
 
 	const TypedArray<RID> &_excluded_regions = p_query_parameters->get_excluded_regions();
 	const TypedArray<RID> &_included_regions = p_query_parameters->get_included_regions();
@@ -164,52 +159,63 @@ void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQue
 	uint32_t _excluded_region_count = _excluded_regions.size();
 	uint32_t _included_region_count = _included_regions.size();
 
-	query_task.exclude_regions = _excluded_region_count > 0;
-	query_task.include_regions = _included_region_count > 0;
+	r_query_task.exclude_regions = _excluded_region_count > 0;
+	r_query_task.include_regions = _included_region_count > 0;
 
-	if (query_task.exclude_regions) {
-		query_task.excluded_regions.resize(_excluded_region_count);
+	if (r_query_task.exclude_regions) {
+		r_query_task.excluded_regions.resize(_excluded_region_count);
 		for (uint32_t i = 0; i < _excluded_region_count; i++) {
-			query_task.excluded_regions[i] = _excluded_regions[i];
+			r_query_task.excluded_regions[i] = _excluded_regions[i];
 		}
 	}
 
-	if (query_task.include_regions) {
-		query_task.included_regions.resize(_included_region_count);
+	if (r_query_task.include_regions) {
+		r_query_task.included_regions.resize(_included_region_count);
 		for (uint32_t i = 0; i < _included_region_count; i++) {
-			query_task.included_regions[i] = _included_regions[i];
+			r_query_task.included_regions[i] = _included_regions[i];
 		}
 	}
 
 	switch (p_query_parameters->get_pathfinding_algorithm()) {
 		case NavigationPathQueryParameters3D::PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR: {
-			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+			r_query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
 		} break;
 		default: {
 			WARN_PRINT("No match for used PathfindingAlgorithm - fallback to default");
-			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+			r_query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
 		} break;
 	}
 
 	switch (p_query_parameters->get_path_postprocessing()) {
 		case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
+			r_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
 		} break;
 		case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED;
+			r_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED;
 		} break;
 		case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_NONE: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_NONE;
+			r_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_NONE;
 		} break;
 		default: {
 			WARN_PRINT("No match for used PathPostProcessing - fallback to default");
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
+			r_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
 		} break;
 	}
 
-	query_task.metadata_flags = (int64_t)p_query_parameters->get_metadata_flags();
-	query_task.simplify_path = p_query_parameters->get_simplify_path();
-	query_task.simplify_epsilon = p_query_parameters->get_simplify_epsilon();
+	r_query_task.metadata_flags = (int64_t)p_query_parameters->get_metadata_flags();
+	r_query_task.simplify_path = p_query_parameters->get_simplify_path();
+	r_query_task.simplify_epsilon = p_query_parameters->get_simplify_epsilon();
+	r_query_task.use_hierarchical_pathfinding = p_query_parameters->get_use_hierarchical_pathfinding();
+}
+
+void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) {
+	ERR_FAIL_NULL(map);
+	ERR_FAIL_COND(p_query_parameters.is_null());
+	ERR_FAIL_COND(p_query_result.is_null());
+
+	NavMeshQueries3D::NavMeshPathQueryTask3D query_task;
+	query_task_set_parameters(query_task, p_query_parameters);
+	query_task.callback = p_callback;
 	query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED;
 
 	map->query_path(query_task);
@@ -229,6 +235,47 @@ void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQue
 	}
 }
 
+Dictionary NavMeshQueries3D::map_query_path_batch(NavMap3D *p_map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, const PackedVector3Array &p_start_target_positions) {
+	ERR_FAIL_NULL_V(p_map, Dictionary());
+	ERR_FAIL_COND_V(p_query_parameters.is_null(), Dictionary());
+	ERR_FAIL_COND_V_MSG(p_start_target_positions.size() % 2 != 0, Dictionary(), "Path queries must be given as pairs of positions, start and target.");
+
+	const uint32_t query_count = p_start_target_positions.size() / 2;
+
+	NavMeshQueries3D::NavMeshPathQueryTask3D query_template;
+	query_task_set_parameters(query_template, p_query_parameters);
+	// Batched queries only return the path points.
+	query_template.metadata_flags = 0;
+
+	LocalVector<LocalVector<Vector3>> paths;
+	p_map->query_path_batch(query_template, p_start_target_positions.ptr(), query_count, paths);
+
+	PackedInt32Array path_offsets;
+	path_offsets.resize(query_count + 1);
+	int32_t *path_offsets_ptr = path_offsets.ptrw();
+	int32_t path_point_count = 0;
+	for (uint32_t i = 0; i < query_count; i++) {
+		path_offsets_ptr[i] = path_point_count;
+		path_point_count += paths[i].size();
+	}
+	path_offsets_ptr[query_count] = path_point_count;
+
+	PackedVector3Array path_points;
+	path_points.resize(path_point_count);
+	Vector3 *path_points_ptr = path_points.ptrw();
+	for (uint32_t i = 0; i < query_count; i++) {
+		if (!paths[i].is_empty()) {
+			memcpy(path_points_ptr + path_offsets_ptr[i], paths[i].ptr(), paths[i].size() * sizeof(Vector3));
+		}
+	}
+
+	Dictionary d;
+	d["path_points"] = path_points;
+	d["path_offsets"] = path_offsets;
+
+	return d;
+}
+
 void NavMeshQueries3D::_query_task_find_start_end_positions(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
 	real_t begin_d = FLT_MAX;
 	real_t end_d = FLT_MAX;
@@ -328,6 +375,10 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 					continue;
 				}
 
+				if (p_query_task.polygon_clusters && !p_query_task.path_query_slot->clusters_in_corridor[(*p_query_task.polygon_clusters)[connection.polygon->id]]) {
+					continue;
+				}
+
 				const Vector3 new_entry = Geometry3D::get_closest_point_to_segment(least_cost_poly.entry, connection.pathway_start, connection.pathway_end);
 				const real_t new_traveled_distance = least_cost_poly.entry.distance_to(new_entry) * poly_travel_cost + poly_enter_cost + least_cost_poly.traveled_distance;
 
@@ -359,6 +410,12 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 		// When the heap of traversable polygons is empty at this point it means the end polygon is
 		// unreachable.
 		if (traversable_polys.is_empty()) {
+			if (p_query_task.polygon_clusters) {
+				// The cluster corridor does not hold a polygon route, let the caller search the whole map.
+				p_query_task.cluster_corridor_exhausted = true;
+				return;
+			}
+
 			// Thus use the further reachable polygon
 			ERR_BREAK_MSG(is_reachable == false, "It's not expect to not find the most reachable polygons");
 			is_reachable = false;
@@ -465,6 +522,145 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 	}
 }
 
+bool NavMeshQueries3D::_query_task_find_cluster_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
+	const LocalVector<uint32_t> &polygon_clusters = p_map_iteration.polygon_clusters;
+	const LocalVector<PathCluster> &path_clusters = p_map_iteration.path_clusters;
+	const LocalVector<PathClusterLink> &path_cluster_links = p_map_iteration.path_cluster_links;
+
+	const uint32_t begin_cluster_id = polygon_clusters[p_query_task.begin_polygon->id];
+	const uint32_t end_cluster_id = polygon_clusters[p_query_task.end_polygon->id];
+	if (begin_cluster_id == UINT32_MAX || end_cluster_id == UINT32_MAX) {
+		return false;
+	}
+	const Vector3 end_point = p_query_task.end_position;
+
+	// Heap of clusters to travel next.
+	Heap<NavigationCluster *, NavClusterTravelCostGreaterThan, NavClusterHeapIndexer>
+			&traversable_clusters = p_query_task.path_query_slot->traversable_clusters;
+	traversable_clusters.clear();
+
+	LocalVector<NavigationCluster> &navigation_clusters = p_query_task.path_query_slot->cluster_corridor;
+	for (NavigationCluster &cluster : navigation_clusters) {
+		cluster.reset();
+	}
+
+	NavigationCluster &begin_navigation_cluster = navigation_clusters[begin_cluster_id];
+	begin_navigation_cluster.id = begin_cluster_id;
+	begin_navigation_cluster.traveled_cost = 0.0;
+	traversable_clusters.push(&begin_navigation_cluster);
+
+	// This is an implementation of the A* algorithm on the path hierarchy.
+	bool found_route = false;
+	while (!traversable_clusters.is_empty()) {
+		const NavigationCluster *least_cost_cluster = traversable_clusters.pop();
+		if (least_cost_cluster->id == end_cluster_id) {
+			found_route = true;
+			break;
+		}
+
+		const PathCluster &cluster = path_clusters[least_cost_cluster->id];
+		for (uint32_t link_index = cluster.link_begin; link_index < cluster.link_begin + cluster.link_count; link_index++) {
+			const PathClusterLink &link = path_cluster_links[link_index];
+
+			const NavBaseIteration3D *link_owner = path_clusters[link.cluster].owner;
+			if (!_query_task_is_connection_owner_usable(p_query_task, link_owner)) {
+				continue;
+			}
+
+			const real_t new_traveled_cost = least_cost_cluster->traveled_cost + link.cost;
+			NavigationCluster &neighbor_cluster = navigation_clusters[link.cluster];
+			if (new_traveled_cost < neighbor_cluster.traveled_cost) {
+				neighbor_cluster.id = link.cluster;
+				neighbor_cluster.back_navigation_cluster_id = least_cost_cluster->id;
+				neighbor_cluster.traveled_cost = new_traveled_cost;
+				neighbor_cluster.cost_to_destination = path_clusters[link.cluster].center.distance_to(end_point) * link_owner->get_travel_cost();
+
+				if (neighbor_cluster.traversable_cluster_index != traversable_clusters.INVALID_INDEX) {
+					traversable_clusters.shift(neighbor_cluster.traversable_cluster_index);
+				} else {
+					traversable_clusters.push(&neighbor_cluster);
+				}
+			}
+		}
+	}
+
+	if (!found_route) {
+		return false;
+	}
+
+	// Mark the clusters on the route, and the clusters next to them so the polygon search can cut corners.
+	LocalVector<uint8_t> &clusters_in_corridor = p_query_task.path_query_slot->clusters_in_corridor;
+	memset(clusters_in_corridor.ptr(), 0, clusters_in_corridor.size());
+	for (uint32_t cluster_id = end_cluster_id; cluster_id != UINT32_MAX; cluster_id = navigation_clusters[cluster_id].back_navigation_cluster_id) {
+		clusters_in_corridor[cluster_id] = 1;
+
+		const PathCluster &cluster = path_clusters[cluster_id];
+		for (uint32_t link_index = cluster.link_begin; link_index < cluster.link_begin + cluster.link_count; link_index++) {
+			clusters_in_corridor[path_cluster_links[link_index].cluster] = 1;
+		}
+	}
+
+	return true;
+}
+
+void NavMeshQueries3D::_query_task_restore_cached_path_corridor(NavMeshPathQueryTask3D &p_query_task, const LocalVector<PathCorridorStep> &p_path_corridor) {
+	const Polygon *begin_poly = p_query_task.begin_polygon;
+	const Vector3 begin_point = p_query_task.begin_position;
+	LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
+
+	NavigationPoly &begin_navigation_poly = navigation_polys[begin_poly->id];
+	begin_navigation_poly.reset();
+	begin_navigation_poly.poly = begin_poly;
+	begin_navigation_poly.entry = begin_point;
+	begin_navigation_poly.back_navigation_edge_pathway_start = begin_point;
+	begin_navigation_poly.back_navigation_edge_pathway_end = begin_point;
+	begin_navigation_poly.traveled_distance = 0.0;
+
+	// The corridor is stored from the end polygon back to the begin polygon.
+	// Walk it forward to place the entry points for this query's begin position, as the A* search would.
+	int back_navigation_poly_id = begin_poly->id;
+	for (int i = int(p_path_corridor.size()) - 1; i >= 0; i--) {
+		const PathCorridorStep &step = p_path_corridor[i];
+		const NavigationPoly &back_navigation_poly = navigation_polys[back_navigation_poly_id];
+
+		NavigationPoly &navigation_poly = navigation_polys[step.polygon->id];
+		navigation_poly.reset();
+		navigation_poly.poly = step.polygon;
+		navigation_poly.back_navigation_poly_id = back_navigation_poly_id;
+		navigation_poly.back_navigation_edge = step.back_navigation_edge;
+		navigation_poly.back_navigation_edge_pathway_start = step.back_navigation_edge_pathway_start;
+		navigation_poly.back_navigation_edge_pathway_end = step.back_navigation_edge_pathway_end;
+		navigation_poly.entry = Geometry3D::get_closest_point_to_segment(back_navigation_poly.entry, step.back_navigation_edge_pathway_start, step.back_navigation_edge_pathway_end);
+		navigation_poly.traveled_distance = back_navigation_poly.traveled_distance + back_navigation_poly.entry.distance_to(navigation_poly.entry);
+
+		back_navigation_poly_id = step.polygon->id;
+	}
+
+	p_query_task.least_cost_id = back_navigation_poly_id;
+}
+
+void NavMeshQueries3D::_query_task_cache_path_corridor(const NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const PathCorridorKey &p_path_corridor_key) {
+	const LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
+
+	LocalVector<PathCorridorStep> path_corridor;
+	int navigation_poly_id = p_query_task.least_cost_id;
+	while (navigation_poly_id != -1 && navigation_polys[navigation_poly_id].back_navigation_poly_id != -1) {
+		const NavigationPoly &navigation_poly = navigation_polys[navigation_poly_id];
+
+		PathCorridorStep step;
+		step.polygon = navigation_poly.poly;
+		step.back_navigation_edge = navigation_poly.back_navigation_edge;
+		step.back_navigation_edge_pathway_start = navigation_poly.back_navigation_edge_pathway_start;
+		step.back_navigation_edge_pathway_end = navigation_poly.back_navigation_edge_pathway_end;
+		path_corridor.push_back(step);
+
+		navigation_poly_id = navigation_poly.back_navigation_poly_id;
+	}
+
+	MutexLock lock(p_map_iteration.path_corridor_cache_mutex);
+	p_map_iteration.path_corridor_cache.insert(p_path_corridor_key, path_corridor);
+}
+
 void NavMeshQueries3D::query_task_map_iteration_get_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
 	p_query_task.path_clear();
 
@@ -483,10 +679,53 @@ void NavMeshQueries3D::query_task_map_iteration_get_path(NavMeshPathQueryTask3D
 		return;
 	}
 
-	_query_task_build_path_corridor(p_query_task);
+	// Queries that filter regions are not cached, their corridors depend on more than the cache key.
+	p_query_task.path_cache_used = p_map_iteration.path_corridor_cache_size > 0 && !p_query_task.exclude_regions && !p_query_task.include_regions;
+	p_query_task.path_cache_hit = false;
+	p_query_task.cluster_corridor_used = false;
+
+	PathCorridorKey path_corridor_key;
+	if (p_query_task.path_cache_used) {
+		path_corridor_key.begin_polygon_id = p_query_task.begin_polygon->id;
+		path_corridor_key.end_polygon_id = p_query_task.end_polygon->id;
+		path_corridor_key.navigation_layers = p_query_task.navigation_layers;
+		path_corridor_key.use_hierarchical_pathfinding = p_query_task.use_hierarchical_pathfinding;
+
+		MutexLock lock(p_map_iteration.path_corridor_cache_mutex);
+		const LocalVector<PathCorridorStep> *cached_path_corridor = p_map_iteration.path_corridor_cache.getptr(path_corridor_key);
+		if (cached_path_corridor) {
+			_query_task_restore_cached_path_corridor(p_query_task, *cached_path_corridor);
+			p_query_task.path_cache_hit = true;
+		}
+	}
 
-	if (p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FINISHED || p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED) {
-		return;
+	if (!p_query_task.path_cache_hit) {
+		const Polygon *requested_end_polygon = p_query_task.end_polygon;
+
+		if (p_query_task.use_hierarchical_pathfinding && !p_map_iteration.path_clusters.is_empty() && _query_task_find_cluster_corridor(p_query_task, p_map_iteration)) {
+			// Only search the polygons of the clusters along the route found on the path hierarchy.
+			p_query_task.polygon_clusters = &p_map_iteration.polygon_clusters;
+			_query_task_build_path_corridor(p_query_task);
+			p_query_task.polygon_clusters = nullptr;
+
+			if (p_query_task.cluster_corridor_exhausted) {
+				p_query_task.cluster_corridor_exhausted = false;
+				_query_task_build_path_corridor(p_query_task);
+			} else {
+				p_query_task.cluster_corridor_used = true;
+			}
+		} else {
+			_query_task_build_path_corridor(p_query_task);
+		}
+
+		if (p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FINISHED || p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED) {
+			return;
+		}
+
+		// Only cache corridors that reach the requested end polygon, not the closest reachable one.
+		if (p_query_task.path_cache_used && p_query_task.end_polygon == requested_end_polygon) {
+			_query_task_cache_path_corridor(p_query_task, p_map_iteration, path_corridor_key);
+		}
 	}
 
 	// Post-Process path.
@@ -934,6 +1173,331 @@ Vector3 NavMeshQueries3D::map_iteration_get_random_point(const NavMapIteration3D
 	}
 }
 
+static Vector3 _polygon_get_closest_point(const Polygon &p_polygon, const Vector3 &p_point) {
+	Vector3 closest_point;
+	real_t closest_distance_squared = FLT_MAX;
+	for (uint32_t point_id = 2; point_id < p_polygon.vertices.size(); point_id++) {
+		const Face3 face(p_polygon.vertices[0], p_polygon.vertices[point_id - 1], p_polygon.vertices[point_id]);
+		const Vector3 point = face.get_closest_point_to(p_point);
+		const real_t distance_squared = point.distance_squared_to(p_point);
+		if (distance_squared < closest_distance_squared) {
+			closest_point = point;
+			closest_distance_squared = distance_squared;
+		}
+	}
+	return closest_point;
+}
+
+void NavMeshQueries3D::map_iteration_build_polygon_lookup_grid(const NavMapIteration3D &p_map_iteration, PolygonLookupGrid &r_grid) {
+	r_grid.clear();
+	r_grid.built = true;
+
+	AABB bounds;
+	uint32_t polygon_count = 0;
+	for (const NavRegionIteration3D &region : p_map_iteration.region_iterations) {
+		if (!region.get_enabled()) {
+			continue;
+		}
+		for (const Polygon &polygon : region.get_navmesh_polygons()) {
+			if (polygon_count == 0) {
+				bounds.position = polygon.vertices[0];
+			}
+			for (const Vector3 &vertex : polygon.vertices) {
+				bounds.expand_to(vertex);
+			}
+			polygon_count++;
+		}
+	}
+
+	if (polygon_count == 0) {
+		return;
+	}
+
+	// Aim for about one polygon per cell.
+	r_grid.origin = bounds.position;
+	r_grid.cell_size = MAX(Math::sqrt(bounds.size.x * bounds.size.z / polygon_count), real_t(0.01));
+	r_grid.size = Vector2i(int(bounds.size.x / r_grid.cell_size) + 1, int(bounds.size.z / r_grid.cell_size) + 1);
+
+	const uint32_t cell_count = r_grid.size.x * r_grid.size.y;
+	r_grid.cell_offsets.resize(cell_count + 1);
+	for (uint32_t &cell_offset : r_grid.cell_offsets) {
+		cell_offset = 0;
+	}
+
+	// Count the polygons of each cell first, then fill them in.
+	for (uint32_t pass = 0; pass < 2; pass++) {
+		for (const NavRegionIteration3D &region : p_map_iteration.region_iterations) {
+			if (!region.get_enabled()) {
+				continue;
+			}
+			for (const Polygon &polygon : region.get_navmesh_polygons()) {
+				Vector3 polygon_min = polygon.vertices[0];
+				Vector3 polygon_max = polygon.vertices[0];
+				for (const Vector3 &vertex : polygon.vertices) {
+					polygon_min = polygon_min.min(vertex);
+					polygon_max = polygon_max.max(vertex);
+				}
+
+				const int min_x = CLAMP(int((polygon_min.x - r_grid.origin.x) / r_grid.cell_size), 0, r_grid.size.x - 1);
+				const int min_z = CLAMP(int((polygon_min.z - r_grid.origin.z) / r_grid.cell_size), 0, r_grid.size.y - 1);
+				const int max_x = CLAMP(int((polygon_max.x - r_grid.origin.x) / r_grid.cell_size), 0, r_grid.size.x - 1);
+				const int max_z = CLAMP(int((polygon_max.z - r_grid.origin.z) / r_grid.cell_size), 0, r_grid.size.y - 1);
+
+				for (int z = min_z; z <= max_z; z++) {
+					for (int x = min_x; x <= max_x; x++) {
+						const uint32_t cell_index = z * r_grid.size.x + x;
+						if (pass == 0) {
+							r_grid.cell_offsets[cell_index + 1]++;
+						} else {
+							r_grid.cell_polygons[r_grid.cell_offsets[cell_index]++] = &polygon;
+						}
+					}
+				}
+			}
+		}
+
+		if (pass == 0) {
+			for (uint32_t cell_index = 0; cell_index < cell_count; cell_index++) {
+				r_grid.cell_offsets[cell_index + 1] += r_grid.cell_offsets[cell_index];
+			}
+			r_grid.cell_polygons.resize(r_grid.cell_offsets[cell_count]);
+		} else {
+			// Filling advanced each offset to the start of the next cell.
+			for (uint32_t cell_index = cell_count; cell_index > 0; cell_index--) {
+				r_grid.cell_offsets[cell_index] = r_grid.cell_offsets[cell_index - 1];
+			}
+			r_grid.cell_offsets[0] = 0;
+		}
+	}
+}
+
+const Polygon *NavMeshQueries3D::polygon_lookup_grid_get_polygon(const PolygonLookupGrid &p_grid, const Vector3 &p_point, uint32_t p_navigation_layers, Vector3 &r_closest_point) {
+	if (p_grid.cell_polygons.is_empty()) {
+		return nullptr;
+	}
+
+	const int cell_x = int(Math::floor((p_point.x - p_grid.origin.x) / p_grid.cell_size));
+	const int cell_z = int(Math::floor((p_point.z - p_grid.origin.z) / p_grid.cell_size));
+
+	const Polygon *closest_polygon = nullptr;
+	real_t closest_distance_squared = FLT_MAX;
+
+	// Also search the neighbor cells so that points just off the navigation mesh still find their polygon.
+	for (int z = MAX(cell_z - 1, 0); z <= MIN(cell_z + 1, p_grid.size.y - 1); z++) {
+		for (int x = MAX(cell_x - 1, 0); x <= MIN(cell_x + 1, p_grid.size.x - 1); x++) {
+			const uint32_t cell_index = z * p_grid.size.x + x;
+			for (uint32_t i = p_grid.cell_offsets[cell_index]; i < p_grid.cell_offsets[cell_index + 1]; i++) {
+				const Polygon *polygon = p_grid.cell_polygons[i];
+				if ((polygon->owner->get_navigation_layers() & p_navigation_layers) == 0) {
+					continue;
+				}
+
+				const Vector3 point = _polygon_get_closest_point(*polygon, p_point);
+				const real_t distance_squared = point.distance_squared_to(p_point);
+				if (distance_squared < closest_distance_squared) {
+					closest_polygon = polygon;
+					closest_distance_squared = distance_squared;
+					r_closest_point = point;
+				}
+			}
+		}
+	}
+
+	return closest_polygon;
+}
+
+void NavMeshQueries3D::map_iteration_build_flow_field(const NavMapIteration3D &p_map_iteration, const Polygon *p_goal_polygon, uint32_t p_navigation_layers, FlowField &r_flow_field) {
+	const uint32_t polygon_count = p_map_iteration.navmesh_polygon_count;
+
+	r_flow_field.goal_polygon = p_goal_polygon;
+	r_flow_field.pathway_starts.resize(polygon_count);
+	r_flow_field.pathway_ends.resize(polygon_count);
+	r_flow_field.next_polygon_ids.resize(polygon_count);
+	r_flow_field.distances.resize(polygon_count);
+	for (uint32_t polygon_id = 0; polygon_id < polygon_count; polygon_id++) {
+		r_flow_field.next_polygon_ids[polygon_id] = UINT32_MAX;
+		r_flow_field.distances[polygon_id] = FLT_MAX;
+	}
+
+	// Connections are directed, so the search from the goal follows them backwards.
+	struct IncomingConnection {
+		const Polygon *polygon = nullptr;
+		Vector3 pathway_start;
+		Vector3 pathway_end;
+	};
+
+	LocalVector<uint32_t> incoming_offsets;
+	incoming_offsets.resize(polygon_count + 1);
+	for (uint32_t &incoming_offset : incoming_offsets) {
+		incoming_offset = 0;
+	}
+	LocalVector<IncomingConnection> incoming_connections;
+
+	LocalVector<const LocalVector<Polygon> *> polygon_sets;
+	polygon_sets.reserve(p_map_iteration.region_iterations.size() + p_map_iteration.link_iterations.size());
+	for (const NavRegionIteration3D &region : p_map_iteration.region_iterations) {
+		polygon_sets.push_back(&region.get_navmesh_polygons());
+	}
+	for (const NavLinkIteration3D &link : p_map_iteration.link_iterations) {
+		polygon_sets.push_back(&link.get_navmesh_polygons());
+	}
+
+	for (uint32_t pass = 0; pass < 2; pass++) {
+		for (const LocalVector<Polygon> *polygons : polygon_sets) {
+			for (const Polygon &polygon : *polygons) {
+				if ((polygon.owner->get_navigation_layers() & p_navigation_layers) == 0) {
+					continue;
+				}
+				for (const Edge &edge : polygon.edges) {
+					for (const Edge::Connection &connection : edge.connections) {
+						if (pass == 0) {
+							incoming_offsets[connection.polygon->id + 1]++;
+						} else {
+							IncomingConnection &incoming_connection = incoming_connections[incoming_offsets[connection.polygon->id]++];
+							incoming_connection.polygon = &polygon;
+							incoming_connection.pathway_start = connection.pathway_start;
+							incoming_connection.pathway_end = connection.pathway_end;
+						}
+					}
+				}
+			}
+		}
+
+		if (pass == 0) {
+			for (uint32_t polygon_id = 0; polygon_id < polygon_count; polygon_id++) {
+				incoming_offsets[polygon_id + 1] += incoming_offsets[polygon_id];
+			}
+			incoming_connections.resize(incoming_offsets[polygon_count]);
+		} else {
+			for (uint32_t polygon_id = polygon_count; polygon_id > 0; polygon_id--) {
+				incoming_offsets[polygon_id] = incoming_offsets[polygon_id - 1];
+			}
+			incoming_offsets[0] = 0;
+		}
+	}
+
+	LocalVector<NavigationPoly> navigation_polys;
+	navigation_polys.resize(polygon_count);
+	for (NavigationPoly &navigation_poly : navigation_polys) {
+		navigation_poly.reset();
+	}
+
+	Heap<NavigationPoly *, NavPolyTravelCostGreaterThan, NavPolyHeapIndexer> traversable_polys;
+	traversable_polys.reserve(polygon_count * 0.25);
+
+	Vector3 goal_center;
+	for (const Vector3 &vertex : p_goal_polygon->vertices) {
+		goal_center += vertex;
+	}
+	goal_center /= p_goal_polygon->vertices.size();
+
+	// The `entry` of each polygon is the middle of the pathway it is left through towards the goal.
+	NavigationPoly &goal_poly = navigation_polys[p_goal_polygon->id];
+	goal_poly.poly = p_goal_polygon;
+	goal_poly.entry = goal_center;
+	goal_poly.traveled_distance = 0.0;
+	traversable_polys.push(&goal_poly);
+	r_flow_field.distances[p_goal_polygon->id] = 0.0;
+
+	while (!traversable_polys.is_empty()) {
+		const NavigationPoly *least_cost_poly = traversable_polys.pop();
+		const Polygon *polygon = least_cost_poly->poly;
+		const real_t polygon_travel_cost = polygon->owner->get_travel_cost();
+
+		for (uint32_t i = incoming_offsets[polygon->id]; i < incoming_offsets[polygon->id + 1]; i++) {
+			const IncomingConnection &incoming_connection = incoming_connections[i];
+			const Vector3 pathway_center = (incoming_connection.pathway_start + incoming_connection.pathway_end) * 0.5;
+
+			real_t traveled_distance = least_cost_poly->traveled_distance + pathway_center.distance_to(least_cost_poly->entry) * polygon_travel_cost;
+			if (incoming_connection.polygon->owner != polygon->owner) {
+				traveled_distance += polygon->owner->get_enter_cost();
+			}
+
+			NavigationPoly &neighbor_poly = navigation_polys[incoming_connection.polygon->id];
+			if (traveled_distance >= neighbor_poly.traveled_distance) {
+				continue;
+			}
+
+			neighbor_poly.traveled_distance = traveled_distance;
+			neighbor_poly.entry = pathway_center;
+
+			const uint32_t neighbor_id = incoming_connection.polygon->id;
+			r_flow_field.pathway_starts[neighbor_id] = incoming_connection.pathway_start;
+			r_flow_field.pathway_ends[neighbor_id] = incoming_connection.pathway_end;
+			r_flow_field.next_polygon_ids[neighbor_id] = polygon->id;
+			r_flow_field.distances[neighbor_id] = traveled_distance;
+
+			if (neighbor_poly.traversable_poly_index != traversable_polys.INVALID_INDEX) {
+				traversable_polys.shift(neighbor_poly.traversable_poly_index);
+			} else {
+				neighbor_poly.poly = incoming_connection.polygon;
+				traversable_polys.push(&neighbor_poly);
+			}
+		}
+	}
+}
+
+Vector3 NavMeshQueries3D::flow_field_get_direction(const FlowField &p_flow_field, const Polygon *p_polygon, const Vector3 &p_position, const Vector3 &p_target_position) {
+	uint32_t polygon_id = p_polygon->id;
+	// Positions right on a pathway move on with the pathway of the polygon that follows.
+	for (uint32_t step = 0; step < 2; step++) {
+		if (polygon_id == p_flow_field.goal_polygon->id) {
+			return (p_target_position - p_position).normalized();
+		}
+		if (p_flow_field.next_polygon_ids[polygon_id] == UINT32_MAX) {
+			// The goal can not be reached from here.
+			return Vector3();
+		}
+
+		const Vector3 pathway_point = Geometry3D::get_closest_point_to_segment(p_position, p_flow_field.pathway_starts[polygon_id], p_flow_field.pathway_ends[polygon_id]);
+		const Vector3 direction = pathway_point - p_position;
+		if (direction.length_squared() > CMP_EPSILON2) {
+			return direction.normalized();
+		}
+		polygon_id = p_flow_field.next_polygon_ids[polygon_id];
+	}
+	return Vector3();
+}
+
+void NavMeshQueries3D::map_iteration_get_flow_directions(const NavMapIteration3D &p_map_iteration, const Vector3 &p_target_position, const Vector3 *p_positions, uint32_t p_position_count, uint32_t p_navigation_layers, Vector3 *r_directions) {
+	for (uint32_t i = 0; i < p_position_count; i++) {
+		r_directions[i] = Vector3();
+	}
+
+	// The flow field stays in the cache while the directions are read from it.
+	MutexLock lock(p_map_iteration.flow_field_cache_mutex);
+
+	PolygonLookupGrid &polygon_lookup_grid = p_map_iteration.polygon_lookup_grid;
+	if (!polygon_lookup_grid.built) {
+		map_iteration_build_polygon_lookup_grid(p_map_iteration, polygon_lookup_grid);
+	}
+
+	Vector3 goal_point;
+	const Polygon *goal_polygon = polygon_lookup_grid_get_polygon(polygon_lookup_grid, p_target_position, p_navigation_layers, goal_point);
+	if (goal_polygon == nullptr) {
+		return;
+	}
+
+	FlowFieldKey flow_field_key;
+	flow_field_key.goal_polygon_id = goal_polygon->id;
+	flow_field_key.navigation_layers = p_navigation_layers;
+
+	const FlowField *flow_field = p_map_iteration.flow_field_cache.getptr(flow_field_key);
+	if (flow_field == nullptr) {
+		FlowField new_flow_field;
+		map_iteration_build_flow_field(p_map_iteration, goal_polygon, p_navigation_layers, new_flow_field);
+		flow_field = &p_map_iteration.flow_field_cache.insert(flow_field_key, new_flow_field)->data;
+	}
+
+	for (uint32_t i = 0; i < p_position_count; i++) {
+		Vector3 closest_point;
+		const Polygon *polygon = polygon_lookup_grid_get_polygon(polygon_lookup_grid, p_positions[i], p_navigation_layers, closest_point);
+		if (polygon != nullptr) {
+			r_directions[i] = flow_field_get_direction(*flow_field, polygon, p_positions[i], goal_point);
+		}
+	}
+}
+
 Vector3 NavMeshQueries3D::polygons_get_closest_point_to_segment(const LocalVector<Polygon> &p_polygons, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) {
 	bool use_collision = p_use_collision;
 	Vector3 closest_point;
@@ -46,6 +46,9 @@ public:
 	struct PathQuerySlot {
 		LocalVector<Nav3D::NavigationPoly> path_corridor;
 		Heap<Nav3D::NavigationPoly *, Nav3D::NavPolyTravelCostGreaterThan, Nav3D::NavPolyHeapIndexer> traversable_polys;
+		LocalVector<Nav3D::NavigationCluster> cluster_corridor;
+		Heap<Nav3D::NavigationCluster *, Nav3D::NavClusterTravelCostGreaterThan, Nav3D::NavClusterHeapIndexer> traversable_clusters;
+		LocalVector<uint8_t> clusters_in_corridor;
 		bool in_use = false;
 		uint32_t slot_index = 0;
 	};
@@ -72,6 +75,7 @@ public:
 		bool include_regions = false;
 		LocalVector<RID> excluded_regions;
 		LocalVector<RID> included_regions;
+		bool use_hierarchical_pathfinding = false;
 
 		// Path building.
 		Vector3 begin_position;
@@ -79,6 +83,14 @@ public:
 		const Nav3D::Polygon *begin_polygon = nullptr;
 		const Nav3D::Polygon *end_polygon = nullptr;
 		uint32_t least_cost_id = 0;
+		// Set while the polygon search is restricted to the clusters marked in the path query slot.
+		const LocalVector<uint32_t> *polygon_clusters = nullptr;
+		bool cluster_corridor_exhausted = false;
+		// Whether the polygon search stayed inside the cluster corridor without falling back to the whole map.
+		bool cluster_corridor_used = false;
+		// Whether the path corridor cache was looked up, and whether it held the corridor.
+		bool path_cache_used = false;
+		bool path_cache_hit = false;
 
 		// Map.
 		Vector3 map_up;
@@ -128,12 +140,24 @@ public:
 	static Nav3D::ClosestPointQueryResult map_iteration_get_closest_point_info(const NavMapIteration3D &p_map_iteration, const Vector3 &p_point);
 	static Vector3 map_iteration_get_random_point(const NavMapIteration3D &p_map_iteration, uint32_t p_navigation_layers, bool p_uniformly);
 
+	static void map_iteration_build_polygon_lookup_grid(const NavMapIteration3D &p_map_iteration, Nav3D::PolygonLookupGrid &r_grid);
+	static const Nav3D::Polygon *polygon_lookup_grid_get_polygon(const Nav3D::PolygonLookupGrid &p_grid, const Vector3 &p_point, uint32_t p_navigation_layers, Vector3 &r_closest_point);
+	static void map_iteration_build_flow_field(const NavMapIteration3D &p_map_iteration, const Nav3D::Polygon *p_goal_polygon, uint32_t p_navigation_layers, Nav3D::FlowField &r_flow_field);
+	static Vector3 flow_field_get_direction(const Nav3D::FlowField &p_flow_field, const Nav3D::Polygon *p_polygon, const Vector3 &p_position, const Vector3 &p_target_position);
+	static void map_iteration_get_flow_directions(const NavMapIteration3D &p_map_iteration, const Vector3 &p_target_position, const Vector3 *p_positions, uint32_t p_position_count, uint32_t p_navigation_layers, Vector3 *r_directions);
+
 	static void map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback);
+	static Dictionary map_query_path_batch(NavMap3D *p_map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, const PackedVector3Array &p_start_target_positions);
+
+	static void query_task_set_parameters(NavMeshPathQueryTask3D &r_query_task, const Ref<NavigationPathQueryParameters3D> &p_query_parameters);
 
 	static void query_task_map_iteration_get_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
 	static void _query_task_push_back_point_with_metadata(NavMeshPathQueryTask3D &p_query_task, const Vector3 &p_point, const Nav3D::Polygon *p_point_polygon);
 	static void _query_task_find_start_end_positions(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
 	static void _query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task);
+	static bool _query_task_find_cluster_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
+	static void _query_task_restore_cached_path_corridor(NavMeshPathQueryTask3D &p_query_task, const LocalVector<Nav3D::PathCorridorStep> &p_path_corridor);
+	static void _query_task_cache_path_corridor(const NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const Nav3D::PathCorridorKey &p_path_corridor_key);
 	static void _query_task_post_process_corridorfunnel(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_edgecentered(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_nopostprocessing(NavMeshPathQueryTask3D &p_query_task);
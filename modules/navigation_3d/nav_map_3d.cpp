@@ -150,34 +150,116 @@ void NavMap3D::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task
 
 	GET_MAP_ITERATION();
 
-	map_iteration.path_query_slots_semaphore.wait();
+	p_query_task.path_query_slot = _acquire_path_query_slot(map_iteration);
+	ERR_FAIL_NULL_MSG(p_query_task.path_query_slot, "No unused NavMap3D path query slot found! This should never happen :(.");
 
-	map_iteration.path_query_slots_mutex.lock();
-	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : map_iteration.path_query_slots) {
-		if (!p_path_query_slot.in_use) {
-			p_path_query_slot.in_use = true;
-			p_query_task.path_query_slot = &p_path_query_slot;
+	p_query_task.map_up = map_iteration.map_up;
+
+	NavMeshQueries3D::query_task_map_iteration_get_path(p_query_task, map_iteration);
+	_count_path_query_use(p_query_task);
+
+	_release_path_query_slot(map_iteration, p_query_task.path_query_slot);
+	p_query_task.path_query_slot = nullptr;
+}
+
+void NavMap3D::query_path_batch(const NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_template, const Vector3 *p_start_target_positions, uint32_t p_query_count, LocalVector<LocalVector<Vector3>> &r_paths) {
+	r_paths.clear();
+	r_paths.resize(p_query_count);
+
+	if (iteration_id == 0 || p_query_count == 0) {
+		return;
+	}
+
+	GET_MAP_ITERATION();
+
+	PathQueryBatch batch;
+	batch.map_iteration = &map_iteration;
+	batch.query_template = &p_query_template;
+	batch.start_target_positions = p_start_target_positions;
+	batch.query_count = p_query_count;
+	batch.paths = r_paths.ptr();
+
+	// One task per path query slot, each task takes the next query until the batch is done.
+	const uint32_t task_count = MIN(map_iteration.path_query_slots.size(), p_query_count);
+	if (task_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::_query_path_batch_task, &batch, task_count, -1, true, SNAME("NavMapQueryPathBatch3D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_query_path_batch_task(0, &batch);
+	}
+}
+
+void NavMap3D::_query_path_batch_task(uint32_t p_index, PathQueryBatch *p_batch) {
+	NavMapIteration3D &map_iteration = *p_batch->map_iteration;
+
+	NavMeshQueries3D::NavMeshPathQueryTask3D query_task = *p_batch->query_template;
+	query_task.path_query_slot = _acquire_path_query_slot(map_iteration);
+	ERR_FAIL_NULL_MSG(query_task.path_query_slot, "No unused NavMap3D path query slot found! This should never happen :(.");
+
+	query_task.map_up = map_iteration.map_up;
+
+	while (true) {
+		const uint32_t query_index = p_batch->next_query.postincrement();
+		if (query_index >= p_batch->query_count) {
 			break;
 		}
+
+		query_task.start_position = p_batch->start_target_positions[query_index * 2 + 0];
+		query_task.target_position = p_batch->start_target_positions[query_index * 2 + 1];
+		query_task.begin_polygon = nullptr;
+		query_task.end_polygon = nullptr;
+		query_task.status = NavMeshQueries3D::NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED;
+
+		NavMeshQueries3D::query_task_map_iteration_get_path(query_task, map_iteration);
+		_count_path_query_use(query_task);
+
+		p_batch->paths[query_index] = query_task.path_points;
 	}
-	map_iteration.path_query_slots_mutex.unlock();
 
-	if (p_query_task.path_query_slot == nullptr) {
-		map_iteration.path_query_slots_semaphore.post();
-		ERR_FAIL_NULL_MSG(p_query_task.path_query_slot, "No unused NavMap3D path query slot found! This should never happen :(.");
+	_release_path_query_slot(map_iteration, query_task.path_query_slot);
+}
+
+void NavMap3D::_count_path_query_use(const NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task) {
+	if (p_query_task.cluster_corridor_used) {
+		hierarchical_path_query_count.increment();
+	}
+	if (!p_query_task.path_cache_used) {
+		return;
+	}
+	if (p_query_task.path_cache_hit) {
+		path_cache_hit_count.increment();
+	} else {
+		path_cache_miss_count.increment();
 	}
+}
 
-	p_query_task.map_up = map_iteration.map_up;
+NavMeshQueries3D::PathQuerySlot *NavMap3D::_acquire_path_query_slot(NavMapIteration3D &r_map_iteration) {
+	r_map_iteration.path_query_slots_semaphore.wait();
 
-	NavMeshQueries3D::query_task_map_iteration_get_path(p_query_task, map_iteration);
+	NavMeshQueries3D::PathQuerySlot *path_query_slot = nullptr;
 
-	map_iteration.path_query_slots_mutex.lock();
-	uint32_t used_slot_index = p_query_task.path_query_slot->slot_index;
-	map_iteration.path_query_slots[used_slot_index].in_use = false;
-	p_query_task.path_query_slot = nullptr;
-	map_iteration.path_query_slots_mutex.unlock();
+	r_map_iteration.path_query_slots_mutex.lock();
+	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : r_map_iteration.path_query_slots) {
+		if (!p_path_query_slot.in_use) {
+			p_path_query_slot.in_use = true;
+			path_query_slot = &p_path_query_slot;
+			break;
+		}
+	}
+	r_map_iteration.path_query_slots_mutex.unlock();
+
+	if (path_query_slot == nullptr) {
+		r_map_iteration.path_query_slots_semaphore.post();
+	}
+	return path_query_slot;
+}
 
-	map_iteration.path_query_slots_semaphore.post();
+void NavMap3D::_release_path_query_slot(NavMapIteration3D &r_map_iteration, NavMeshQueries3D::PathQuerySlot *p_path_query_slot) {
+	r_map_iteration.path_query_slots_mutex.lock();
+	r_map_iteration.path_query_slots[p_path_query_slot->slot_index].in_use = false;
+	r_map_iteration.path_query_slots_mutex.unlock();
+
+	r_map_iteration.path_query_slots_semaphore.post();
 }
 
 Vector3 NavMap3D::get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
@@ -330,6 +412,20 @@ Vector3 NavMap3D::get_random_point(uint32_t p_navigation_layers, bool p_uniforml
 	return NavMeshQueries3D::map_iteration_get_random_point(map_iteration, p_navigation_layers, p_uniformly);
 }
 
+void NavMap3D::get_flow_directions(const Vector3 &p_target_position, const Vector3 *p_positions, uint32_t p_position_count, uint32_t p_navigation_layers, Vector3 *r_directions) const {
+	if (iteration_id == 0) {
+		NAVMAP_ITERATION_ZERO_ERROR_MSG();
+		for (uint32_t i = 0; i < p_position_count; i++) {
+			r_directions[i] = Vector3();
+		}
+		return;
+	}
+
+	GET_MAP_ITERATION_CONST();
+
+	NavMeshQueries3D::map_iteration_get_flow_directions(map_iteration, p_target_position, p_positions, p_position_count, p_navigation_layers, r_directions);
+}
+
 void NavMap3D::_build_iteration() {
 	if (!iteration_dirty || iteration_building || iteration_ready) {
 		return;
@@ -364,6 +460,8 @@ void NavMap3D::_build_iteration() {
 	iteration_build.use_edge_connections = get_use_edge_connections();
 	iteration_build.edge_connection_margin = get_edge_connection_margin();
 	iteration_build.link_connection_radius = get_link_connection_radius();
+	iteration_build.path_hierarchy_cluster_size = path_hierarchy_cluster_size;
+	iteration_build.path_corridor_cache_size = path_corridor_cache_size;
 
 	uint32_t enabled_region_count = 0;
 	uint32_t enabled_link_count = 0;
@@ -440,6 +538,7 @@ void NavMap3D::_sync_iteration() {
 	performance_data.pm_edge_merge_count = iteration_build.performance_data.pm_edge_merge_count;
 	performance_data.pm_edge_connection_count = iteration_build.performance_data.pm_edge_connection_count;
 	performance_data.pm_edge_free_count = iteration_build.performance_data.pm_edge_free_count;
+	performance_data.pm_path_cluster_count = iteration_build.performance_data.pm_path_cluster_count;
 
 	iteration_id = iteration_id % UINT32_MAX + 1;
 
@@ -459,6 +558,17 @@ void NavMap3D::sync() {
 	performance_data.pm_link_count = links.size();
 	performance_data.pm_obstacle_count = obstacles.size();
 
+	// Path queries can run on other threads, take the counts since the last sync without losing any.
+	const uint32_t path_cache_hits = path_cache_hit_count.get();
+	path_cache_hit_count.sub(path_cache_hits);
+	const uint32_t path_cache_misses = path_cache_miss_count.get();
+	path_cache_miss_count.sub(path_cache_misses);
+	performance_data.pm_path_cache_hit_count = path_cache_hits;
+	performance_data.pm_path_cache_miss_count = path_cache_misses;
+	const uint32_t hierarchical_path_queries = hierarchical_path_query_count.get();
+	hierarchical_path_query_count.sub(hierarchical_path_queries);
+	performance_data.pm_hierarchical_path_query_count = hierarchical_path_queries;
+
 	_sync_dirty_map_update_requests();
 
 	if (iteration_dirty && !iteration_building && !iteration_ready) {
@@ -598,7 +708,9 @@ void NavMap3D::_update_rvo_simulation() {
 		_update_rvo_obstacles_tree_2d();
 	}
 	if (agents_dirty) {
-		_update_rvo_agents_tree_2d();
+		if (!avoidance_use_spatial_grid) {
+			_update_rvo_agents_tree_2d();
+		}
 		_update_rvo_agents_tree_3d();
 	}
 }
@@ -617,34 +729,244 @@ void NavMap3D::compute_single_avoidance_step_3d(uint32_t index, NavAgent3D **age
 	(*(agent + index))->update();
 }
 
+void NavMap3D::compute_single_avoidance_velocity_2d(uint32_t index, NavAgent3D **agent) {
+	(*(agent + index))->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
+	(*(agent + index))->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
+}
+
+void NavMap3D::compute_single_avoidance_velocity_3d(uint32_t index, NavAgent3D **agent) {
+	(*(agent + index))->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
+	(*(agent + index))->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
+}
+
+void NavMap3D::apply_single_avoidance_velocity_2d(uint32_t index, NavAgent3D **agent) {
+	(*(agent + index))->get_rvo_agent_2d()->update(&rvo_simulation_2d);
+	(*(agent + index))->update();
+}
+
+void NavMap3D::apply_single_avoidance_velocity_3d(uint32_t index, NavAgent3D **agent) {
+	(*(agent + index))->get_rvo_agent_3d()->update(&rvo_simulation_3d);
+	(*(agent + index))->update();
+}
+
+void NavMap3D::compute_avoidance_grid_batch_2d(uint32_t p_batch_index, NavAgent3D **p_agents) {
+	const uint32_t begin = p_batch_index * AVOIDANCE_GRID_BATCH_SIZE;
+	const uint32_t end = MIN(begin + AVOIDANCE_GRID_BATCH_SIZE, active_2d_avoidance_agents.size());
+
+	for (uint32_t i = begin; i < end; i++) {
+		_compute_avoidance_grid_neighbors_2d(i);
+		p_agents[i]->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
+		if (!avoidance_deterministic) {
+			p_agents[i]->get_rvo_agent_2d()->update(&rvo_simulation_2d);
+			p_agents[i]->update();
+		}
+	}
+}
+
 void NavMap3D::step(double p_delta_time) {
 	rvo_simulation_2d.setTimeStep(float(p_delta_time));
 	rvo_simulation_3d.setTimeStep(float(p_delta_time));
 
+	// In deterministic mode all new velocities are computed before any agent applies its own,
+	// so the result does not depend on the order in which threads process the agents.
+
 	if (active_2d_avoidance_agents.size() > 0) {
+		if (avoidance_use_spatial_grid) {
+			_update_avoidance_grid_2d();
+		}
+
 		if (use_threads && avoidance_use_multiple_threads) {
-			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_single_avoidance_step_2d, active_2d_avoidance_agents.ptr(), active_2d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents2D"));
+			WorkerThreadPool::GroupID group_task;
+			if (avoidance_use_spatial_grid) {
+				const uint32_t batch_count = (active_2d_avoidance_agents.size() + AVOIDANCE_GRID_BATCH_SIZE - 1) / AVOIDANCE_GRID_BATCH_SIZE;
+				group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_avoidance_grid_batch_2d, active_2d_avoidance_agents.ptr(), batch_count, -1, true, SNAME("RVOAvoidanceAgentsGrid2D"));
+			} else if (avoidance_deterministic) {
+				group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_single_avoidance_velocity_2d, active_2d_avoidance_agents.ptr(), active_2d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents2D"));
+			} else {
+				group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_single_avoidance_step_2d, active_2d_avoidance_agents.ptr(), active_2d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents2D"));
+			}
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+			if (avoidance_deterministic) {
+				group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::apply_single_avoidance_velocity_2d, active_2d_avoidance_agents.ptr(), active_2d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgentsApply2D"));
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			}
 		} else {
-			for (NavAgent3D *agent : active_2d_avoidance_agents) {
-				agent->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
+			for (uint32_t i = 0; i < active_2d_avoidance_agents.size(); i++) {
+				NavAgent3D *agent = active_2d_avoidance_agents[i];
+				if (avoidance_use_spatial_grid) {
+					_compute_avoidance_grid_neighbors_2d(i);
+				} else {
+					agent->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
+				}
 				agent->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
-				agent->get_rvo_agent_2d()->update(&rvo_simulation_2d);
-				agent->update();
+				if (!avoidance_deterministic) {
+					agent->get_rvo_agent_2d()->update(&rvo_simulation_2d);
+					agent->update();
+				}
+			}
+
+			if (avoidance_deterministic) {
+				for (NavAgent3D *agent : active_2d_avoidance_agents) {
+					agent->get_rvo_agent_2d()->update(&rvo_simulation_2d);
+					agent->update();
+				}
 			}
 		}
 	}
 
 	if (active_3d_avoidance_agents.size() > 0) {
 		if (use_threads && avoidance_use_multiple_threads) {
-			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_single_avoidance_step_3d, active_3d_avoidance_agents.ptr(), active_3d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents3D"));
+			WorkerThreadPool::GroupID group_task;
+			if (avoidance_deterministic) {
+				group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_single_avoidance_velocity_3d, active_3d_avoidance_agents.ptr(), active_3d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents3D"));
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+				group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::apply_single_avoidance_velocity_3d, active_3d_avoidance_agents.ptr(), active_3d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgentsApply3D"));
+			} else {
+				group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_single_avoidance_step_3d, active_3d_avoidance_agents.ptr(), active_3d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents3D"));
+			}
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
 			for (NavAgent3D *agent : active_3d_avoidance_agents) {
 				agent->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
 				agent->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
-				agent->get_rvo_agent_3d()->update(&rvo_simulation_3d);
-				agent->update();
+				if (!avoidance_deterministic) {
+					agent->get_rvo_agent_3d()->update(&rvo_simulation_3d);
+					agent->update();
+				}
+			}
+
+			if (avoidance_deterministic) {
+				for (NavAgent3D *agent : active_3d_avoidance_agents) {
+					agent->get_rvo_agent_3d()->update(&rvo_simulation_3d);
+					agent->update();
+				}
+			}
+		}
+	}
+}
+
+void NavMap3D::_update_avoidance_grid_2d() {
+	AvoidanceGrid2D &grid = avoidance_grid_2d;
+	const uint32_t agent_count = active_2d_avoidance_agents.size();
+
+	// Agents never search further than one cell away from their own.
+	float max_neighbor_distance = 0.0;
+	for (NavAgent3D *agent : active_2d_avoidance_agents) {
+		const RVO2D::Agent2D *rvo_agent = agent->get_rvo_agent_2d();
+		if (rvo_agent->maxNeighbors_ > 0) {
+			max_neighbor_distance = MAX(max_neighbor_distance, rvo_agent->neighborDist_);
+		}
+	}
+	const float cell_size = MAX(max_neighbor_distance, AVOIDANCE_GRID_MIN_CELL_SIZE);
+
+	bool cells_changed = grid.cell_size != cell_size || grid.agent_cells.size() != agent_count;
+	grid.cell_size = cell_size;
+	grid.agent_cells.resize(agent_count);
+
+	for (uint32_t i = 0; i < agent_count; i++) {
+		const RVO2D::Vector2 &position = active_2d_avoidance_agents[i]->get_rvo_agent_2d()->position_;
+		const Vector2i cell(int(Math::floor(position.x() / cell_size)), int(Math::floor(position.y() / cell_size)));
+		if (grid.agent_cells[i] != cell) {
+			grid.agent_cells[i] = cell;
+			cells_changed = true;
+		}
+	}
+
+	if (cells_changed) {
+		grid.cell_indices.clear();
+		grid.cell_offsets.clear();
+		grid.cell_offsets.push_back(0);
+		grid.agent_slots.resize(agent_count);
+		grid.slot_agents.resize(agent_count);
+
+		// Count the agents in each cell, the agent slots temporarily hold the cell indices.
+		for (uint32_t i = 0; i < agent_count; i++) {
+			uint32_t *cell_index = grid.cell_indices.getptr(grid.agent_cells[i]);
+			if (cell_index == nullptr) {
+				cell_index = &grid.cell_indices.insert(grid.agent_cells[i], grid.cell_offsets.size() - 1)->value;
+				grid.cell_offsets.push_back(0);
+			}
+			grid.agent_slots[i] = *cell_index;
+			grid.cell_offsets[*cell_index + 1]++;
+		}
+
+		for (uint32_t i = 1; i < grid.cell_offsets.size(); i++) {
+			grid.cell_offsets[i] += grid.cell_offsets[i - 1];
+		}
+
+		LocalVector<uint32_t> cell_cursors = grid.cell_offsets;
+		for (uint32_t i = 0; i < agent_count; i++) {
+			const uint32_t slot = cell_cursors[grid.agent_slots[i]]++;
+			grid.agent_slots[i] = slot;
+			grid.slot_agents[slot] = i;
+		}
+	}
+
+	grid.position_x.resize(agent_count);
+	grid.position_y.resize(agent_count);
+	grid.elevation.resize(agent_count);
+	grid.top.resize(agent_count);
+	grid.priority.resize(agent_count);
+	grid.layers.resize(agent_count);
+
+	for (uint32_t slot = 0; slot < agent_count; slot++) {
+		const RVO2D::Agent2D *rvo_agent = active_2d_avoidance_agents[grid.slot_agents[slot]]->get_rvo_agent_2d();
+		grid.position_x[slot] = rvo_agent->position_.x();
+		grid.position_y[slot] = rvo_agent->position_.y();
+		grid.elevation[slot] = rvo_agent->elevation_;
+		grid.top[slot] = rvo_agent->elevation_ + rvo_agent->height_;
+		grid.priority[slot] = rvo_agent->avoidance_priority_;
+		grid.layers[slot] = rvo_agent->avoidance_layers_;
+	}
+}
+
+void NavMap3D::_compute_avoidance_grid_neighbors_2d(uint32_t p_agent_index) {
+	const AvoidanceGrid2D &grid = avoidance_grid_2d;
+	RVO2D::Agent2D *rvo_agent = active_2d_avoidance_agents[p_agent_index]->get_rvo_agent_2d();
+
+	rvo_agent->obstacleNeighbors_.clear();
+	rvo_simulation_2d.kdTree_->computeObstacleNeighbors(rvo_agent, RVO2D::sqr(rvo_agent->timeHorizonObst_ * rvo_agent->maxSpeed_ + rvo_agent->radius_));
+
+	rvo_agent->agentNeighbors_.clear();
+	if (rvo_agent->maxNeighbors_ == 0) {
+		return;
+	}
+
+	// Same filters as RVO2D::Agent2D::insertAgentNeighbor(), checked on the grid arrays first
+	// so most candidates are rejected without touching the other agents.
+	const uint32_t self_slot = grid.agent_slots[p_agent_index];
+	const float position_x = grid.position_x[self_slot];
+	const float position_y = grid.position_y[self_slot];
+	const float elevation = grid.elevation[self_slot];
+	const float top = grid.top[self_slot];
+	const float priority = grid.priority[self_slot];
+	const uint32_t mask = rvo_agent->avoidance_mask_;
+
+	float range_sq = RVO2D::sqr(rvo_agent->neighborDist_);
+	const Vector2i &agent_cell = grid.agent_cells[p_agent_index];
+
+	for (int y = agent_cell.y - 1; y <= agent_cell.y + 1; y++) {
+		for (int x = agent_cell.x - 1; x <= agent_cell.x + 1; x++) {
+			const uint32_t *cell_index = grid.cell_indices.getptr(Vector2i(x, y));
+			if (cell_index == nullptr) {
+				continue;
+			}
+
+			const uint32_t slot_end = grid.cell_offsets[*cell_index + 1];
+			for (uint32_t slot = grid.cell_offsets[*cell_index]; slot < slot_end; slot++) {
+				const float dx = grid.position_x[slot] - position_x;
+				const float dy = grid.position_y[slot] - position_y;
+				if (dx * dx + dy * dy >= range_sq) {
+					continue;
+				}
+				if (slot == self_slot || (mask & grid.layers[slot]) == 0 || priority > grid.priority[slot]) {
+					continue;
+				}
+				if (elevation > grid.top[slot] || top < grid.elevation[slot]) {
+					continue;
+				}
+				rvo_agent->insertAgentNeighbor(active_2d_avoidance_agents[grid.slot_agents[slot]]->get_rvo_agent_2d(), range_sq);
 			}
 		}
 	}
@@ -834,8 +1156,12 @@ bool NavMap3D::get_use_async_iterations() const {
 NavMap3D::NavMap3D() {
 	avoidance_use_multiple_threads = GLOBAL_GET("navigation/avoidance/thread_model/avoidance_use_multiple_threads");
 	avoidance_use_high_priority_threads = GLOBAL_GET("navigation/avoidance/thread_model/avoidance_use_high_priority_threads");
+	avoidance_use_spatial_grid = GLOBAL_GET("navigation/3d/avoidance_use_spatial_grid");
+	avoidance_deterministic = GLOBAL_GET("navigation/3d/avoidance_deterministic");
 
 	path_query_slots_max = GLOBAL_GET("navigation/pathfinding/max_threads");
+	path_hierarchy_cluster_size = GLOBAL_GET("navigation/3d/path_hierarchy_cluster_size");
+	path_corridor_cache_size = MAX(0, int(GLOBAL_GET("navigation/3d/path_cache_size")));
 
 	int processor_count = OS::get_singleton()->get_processor_count();
 	if (path_query_slots_max < 0) {
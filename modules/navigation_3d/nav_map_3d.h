@@ -71,6 +71,15 @@ class NavMap3D : public NavRid3D {
 	/// This value is used to limit how far links search to find polygons to connect to.
 	real_t link_connection_radius = NavigationDefaults3D::LINK_CONNECTION_RADIUS;
 
+	/// This value is used to group polygons into clusters for hierarchical path queries, 0 disables the path hierarchy.
+	real_t path_hierarchy_cluster_size = 0.0;
+
+	/// How many path corridors are kept for reuse by later path queries, 0 disables the cache.
+	uint32_t path_corridor_cache_size = 0;
+	SafeNumeric<uint32_t> path_cache_hit_count;
+	SafeNumeric<uint32_t> path_cache_miss_count;
+	SafeNumeric<uint32_t> hierarchical_path_query_count;
+
 	bool map_settings_dirty = true;
 
 	/// Map regions
@@ -105,6 +114,36 @@ class NavMap3D : public NavRid3D {
 	bool use_threads = true;
 	bool avoidance_use_multiple_threads = true;
 	bool avoidance_use_high_priority_threads = true;
+	bool avoidance_use_spatial_grid = false;
+	bool avoidance_deterministic = false;
+
+	/// Number of 2D avoidance agents handled by one spatial grid task.
+	static constexpr uint32_t AVOIDANCE_GRID_BATCH_SIZE = 64;
+	static constexpr float AVOIDANCE_GRID_MIN_CELL_SIZE = 0.1;
+
+	/// Uniform grid over the 2D avoidance agents, used instead of the RVO kd-tree for neighbor searches.
+	/// Agents are binned in CSR layout and their search data is copied into arrays in cell order
+	/// so neighbor searches scan contiguous memory. The binning is only rebuilt when an agent changes cell.
+	struct AvoidanceGrid2D {
+		float cell_size = 0.0;
+
+		// Indexed by agent.
+		LocalVector<Vector2i> agent_cells;
+		LocalVector<uint32_t> agent_slots;
+
+		// Indexed by cell.
+		HashMap<Vector2i, uint32_t> cell_indices;
+		LocalVector<uint32_t> cell_offsets;
+
+		// Indexed by slot, in cell order.
+		LocalVector<uint32_t> slot_agents;
+		LocalVector<float> position_x;
+		LocalVector<float> position_y;
+		LocalVector<float> elevation;
+		LocalVector<float> top;
+		LocalVector<float> priority;
+		LocalVector<uint32_t> layers;
+	} avoidance_grid_2d;
 
 	// Performance Monitor
 	Nav3D::PerformanceData performance_data;
@@ -136,6 +175,20 @@ class NavMap3D : public NavRid3D {
 	void _build_iteration();
 	void _sync_iteration();
 
+	struct PathQueryBatch {
+		NavMapIteration3D *map_iteration = nullptr;
+		const NavMeshQueries3D::NavMeshPathQueryTask3D *query_template = nullptr;
+		const Vector3 *start_target_positions = nullptr;
+		uint32_t query_count = 0;
+		SafeNumeric<uint32_t> next_query;
+		LocalVector<Vector3> *paths = nullptr;
+	};
+
+	NavMeshQueries3D::PathQuerySlot *_acquire_path_query_slot(NavMapIteration3D &r_map_iteration);
+	void _release_path_query_slot(NavMapIteration3D &r_map_iteration, NavMeshQueries3D::PathQuerySlot *p_path_query_slot);
+	void _query_path_batch_task(uint32_t p_index, PathQueryBatch *p_batch);
+	void _count_path_query_use(const NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task);
+
 public:
 	NavMap3D();
 	~NavMap3D();
@@ -179,6 +232,8 @@ public:
 	const Vector3 &get_merge_rasterizer_cell_size() const;
 
 	void query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task);
+	// Runs one path query per start and target pair with the parameters of `p_query_template`.
+	void query_path_batch(const NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_template, const Vector3 *p_start_target_positions, uint32_t p_query_count, LocalVector<LocalVector<Vector3>> &r_paths);
 
 	Vector3 get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const;
 	Vector3 get_closest_point(const Vector3 &p_point) const;
@@ -216,6 +271,8 @@ public:
 	}
 
 	Vector3 get_random_point(uint32_t p_navigation_layers, bool p_uniformly) const;
+	// Writes the direction towards `p_target_position` along the map's flow field for each position.
+	void get_flow_directions(const Vector3 &p_target_position, const Vector3 *p_positions, uint32_t p_position_count, uint32_t p_navigation_layers, Vector3 *r_directions) const;
 
 	void sync();
 	void step(double p_delta_time);
@@ -231,6 +288,10 @@ public:
 	int get_pm_edge_connection_count() const { return performance_data.pm_edge_connection_count; }
 	int get_pm_edge_free_count() const { return performance_data.pm_edge_free_count; }
 	int get_pm_obstacle_count() const { return performance_data.pm_obstacle_count; }
+	int get_pm_path_cache_hit_count() const { return performance_data.pm_path_cache_hit_count; }
+	int get_pm_path_cache_miss_count() const { return performance_data.pm_path_cache_miss_count; }
+	int get_pm_path_cluster_count() const { return performance_data.pm_path_cluster_count; }
+	int get_pm_hierarchical_path_query_count() const { return performance_data.pm_hierarchical_path_query_count; }
 
 	int get_region_connections_count(NavRegion3D *p_region) const;
 	Vector3 get_region_connection_pathway_start(NavRegion3D *p_region, int p_connection_id) const;
@@ -257,12 +318,19 @@ private:
 
 	void compute_single_avoidance_step_2d(uint32_t index, NavAgent3D **agent);
 	void compute_single_avoidance_step_3d(uint32_t index, NavAgent3D **agent);
+	void compute_single_avoidance_velocity_2d(uint32_t index, NavAgent3D **agent);
+	void compute_single_avoidance_velocity_3d(uint32_t index, NavAgent3D **agent);
+	void apply_single_avoidance_velocity_2d(uint32_t index, NavAgent3D **agent);
+	void apply_single_avoidance_velocity_3d(uint32_t index, NavAgent3D **agent);
+	void compute_avoidance_grid_batch_2d(uint32_t p_batch_index, NavAgent3D **p_agents);
 
 	void _sync_avoidance();
 	void _update_rvo_simulation();
 	void _update_rvo_obstacles_tree_2d();
 	void _update_rvo_agents_tree_2d();
 	void _update_rvo_agents_tree_3d();
+	void _update_avoidance_grid_2d();
+	void _compute_avoidance_grid_neighbors_2d(uint32_t p_agent_index);
 
 	void _update_merge_rasterizer_cell_dimensions();
 };
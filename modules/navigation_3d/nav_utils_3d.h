@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/math/vector2i.h"
 #include "core/math/vector3.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/hashfuncs.h"
@@ -172,6 +173,143 @@ struct NavPolyHeapIndexer {
 	}
 };
 
+/// A group of connected polygons of the same owner within one cell of the map's path hierarchy grid.
+/// Link polygons each form a cluster of their own.
+struct PathCluster {
+	const NavBaseIteration3D *owner = nullptr;
+
+	/// Average of the polygon centers, used to estimate travel costs between clusters.
+	Vector3 center;
+
+	/// Range of the outgoing links of this cluster in the map's `path_cluster_links`.
+	uint32_t link_begin = 0;
+	uint32_t link_count = 0;
+};
+
+struct PathClusterLink {
+	/// Cluster this link leads to.
+	uint32_t cluster = 0;
+
+	/// Estimated travel cost from the center of the source cluster to the center of the target cluster.
+	real_t cost = 0.0;
+};
+
+struct NavigationCluster {
+	/// Index of this cluster in the map.
+	uint32_t id = UINT32_MAX;
+
+	/// Index in the heap of traversable clusters.
+	uint32_t traversable_cluster_index = UINT32_MAX;
+
+	uint32_t back_navigation_cluster_id = UINT32_MAX;
+
+	/// The estimated cost traveled until now (g cost).
+	real_t traveled_cost = FLT_MAX;
+	/// The estimated cost to the destination (h cost).
+	real_t cost_to_destination = 0.0;
+
+	/// The total travel cost (f cost).
+	real_t total_travel_cost() const {
+		return traveled_cost + cost_to_destination;
+	}
+
+	void reset() {
+		traversable_cluster_index = UINT32_MAX;
+		back_navigation_cluster_id = UINT32_MAX;
+		traveled_cost = FLT_MAX;
+		cost_to_destination = 0.0;
+	}
+};
+
+struct NavClusterTravelCostGreaterThan {
+	// Returns `true` if the travel cost of `a` is higher than that of `b`.
+	bool operator()(const NavigationCluster *p_cluster_a, const NavigationCluster *p_cluster_b) const {
+		real_t f_cost_a = p_cluster_a->total_travel_cost();
+		real_t f_cost_b = p_cluster_b->total_travel_cost();
+
+		if (f_cost_a != f_cost_b) {
+			return f_cost_a > f_cost_b;
+		} else {
+			return p_cluster_a->cost_to_destination > p_cluster_b->cost_to_destination;
+		}
+	}
+};
+
+struct NavClusterHeapIndexer {
+	void operator()(NavigationCluster *p_cluster, uint32_t p_heap_index) const {
+		p_cluster->traversable_cluster_index = p_heap_index;
+	}
+};
+
+/// A polygon crossed by a cached path corridor, together with the pathway it was entered through.
+struct PathCorridorStep {
+	const Polygon *polygon = nullptr;
+	int back_navigation_edge = -1;
+	Vector3 back_navigation_edge_pathway_start;
+	Vector3 back_navigation_edge_pathway_end;
+};
+
+struct PathCorridorKey {
+	uint32_t begin_polygon_id = UINT32_MAX;
+	uint32_t end_polygon_id = UINT32_MAX;
+	uint32_t navigation_layers = 0;
+	bool use_hierarchical_pathfinding = false;
+
+	static uint32_t hash(const PathCorridorKey &p_key) {
+		uint32_t h = hash_murmur3_one_32(p_key.begin_polygon_id);
+		h = hash_murmur3_one_32(p_key.end_polygon_id, h);
+		h = hash_murmur3_one_32(p_key.navigation_layers, h);
+		h = hash_murmur3_one_32(p_key.use_hierarchical_pathfinding, h);
+		return hash_fmix32(h);
+	}
+
+	bool operator==(const PathCorridorKey &p_key) const {
+		return begin_polygon_id == p_key.begin_polygon_id && end_polygon_id == p_key.end_polygon_id && navigation_layers == p_key.navigation_layers && use_hierarchical_pathfinding == p_key.use_hierarchical_pathfinding;
+	}
+};
+
+struct FlowFieldKey {
+	uint32_t goal_polygon_id = UINT32_MAX;
+	uint32_t navigation_layers = 0;
+
+	static uint32_t hash(const FlowFieldKey &p_key) {
+		uint32_t h = hash_murmur3_one_32(p_key.goal_polygon_id);
+		h = hash_murmur3_one_32(p_key.navigation_layers, h);
+		return hash_fmix32(h);
+	}
+
+	bool operator==(const FlowFieldKey &p_key) const {
+		return goal_polygon_id == p_key.goal_polygon_id && navigation_layers == p_key.navigation_layers;
+	}
+};
+
+/// The pathway each polygon is left through on the shortest route towards a goal polygon, indexed by polygon id.
+/// Polygons that can not reach the goal have no next polygon and an infinite distance.
+struct FlowField {
+	const Polygon *goal_polygon = nullptr;
+	LocalVector<Vector3> pathway_starts;
+	LocalVector<Vector3> pathway_ends;
+	LocalVector<uint32_t> next_polygon_ids;
+	LocalVector<real_t> distances;
+};
+
+/// The polygons overlapping each cell of a uniform grid on the map's horizontal plane, stored in CSR layout.
+struct PolygonLookupGrid {
+	bool built = false;
+	Vector3 origin;
+	real_t cell_size = 1.0;
+	Vector2i size;
+	LocalVector<uint32_t> cell_offsets;
+	LocalVector<const Polygon *> cell_polygons;
+
+	void clear() {
+		built = false;
+		size = Vector2i();
+		cell_offsets.clear();
+		cell_polygons.clear();
+	}
+};
+
 struct ClosestPointQueryResult {
 	Vector3 point;
 	Vector3 normal;
@@ -193,6 +331,10 @@ struct PerformanceData {
 	int pm_edge_connection_count = 0;
 	int pm_edge_free_count = 0;
 	int pm_obstacle_count = 0;
+	int pm_path_cache_hit_count = 0;
+	int pm_path_cache_miss_count = 0;
+	int pm_path_cluster_count = 0;
+	int pm_hierarchical_path_query_count = 0;
 
 	void reset() {
 		pm_region_count = 0;
@@ -204,6 +346,10 @@ struct PerformanceData {
 		pm_edge_connection_count = 0;
 		pm_edge_free_count = 0;
 		pm_obstacle_count = 0;
+		pm_path_cache_hit_count = 0;
+		pm_path_cache_miss_count = 0;
+		pm_path_cluster_count = 0;
+		pm_hierarchical_path_query_count = 0;
 	}
 };
 
@@ -0,0 +1,131 @@
+/**************************************************************************/
+/*  test_nav_mesh_generator_3d.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../3d/nav_mesh_generator_3d.h"
+
+#include "core/templates/hash_set.h"
+#include "scene/resources/3d/navigation_mesh_source_geometry_data_3d.h"
+#include "scene/resources/3d/primitive_meshes.h"
+#include "scene/resources/navigation_mesh.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNavMeshGenerator3D {
+
+TEST_SUITE("[Navigation3D]") {
+	TEST_CASE("[NavMeshGenerator3D] Generator should bake navigation meshes in tiles") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		navigation_mesh->set_tile_size(5.0);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(20.0, 0.001, 20.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+		const Vector<Vector3> first_bake_vertices = navigation_mesh->get_vertices();
+		const int first_bake_polygon_count = navigation_mesh->get_polygon_count();
+		const int first_bake_tile_count = NavMeshGenerator3D::get_baked_tile_count(navigation_mesh);
+		CHECK_GT(first_bake_tile_count, 1);
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		SUBCASE("Paths should cross tile edges") {
+			const Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-8, 0, -8), Vector3(8, 0, 8), true);
+			REQUIRE_GT(path.size(), 1);
+			CHECK(path[path.size() - 1].distance_to(Vector3(8, 0, 8)) < 0.5);
+		}
+
+		SUBCASE("Baking the same source geometry again should give the same navigation mesh") {
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+			CHECK_EQ(navigation_mesh->get_polygon_count(), first_bake_polygon_count);
+			CHECK_EQ(navigation_mesh->get_vertices(), first_bake_vertices);
+			// Every tile was reused.
+			CHECK_EQ(NavMeshGenerator3D::get_baked_tile_count(navigation_mesh), 0);
+		}
+
+		SUBCASE("Changed tiles should be baked again") {
+			Array obstacle_arr;
+			obstacle_arr.resize(RS::ARRAY_MAX);
+			BoxMesh::create_mesh_array(obstacle_arr, Vector3(2.0, 2.0, 2.0));
+			source_geometry->add_mesh_array(obstacle_arr, Transform3D(Basis(), Vector3(2.5, 1.0, 2.5)));
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+			CHECK_NE(navigation_mesh->get_vertices(), first_bake_vertices);
+			// Only the tiles around the obstacle were baked again, the others were reused.
+			const int changed_tile_count = NavMeshGenerator3D::get_baked_tile_count(navigation_mesh);
+			CHECK_GT(changed_tile_count, 0);
+			CHECK_LT(changed_tile_count, first_bake_tile_count);
+			// Vertices far from the obstacle are unchanged.
+			HashSet<Vector3> first_bake_far_vertices;
+			for (const Vector3 &vertex : first_bake_vertices) {
+				if (vertex.x < -5.0 && vertex.z < -5.0) {
+					first_bake_far_vertices.insert(vertex);
+				}
+			}
+			HashSet<Vector3> far_vertices;
+			for (const Vector3 &vertex : navigation_mesh->get_vertices()) {
+				if (vertex.x < -5.0 && vertex.z < -5.0) {
+					CHECK(first_bake_far_vertices.has(vertex));
+					far_vertices.insert(vertex);
+				}
+			}
+			CHECK_EQ(far_vertices.size(), first_bake_far_vertices.size());
+
+			navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			const Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-8, 0, -8), Vector3(8, 0, 8), true);
+			REQUIRE_GT(path.size(), 1);
+			CHECK(path[path.size() - 1].distance_to(Vector3(8, 0, 8)) < 0.5);
+		}
+
+		SUBCASE("The tile cache should be freed with the navigation mesh") {
+			const int tile_cache_count = NavMeshGenerator3D::get_tile_cache_count();
+			navigation_mesh.unref();
+			navigation_server->process(0.0); // Give server some cycles to commit.
+			CHECK_EQ(NavMeshGenerator3D::get_tile_cache_count(), tile_cache_count - 1);
+		}
+
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+}
+
+} // namespace TestNavMeshGenerator3D
@@ -103,11 +103,31 @@ void Node3D::_propagate_transform_changed_deferred() {
 	}
 }
 
+void Node3D::_invalidate_transform_propagation() {
+	// Propagation stops at top level nodes, so ancestors above one never skip this node.
+	Node3D *node = this;
+	while (node) {
+		node->data.xform_propagation_pass = 0;
+		if (node->data.top_level) {
+			break;
+		}
+		node = node->data.parent;
+	}
+}
+
 void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 	if (!is_inside_tree()) {
 		return;
 	}
 
+	// If an earlier propagation since the last notification flush already marked this node dirty,
+	// the whole subtree is still dirty (reading a global transform cleans its ancestors too) and
+	// its notifications are still queued, so there is nothing left to do.
+	const uint32_t pass = get_tree()->xform_change_pass;
+	if (this != p_origin && data.xform_propagation_pass == pass && (_read_dirty_mask() & (DIRTY_GLOBAL_TRANSFORM | DIRTY_GLOBAL_INTERPOLATED_TRANSFORM)) == (DIRTY_GLOBAL_TRANSFORM | DIRTY_GLOBAL_INTERPOLATED_TRANSFORM)) {
+		return;
+	}
+
 	for (Node3D *&E : data.children) {
 		if (E->data.top_level) {
 			continue; //don't propagate to a top_level
@@ -127,6 +147,8 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		}
 	}
 	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM | DIRTY_GLOBAL_INTERPOLATED_TRANSFORM);
+	data.xform_propagation_pass = pass;
+	_notify_spatially_indexed_groups();
 }
 
 void Node3D::_notification(int p_what) {
@@ -152,6 +174,8 @@ void Node3D::_notification(int p_what) {
 			} else {
 				data.C = nullptr;
 			}
+			// Ancestors must not skip propagating to the new node.
+			_invalidate_transform_propagation();
 
 			if (data.top_level && !Engine::get_singleton()->is_editor_hint()) {
 				if (data.parent) {
@@ -801,6 +825,7 @@ void Node3D::add_gizmo(Ref<Node3DGizmo> p_gizmo) {
 		return;
 	}
 	data.gizmos.push_back(p_gizmo);
+	_invalidate_transform_propagation();
 
 	if (p_gizmo.is_valid() && is_inside_world()) {
 		p_gizmo->create();
@@ -1156,6 +1181,7 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 void Node3D::set_notify_transform(bool p_enabled) {
 	ERR_THREAD_GUARD;
 	data.notify_transform = p_enabled;
+	_invalidate_transform_propagation();
 }
 
 bool Node3D::is_transform_notification_enabled() const {
@@ -1180,6 +1206,8 @@ void Node3D::force_update_transform() {
 		return; //nothing to update
 	}
 	get_tree()->xform_change_list.remove(&xform_change);
+	// The notification is sent outside of a flush, later propagations must queue it again.
+	_invalidate_transform_propagation();
 
 	notification(NOTIFICATION_TRANSFORM_CHANGED);
 }
@@ -150,6 +150,9 @@ private:
 		List<Node3D *> children;
 		List<Node3D *>::Element *C = nullptr;
 
+		// SceneTree::xform_change_pass of the last propagation that reached this node, 0 if none.
+		uint32_t xform_propagation_pass = 0;
+
 		ClientPhysicsInterpolationData *client_physics_interpolation_data = nullptr;
 
 #ifdef TOOLS_ENABLED
@@ -172,6 +175,7 @@ private:
 	void _update_gizmos();
 	void _notify_dirty();
 	void _propagate_transform_changed(Node3D *p_origin);
+	void _invalidate_transform_propagation();
 
 	void _propagate_visibility_changed();
 
@@ -180,7 +184,13 @@ private:
 	void _propagate_transform_changed_deferred();
 
 protected:
-	_FORCE_INLINE_ void set_ignore_transform_notification(bool p_ignore) { data.ignore_notification = p_ignore; }
+	_FORCE_INLINE_ void set_ignore_transform_notification(bool p_ignore) {
+		data.ignore_notification = p_ignore;
+		if (!p_ignore) {
+			// Propagations while ignoring didn't queue the notification, later ones must not be skipped.
+			_invalidate_transform_propagation();
+		}
+	}
 
 	_FORCE_INLINE_ void _update_local_transform() const;
 	_FORCE_INLINE_ void _update_rotation_and_scale() const;
@@ -623,6 +623,7 @@ void PropertyTweener::start() {
 	}
 
 	delta_val = Animation::subtract_variant(final_val, initial_val);
+	end_val = Animation::add_variant(initial_val, delta_val);
 }
 
 bool PropertyTweener::step(double &r_delta) {
@@ -644,19 +645,21 @@ bool PropertyTweener::step(double &r_delta) {
 	} else if (do_continue_delayed && !Math::is_zero_approx(delay)) {
 		initial_val = target_instance->get_indexed(property);
 		delta_val = Animation::subtract_variant(final_val, initial_val);
+		end_val = Animation::add_variant(initial_val, delta_val);
 		do_continue_delayed = false;
 	}
 
-	Ref<Tween> tween = _get_tween();
-
 	double time = MIN(elapsed_time - delay, duration);
 	if (time < duration) {
 		if (custom_method.is_valid()) {
-			const Variant t = tween->interpolate_variant(0.0, 1.0, time, duration, trans_type, ease_type);
+			const Variant t = Tween::interpolate_variant(0.0, 1.0, time, duration, trans_type, ease_type);
 			double result = _get_custom_interpolated_value(t);
 			target_instance->set_indexed(property, Animation::interpolate_variant(initial_val, final_val, result));
+		} else if (likely((uint32_t)trans_type < Tween::TRANS_MAX && (uint32_t)ease_type < Tween::EASE_MAX)) {
+			// Same as Tween::interpolate_variant(), with the end value already added up.
+			target_instance->set_indexed(property, Animation::interpolate_variant(initial_val, end_val, Tween::run_equation(trans_type, ease_type, time, 0.0, 1.0, duration), initial_val.is_string()));
 		} else {
-			target_instance->set_indexed(property, tween->interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type));
+			target_instance->set_indexed(property, Tween::interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type));
 		}
 		r_delta = 0;
 		return true;
@@ -817,12 +820,10 @@ bool MethodTweener::step(double &r_delta) {
 		return true;
 	}
 
-	Ref<Tween> tween = _get_tween();
-
 	Variant current_val;
 	double time = MIN(elapsed_time - delay, duration);
 	if (time < duration) {
-		current_val = tween->interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type);
+		current_val = Tween::interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type);
 	} else {
 		current_val = final_val;
 	}
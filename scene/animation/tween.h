@@ -228,6 +228,7 @@ private:
 	Variant base_final_val;
 	Variant final_val;
 	Variant delta_val;
+	Variant end_val; // initial_val + delta_val, computed once instead of on every step.
 
 	Ref<RefCounted> ref_copy; // Makes sure that RefCounted objects are not freed too early.
 
@@ -1042,6 +1042,7 @@ void CanvasItem::_notify_transform(CanvasItem *p_node) {
 	}
 
 	p_node->_set_global_invalid(true);
+	p_node->_notify_spatially_indexed_groups();
 
 	if (p_node->notify_transform && !p_node->xform_change.in_list()) {
 		if (!p_node->block_transform_notify) {
@@ -1889,6 +1889,166 @@ void Node::remove_child(Node *p_child) {
 	}
 }
 
+void Node::add_children_bulk(const TypedArray<Node> &p_children, bool p_force_readable_name, InternalMode p_internal) {
+	ERR_FAIL_COND_MSG(data.inside_tree && !Thread::is_main_thread(), "Adding children to a node inside the SceneTree is only allowed from the main thread. Use call_deferred(\"add_children_bulk\",nodes).");
+
+	ERR_THREAD_GUARD
+	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy setting up children, `add_children_bulk()` failed. Consider using `add_children_bulk.call_deferred(children)` instead.");
+
+	LocalVector<Node *> added;
+	added.reserve(p_children.size());
+	data.children.reserve(data.children.size() + p_children.size());
+	if (!data.children_cache_dirty && p_internal == INTERNAL_MODE_DISABLED && data.internal_children_back_count_cache == 0) {
+		data.children_cache.reserve(data.children_cache.size() + p_children.size());
+	}
+
+	// Link every child first, the same checks as add_child() apply to each of them.
+	for (int i = 0; i < p_children.size(); i++) {
+		Node *child = Object::cast_to<Node>(p_children[i]);
+		ERR_CONTINUE(!child);
+		ERR_CONTINUE_MSG(child == this, vformat("Can't add child '%s' to itself.", child->get_name()));
+		ERR_CONTINUE_MSG(child->data.parent, vformat("Can't add child '%s' to '%s', already has a parent '%s'.", child->get_name(), get_name(), child->data.parent->get_name()));
+#ifdef DEBUG_ENABLED
+		ERR_CONTINUE_MSG(child->is_ancestor_of(this), vformat("Can't add child '%s' to '%s' as it would result in a cyclic dependency since '%s' is already a parent of '%s'.", child->get_name(), get_name(), child->get_name(), get_name()));
+#endif
+
+		_validate_child_name(child, p_force_readable_name);
+
+#ifdef DEBUG_ENABLED
+		if (child->data.owner && !child->data.owner->is_ancestor_of(child)) {
+			// Owner of child should be ancestor of child.
+			WARN_PRINT(vformat("Adding '%s' as child to '%s' will make owner '%s' inconsistent. Consider unsetting the owner beforehand.", child->get_name(), get_name(), child->data.owner->get_name()));
+		}
+#endif // DEBUG_ENABLED
+
+		const StringName &name = child->data.name;
+		data.children.insert(name, child);
+
+		child->data.internal_mode = p_internal;
+		switch (p_internal) {
+			case INTERNAL_MODE_FRONT: {
+				child->data.index = data.internal_children_front_count_cache++;
+			} break;
+			case INTERNAL_MODE_BACK: {
+				child->data.index = data.internal_children_back_count_cache++;
+			} break;
+			case INTERNAL_MODE_DISABLED: {
+				child->data.index = data.external_children_count_cache++;
+			} break;
+		}
+
+		child->data.parent = this;
+
+		if (!data.children_cache_dirty && p_internal == INTERNAL_MODE_DISABLED && data.internal_children_back_count_cache == 0) {
+			data.children_cache.push_back(child);
+		} else {
+			data.children_cache_dirty = true;
+		}
+
+		child->notification(NOTIFICATION_PARENTED);
+		added.push_back(child);
+	}
+
+	if (added.is_empty()) {
+		return;
+	}
+
+	if (data.tree) {
+		// Like a scene entering the tree: every child enters before any of them is ready.
+		// Group members and process lists are appended to and only sorted when next used, as with add_child().
+		SceneTree *tree = data.tree;
+		tree->_begin_tree_changed_batch();
+		tree->group_insert_batch++;
+
+		for (Node *child : added) {
+			if (child->data.parent == this && !child->data.tree) {
+				child->data.tree = tree;
+				child->_propagate_enter_tree();
+			}
+		}
+
+		tree->group_insert_batch--;
+
+		if (data.ready_notified) {
+			for (Node *child : added) {
+				if (child->data.parent == this && child->data.inside_tree && !child->data.ready_notified) {
+					child->_propagate_ready();
+				}
+			}
+		}
+
+		tree->tree_changed();
+		tree->_end_tree_changed_batch();
+	}
+
+	/* Notify */
+	for (Node *child : added) {
+		add_child_notify(child);
+	}
+	notification(NOTIFICATION_CHILD_ORDER_CHANGED);
+	emit_signal(SNAME("child_order_changed"));
+}
+
+void Node::remove_children_bulk(const TypedArray<Node> &p_children) {
+	ERR_FAIL_COND_MSG(data.inside_tree && !Thread::is_main_thread(), "Removing children from a node inside the SceneTree is only allowed from the main thread. Use call_deferred(\"remove_children_bulk\",nodes).");
+	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy adding/removing children, `remove_children_bulk()` can't be called at this time. Consider using `remove_children_bulk.call_deferred(children)` instead.");
+
+	LocalVector<Node *> removed;
+	HashSet<Node *> seen;
+	removed.reserve(p_children.size());
+	seen.reserve(p_children.size());
+	for (int i = 0; i < p_children.size(); i++) {
+		Node *child = Object::cast_to<Node>(p_children[i]);
+		ERR_CONTINUE(!child);
+		ERR_CONTINUE(child->data.parent != this);
+		ERR_CONTINUE_MSG(seen.has(child), vformat("Child '%s' is listed more than once.", child->get_name()));
+		seen.insert(child);
+		removed.push_back(child);
+	}
+
+	if (removed.is_empty()) {
+		return;
+	}
+
+	// As in remove_child(), the internal children counters are left untouched.
+	SceneTree *tree = data.tree;
+	if (tree) {
+		tree->_begin_tree_changed_batch();
+	}
+
+	data.blocked++;
+	for (Node *child : removed) {
+		child->_set_tree(nullptr);
+	}
+	for (Node *child : removed) {
+		remove_child_notify(child);
+		child->notification(NOTIFICATION_UNPARENTED);
+	}
+	data.blocked--;
+
+	data.children_cache_dirty = true;
+	for (Node *child : removed) {
+		bool success = data.children.erase(child->data.name);
+		ERR_CONTINUE_MSG(!success, "Children name does not match parent name in hashtable, this is a bug.");
+
+		child->data.parent = nullptr;
+		child->data.index = -1;
+	}
+
+	notification(NOTIFICATION_CHILD_ORDER_CHANGED);
+	emit_signal(SNAME("child_order_changed"));
+
+	if (data.inside_tree) {
+		for (Node *child : removed) {
+			child->_propagate_after_exit_tree();
+		}
+	}
+
+	if (tree) {
+		tree->_end_tree_changed_batch();
+	}
+}
+
 void Node::_update_children_cache_impl() const {
 	// Assign children
 	data.children_cache.resize(data.children.size());
@@ -3849,6 +4009,8 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_name"), &Node::get_name);
 	ClassDB::bind_method(D_METHOD("add_child", "node", "force_readable_name", "internal"), &Node::add_child, DEFVAL(false), DEFVAL(0));
 	ClassDB::bind_method(D_METHOD("remove_child", "node"), &Node::remove_child);
+	ClassDB::bind_method(D_METHOD("add_children_bulk", "nodes", "force_readable_name", "internal"), &Node::add_children_bulk, DEFVAL(false), DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("remove_children_bulk", "nodes"), &Node::remove_children_bulk);
 	ClassDB::bind_method(D_METHOD("reparent", "new_parent", "keep_global_transform"), &Node::reparent, DEFVAL(true));
 	ClassDB::bind_method(D_METHOD("get_child_count", "include_internal"), &Node::get_child_count, DEFVAL(false)); // Note that the default value bound for include_internal is false, while the method is declared with true. This is because internal nodes are irrelevant for GDSCript.
 	ClassDB::bind_method(D_METHOD("get_children", "include_internal"), &Node::get_children, DEFVAL(false));
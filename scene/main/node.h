@@ -199,6 +199,7 @@ private:
 		TypedArray<NodePath> accessibility_flow_to_nodes;
 
 		HashMap<StringName, GroupData> grouped;
+		uint32_t spatially_indexed_groups = 0; // Groups tracking this node's position, see SceneTree::enable_group_spatial_index().
 		List<Node *>::Element *OW = nullptr; // Owned element.
 		List<Node *> owned;
 
@@ -391,6 +392,13 @@ protected:
 protected:
 	virtual bool _uses_signal_mutex() const override { return false; } // Node uses thread guards instead.
 
+	// Called by Node2D and Node3D when their global transform becomes invalid.
+	_FORCE_INLINE_ void _notify_spatially_indexed_groups() {
+		if (unlikely(data.spatially_indexed_groups > 0)) {
+			data.tree->_mark_group_spatial_indices_dirty(this);
+		}
+	}
+
 	virtual void input(const Ref<InputEvent> &p_event);
 	virtual void shortcut_input(const Ref<InputEvent> &p_key_event);
 	virtual void unhandled_input(const Ref<InputEvent> &p_event);
@@ -487,6 +495,8 @@ public:
 	void add_child(Node *p_child, bool p_force_readable_name = false, InternalMode p_internal = INTERNAL_MODE_DISABLED);
 	void add_sibling(Node *p_sibling, bool p_force_readable_name = false);
 	void remove_child(Node *p_child);
+	void add_children_bulk(const TypedArray<Node> &p_children, bool p_force_readable_name = false, InternalMode p_internal = INTERNAL_MODE_DISABLED);
+	void remove_children_bulk(const TypedArray<Node> &p_children);
 
 	int get_child_count(bool p_include_internal = true) const;
 	Node *get_child(int p_index, bool p_include_internal = true) const;
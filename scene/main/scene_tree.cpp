@@ -31,6 +31,7 @@
 #include "scene_tree.h"
 
 #include "core/config/project_settings.h"
+#include "core/debugger/frame_trace.h"
 #include "core/input/input.h"
 #include "core/io/image_loader.h"
 #include "core/io/resource_loader.h"
@@ -38,6 +39,7 @@
 #include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "node.h"
+#include "scene/2d/node_2d.h"
 #include "scene/animation/tween.h"
 #include "scene/debugger/scene_debugger.h"
 #include "scene/gui/control.h"
@@ -73,16 +75,49 @@ void SceneTreeTimer::_bind_methods() {
 	ADD_SIGNAL(MethodInfo("timeout"));
 }
 
+// Setters may be called from any thread, while the tree updates its timer heaps under its lock.
+SceneTree *SceneTreeTimer::_lock_tree() {
+	SceneTree *scene_tree = SceneTree::get_singleton();
+	if (scene_tree) {
+		scene_tree->_thread_safe_.lock();
+	}
+	return scene_tree;
+}
+
+void SceneTreeTimer::_unlock_tree(SceneTree *p_tree) {
+	if (p_tree) {
+		p_tree->_thread_safe_.unlock();
+	}
+}
+
 void SceneTreeTimer::set_time_left(double p_time) {
-	time_left = p_time;
+	SceneTree *locked_tree = _lock_tree();
+	if (tree) {
+		tree->_schedule_timer(this, p_time);
+	} else {
+		time_left = p_time;
+	}
+	_unlock_tree(locked_tree);
 }
 
 double SceneTreeTimer::get_time_left() const {
+	if (tree) {
+		return MAX(timeout - *clock, 0.0);
+	}
 	return MAX(time_left, 0.0);
 }
 
 void SceneTreeTimer::set_process_always(bool p_process_always) {
-	process_always = p_process_always;
+	SceneTree *locked_tree = _lock_tree();
+	if (tree && process_always != p_process_always) {
+		// Move to the other clock, keeping the time left.
+		const double left = timeout - *clock;
+		process_always = p_process_always;
+		tree->_schedule_timer(this, left);
+	} else {
+		process_always = p_process_always;
+	}
+	_unlock_tree(locked_tree);
 }
 
 bool SceneTreeTimer::is_process_always() {
@@ -90,7 +125,15 @@ bool SceneTreeTimer::is_process_always() {
 }
 
 void SceneTreeTimer::set_process_in_physics(bool p_process_in_physics) {
-	process_in_physics = p_process_in_physics;
+	SceneTree *locked_tree = _lock_tree();
+	if (tree && process_in_physics != p_process_in_physics) {
+		const double left = timeout - *clock;
+		process_in_physics = p_process_in_physics;
+		tree->_schedule_timer(this, left);
+	} else {
+		process_in_physics = p_process_in_physics;
+	}
+	_unlock_tree(locked_tree);
 }
 
 bool SceneTreeTimer::is_process_in_physics() {
@@ -98,7 +141,15 @@ bool SceneTreeTimer::is_process_in_physics() {
 }
 
 void SceneTreeTimer::set_ignore_time_scale(bool p_ignore) {
-	ignore_time_scale = p_ignore;
+	SceneTree *locked_tree = _lock_tree();
+	if (tree && ignore_time_scale != p_ignore) {
+		const double left = timeout - *clock;
+		ignore_time_scale = p_ignore;
+		tree->_schedule_timer(this, left);
+	} else {
+		ignore_time_scale = p_ignore;
+	}
+	_unlock_tree(locked_tree);
 }
 
 bool SceneTreeTimer::is_ignoring_time_scale() {
@@ -138,9 +189,26 @@ void SceneTree::ClientPhysicsInterpolation::physics_process() {
 #endif // _3D_DISABLED
 
 void SceneTree::tree_changed() {
+	if (tree_changed_batch > 0) {
+		tree_changed_pending = true;
+		return;
+	}
 	emit_signal(tree_changed_name);
 }
 
+void SceneTree::_begin_tree_changed_batch() {
+	tree_changed_batch++;
+}
+
+void SceneTree::_end_tree_changed_batch() {
+	ERR_FAIL_COND(tree_changed_batch <= 0);
+	tree_changed_batch--;
+	if (tree_changed_batch == 0 && tree_changed_pending) {
+		tree_changed_pending = false;
+		emit_signal(tree_changed_name);
+	}
+}
+
 void SceneTree::node_added(Node *p_node) {
 	emit_signal(node_added_name, p_node);
 }
@@ -166,11 +234,22 @@ SceneTree::Group *SceneTree::add_to_group(const StringName &p_group, Node *p_nod
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	if (!E) {
 		E = group_map.insert(p_group, Group());
+		HashMap<StringName, GroupSpatialIndex *>::Iterator I = group_spatial_indices.find(p_group);
+		if (I) {
+			E->value.spatial_index = I->value;
+		}
 	}
 
-	ERR_FAIL_COND_V_MSG(E->value.nodes.has(p_node), &E->value, "Already in group: " + p_group + ".");
+	// Node::add_to_group() already rejects duplicates, the linear check would make adding many children quadratic.
+	if (group_insert_batch == 0) {
+		ERR_FAIL_COND_V_MSG(E->value.nodes.has(p_node), &E->value, "Already in group: " + p_group + ".");
+	}
 	E->value.nodes.push_back(p_node);
 	E->value.changed = true;
+	if (E->value.spatial_index) {
+		p_node->data.spatially_indexed_groups++;
+		E->value.spatial_index->add_member(p_node);
+	}
 	return &E->value;
 }
 
@@ -181,6 +260,10 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 	ERR_FAIL_COND(!E);
 
 	E->value.nodes.erase(p_node);
+	if (E->value.spatial_index) {
+		p_node->data.spatially_indexed_groups--;
+		E->value.spatial_index->remove_member(p_node);
+	}
 	if (E->value.nodes.is_empty()) {
 		group_map.remove(E);
 	}
@@ -188,6 +271,12 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 
 void SceneTree::flush_transform_notifications() {
 	_THREAD_SAFE_METHOD_
+	FRAME_TRACE_SCOPE("SceneTree::flush_transform_notifications");
+
+	xform_change_pass++;
+	if (unlikely(xform_change_pass == 0)) {
+		xform_change_pass = 1;
+	}
 
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
@@ -298,6 +387,7 @@ void SceneTree::_flush_accessibility_changes() {
 }
 
 void SceneTree::_flush_ugc() {
+	FRAME_TRACE_SCOPE("SceneTree::flush_unique_group_calls");
 	ugc_locked = true;
 
 	while (unique_group_calls.size()) {
@@ -613,6 +703,8 @@ void SceneTree::iteration_prepare() {
 }
 
 bool SceneTree::physics_process(double p_time) {
+	FRAME_TRACE_SCOPE("SceneTree::physics_process");
+
 	current_frame++;
 
 	flush_transform_notifications();
@@ -662,6 +754,8 @@ void SceneTree::iteration_end() {
 }
 
 bool SceneTree::process(double p_time) {
+	FRAME_TRACE_SCOPE("SceneTree::process");
+
 	// First pass of scene tree fixed timestep interpolation.
 	if (get_scene_tree_fti().is_enabled()) {
 		// Special, we need to ensure RenderingServer is up to date
@@ -766,40 +860,113 @@ bool SceneTree::process(double p_time) {
 	return _quit;
 }
 
+uint32_t SceneTree::_get_timer_clock(const SceneTreeTimer *p_timer) {
+	return (p_timer->process_in_physics ? TIMER_CLOCK_PHYSICS : 0) | (p_timer->ignore_time_scale ? TIMER_CLOCK_IGNORE_TIME_SCALE : 0) | (p_timer->process_always ? TIMER_CLOCK_PROCESS_ALWAYS : 0);
+}
+
+void SceneTree::_schedule_timer(SceneTreeTimer *p_timer, double p_time_left) {
+	if (p_timer->tree == this) {
+		timer_stale_count++;
+	} else {
+		ERR_FAIL_COND(p_timer->tree);
+		p_timer->tree = this;
+		timer_count++;
+	}
+
+	const uint32_t clock = _get_timer_clock(p_timer);
+	p_timer->clock = &timer_clocks[clock];
+	p_timer->timeout = timer_clocks[clock] + p_time_left;
+	p_timer->version++;
+
+	TimerEntry entry;
+	entry.timer = Ref<SceneTreeTimer>(p_timer);
+	entry.timeout = p_timer->timeout;
+	entry.order = p_timer->order;
+	entry.version = p_timer->version;
+
+	LocalVector<TimerEntry> &heap = timer_heaps[clock];
+	heap.push_back(entry);
+	SortArray<TimerEntry, TimerEntrySort> sorter;
+	sorter.push_heap(0, heap.size() - 1, 0, entry, heap.ptr());
+
+	if (timer_stale_count > timer_count + 64) {
+		_compact_timer_heaps();
+	}
+}
+
+void SceneTree::_compact_timer_heaps() {
+	SortArray<TimerEntry, TimerEntrySort> sorter;
+	for (LocalVector<TimerEntry> &heap : timer_heaps) {
+		uint32_t live = 0;
+		for (uint32_t i = 0; i < heap.size(); i++) {
+			if (heap[i].timer->tree == this && heap[i].timer->version == heap[i].version) {
+				heap[live++] = heap[i];
+			}
+		}
+		heap.resize(live);
+		sorter.make_heap(0, heap.size(), heap.ptr());
+	}
+	timer_stale_count = 0;
+}
+
 void SceneTree::process_timers(double p_delta, bool p_physics_frame) {
 	_THREAD_SAFE_METHOD_
-	const List<Ref<SceneTreeTimer>>::Element *L = timers.back(); // Last element.
+	FRAME_TRACE_SCOPE("SceneTree::process_timers");
 	const double unscaled_delta = Engine::get_singleton()->get_process_step();
 
-	for (List<Ref<SceneTreeTimer>>::Element *E = timers.front(); E;) {
-		List<Ref<SceneTreeTimer>>::Element *N = E->next();
-		Ref<SceneTreeTimer> timer = E->get();
+	SortArray<TimerEntry, TimerEntrySort> sorter;
+	for (uint32_t clock = 0; clock < TIMER_CLOCK_MAX; clock++) {
+		if (bool(clock & TIMER_CLOCK_PHYSICS) != p_physics_frame || (paused && !(clock & TIMER_CLOCK_PROCESS_ALWAYS))) {
+			continue;
+		}
 
-		if ((paused && !timer->is_process_always()) || (timer->is_process_in_physics() != p_physics_frame)) {
-			if (E == L) {
-				break; // Break on last, so if new timers were added during list traversal, ignore them.
+		timer_clocks[clock] += (clock & TIMER_CLOCK_IGNORE_TIME_SCALE) ? unscaled_delta : p_delta;
+
+		LocalVector<TimerEntry> &heap = timer_heaps[clock];
+		while (!heap.is_empty() && heap[0].timeout <= timer_clocks[clock]) {
+			sorter.pop_heap(0, heap.size(), heap.ptr());
+			TimerEntry &entry = heap[heap.size() - 1];
+			if (entry.timer->tree == this && entry.timer->version == entry.version) {
+				expired_timers.push_back(entry);
+			} else {
+				timer_stale_count--;
 			}
-			E = N;
-			continue;
+			heap.resize(heap.size() - 1);
 		}
+	}
 
-		double time_left = timer->get_time_left();
-		time_left -= timer->is_ignoring_time_scale() ? unscaled_delta : p_delta;
-		timer->set_time_left(time_left);
+	if (expired_timers.is_empty()) {
+		return;
+	}
 
-		if (time_left <= 0) {
-			E->get()->emit_signal(SNAME("timeout"));
-			timers.erase(E);
+	// Time out in creation order, like timers expiring on the same frame always did.
+	struct OrderSort {
+		_FORCE_INLINE_ bool operator()(const TimerEntry &p_left, const TimerEntry &p_right) const {
+			return p_left.order < p_right.order;
 		}
-		if (E == L) {
-			break; // Break on last, so if new timers were added during list traversal, ignore them.
+	};
+	expired_timers.sort_custom<OrderSort>();
+
+	for (const TimerEntry &entry : expired_timers) {
+		SceneTreeTimer *timer = entry.timer.ptr();
+		if (timer->tree != this || timer->version != entry.version) {
+			continue; // Rescheduled by an earlier timeout this frame.
 		}
-		E = N;
+
+		timer->time_left = timer->timeout - *timer->clock;
+		timer->tree = nullptr;
+		timer->clock = nullptr;
+		timer->version++;
+		timer_count--;
+
+		timer->emit_signal(SNAME("timeout"));
 	}
+	expired_timers.clear();
 }
 
 void SceneTree::process_tweens(double p_delta, bool p_physics) {
 	_THREAD_SAFE_METHOD_
+	FRAME_TRACE_SCOPE("SceneTree::process_tweens");
 	// This methods works similarly to how SceneTreeTimers are handled.
 	const List<Ref<Tween>>::Element *L = tweens.back();
 	const double unscaled_delta = Engine::get_singleton()->get_process_step();
@@ -847,10 +1014,20 @@ void SceneTree::finalize() {
 	MainLoop::finalize();
 
 	// Cleanup timers.
-	for (Ref<SceneTreeTimer> &timer : timers) {
-		timer->release_connections();
+	for (LocalVector<TimerEntry> &heap : timer_heaps) {
+		for (TimerEntry &entry : heap) {
+			SceneTreeTimer *timer = entry.timer.ptr();
+			if (timer->tree == this && timer->version == entry.version) {
+				timer->time_left = timer->timeout - *timer->clock;
+				timer->tree = nullptr;
+				timer->clock = nullptr;
+				timer->release_connections();
+			}
+		}
+		heap.clear();
 	}
-	timers.clear();
+	timer_count = 0;
+	timer_stale_count = 0;
 
 	// Cleanup tweens.
 	for (Ref<Tween> &tween : tweens) {
@@ -1131,6 +1308,8 @@ bool SceneTree::is_suspended() const {
 }
 
 void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
+	FRAME_TRACE_SCOPE(p_physics ? "SceneTree::physics_process_group" : "SceneTree::process_group");
+
 	// When reading this function, keep in mind that this code must work in a way where
 	// if any node is removed, this needs to continue working.
 
@@ -1153,6 +1332,8 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 		}
 	}
 
+	const uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+
 	// Make a copy, so if nodes are added/removed from process, this does not break
 	Vector<Node *> nodes_copy = nodes;
 
@@ -1189,6 +1370,11 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	}
 
 	p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
+
+	// Only the thread processing this group writes its cost, the main thread reads it once all tasks are done.
+	const uint64_t elapsed_usec = OS::get_singleton()->get_ticks_usec() - begin_usec;
+	uint64_t &cost_usec = p_physics ? p_group->physics_process_usec : p_group->process_usec;
+	cost_usec = cost_usec == 0 ? elapsed_usec : (cost_usec * 7 + elapsed_usec) / 8;
 }
 
 void SceneTree::_process_groups_thread(uint32_t p_index, bool p_physics) {
@@ -1197,7 +1383,34 @@ void SceneTree::_process_groups_thread(uint32_t p_index, bool p_physics) {
 	Node::current_process_thread_group = nullptr;
 }
 
+int SceneTree::_schedule_process_groups(bool p_physics) {
+	// Start with the most expensive groups, so threads picking up work in order finish at about the same time.
+	SortArray<ProcessGroup *, ProcessGroupCostSort> sorter;
+	sorter.compare.physics = p_physics;
+	sorter.sort(local_process_group_cache.ptr(), local_process_group_cache.size());
+
+	const uint64_t max_tasks = MAX(MIN(local_process_group_cache.size(), (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count()), 1u);
+	uint64_t tasks = max_tasks;
+	if (process_group_min_task_usec > 0) {
+		// Cheap groups are batched into fewer tasks, so the threading overhead doesn't outweigh the work.
+		uint64_t total_usec = 0;
+		for (const ProcessGroup *pg : local_process_group_cache) {
+			total_usec += p_physics ? pg->physics_process_usec : pg->process_usec;
+		}
+		tasks = CLAMP(total_usec / process_group_min_task_usec, (uint64_t)1, max_tasks);
+	}
+
+	// Even a single cheap batch goes to a worker thread, sub-thread groups must never run on the main thread.
+	for (ProcessGroup *pg : local_process_group_cache) {
+		(p_physics ? pg->physics_process_tasks : pg->process_tasks) = tasks;
+	}
+
+	return (int)tasks;
+}
+
 void SceneTree::_process(bool p_physics) {
+	FRAME_TRACE_SCOPE(p_physics ? "SceneTree::physics_process_nodes" : "SceneTree::process_nodes");
+
 	if (process_groups_dirty) {
 		{
 			// First, remove dirty groups.
@@ -1265,8 +1478,9 @@ void SceneTree::_process(bool p_physics) {
 					}
 				}
 
-				if (using_threads) {
-					WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_cache.size(), -1, true);
+				if (using_threads && !local_process_group_cache.is_empty()) {
+					int tasks = _schedule_process_groups(p_physics);
+					WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_cache.size(), tasks, true);
 					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
 				}
 			}
@@ -1328,6 +1542,32 @@ bool SceneTree::ProcessGroupSort::operator()(const ProcessGroup *p_left, const P
 	}
 }
 
+bool SceneTree::ProcessGroupCostSort::operator()(const ProcessGroup *p_left, const ProcessGroup *p_right) const {
+	if (physics) {
+		return p_left->physics_process_usec > p_right->physics_process_usec;
+	}
+	return p_left->process_usec > p_right->process_usec;
+}
+
+TypedArray<Dictionary> SceneTree::get_process_group_schedule() const {
+	TypedArray<Dictionary> ret;
+	for (const ProcessGroup *pg : process_groups) {
+		if (pg->removed) {
+			continue;
+		}
+		Dictionary group;
+		group["owner"] = pg->owner ? pg->owner->get_path() : NodePath();
+		group["threaded"] = pg->owner && pg->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD && !node_threading_disabled;
+		group["order"] = pg->owner ? pg->owner->data.process_thread_group_order : 0;
+		group["process_usec"] = pg->process_usec;
+		group["physics_process_usec"] = pg->physics_process_usec;
+		group["process_tasks"] = pg->process_tasks;
+		group["physics_process_tasks"] = pg->physics_process_tasks;
+		ret.push_back(group);
+	}
+	return ret;
+}
+
 void SceneTree::_remove_process_group(Node *p_node) {
 	_THREAD_SAFE_METHOD_
 	ProcessGroup *pg = (ProcessGroup *)p_node->data.process_group;
@@ -1581,8 +1821,313 @@ void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_li
 	}
 }
 
+bool SceneTree::_get_group_member_position(Node *p_node, Vector3 &r_position, bool &r_is_2d) {
+	Node2D *node_2d = Object::cast_to<Node2D>(p_node);
+	if (node_2d) {
+		const Vector2 position = node_2d->get_global_position();
+		r_position = Vector3(position.x, position.y, 0);
+		r_is_2d = true;
+		return true;
+	}
+#ifndef _3D_DISABLED
+	Node3D *node_3d = Object::cast_to<Node3D>(p_node);
+	if (node_3d) {
+		r_position = node_3d->get_global_position();
+		r_is_2d = false;
+		return true;
+	}
+#endif // _3D_DISABLED
+	return false;
+}
+
+Vector3i SceneTree::GroupSpatialIndex::get_cell(const Vector3 &p_position) const {
+	// Clamp, so huge or non-finite positions can't overflow the cell coordinates.
+	const double limit = 1 << 30;
+	Vector3i cell;
+	for (int i = 0; i < 3; i++) {
+		const double coord = Math::floor(double(p_position[i]) / cell_size);
+		cell[i] = Math::is_nan(coord) ? 0 : int32_t(CLAMP(coord, -limit, limit));
+	}
+	return cell;
+}
+
+void SceneTree::GroupSpatialIndex::_remove_from_cell(Member &p_member) {
+	if (!p_member.in_cell) {
+		return;
+	}
+	p_member.in_cell = false;
+
+	HashMap<Vector3i, LocalVector<Entry>>::Iterator C = cells.find(p_member.cell);
+	ERR_FAIL_COND(!C);
+	LocalVector<Entry> &entries = C->value;
+	const uint32_t last = entries.size() - 1;
+	if (p_member.slot != last) {
+		// Move the last entry into the freed slot.
+		entries[p_member.slot] = entries[last];
+		Member *moved_member = members.getptr(entries[p_member.slot].node);
+		ERR_FAIL_NULL(moved_member);
+		moved_member->slot = p_member.slot;
+	}
+	entries.resize(last);
+	if (entries.is_empty()) {
+		cells.remove(C);
+	}
+}
+
+void SceneTree::GroupSpatialIndex::update_member(Node *p_node) {
+	Member *member = members.getptr(p_node);
+	ERR_FAIL_NULL(member);
+
+	Entry entry;
+	entry.node = p_node;
+	if (!_get_group_member_position(p_node, entry.position, entry.is_2d)) {
+		_remove_from_cell(*member);
+		return;
+	}
+
+	const Vector3i cell = get_cell(entry.position);
+	if (member->in_cell && member->cell == cell) {
+		cells[cell][member->slot] = entry;
+		return;
+	}
+
+	_remove_from_cell(*member);
+	LocalVector<Entry> &entries = cells[cell];
+	member->cell = cell;
+	member->slot = entries.size();
+	member->in_cell = true;
+	entries.push_back(entry);
+}
+
+void SceneTree::GroupSpatialIndex::add_member(Node *p_node) {
+	members.insert(p_node, Member());
+	// The global transform isn't valid until the node has entered the tree, place it on the next query.
+	queue_member(p_node);
+}
+
+void SceneTree::GroupSpatialIndex::remove_member(Node *p_node) {
+	HashMap<Node *, Member>::Iterator M = members.find(p_node);
+	if (!M) {
+		return;
+	}
+	_remove_from_cell(M->value);
+	members.remove(M);
+}
+
+void SceneTree::GroupSpatialIndex::queue_member(Node *p_node) {
+	MutexLock lock(moved_mutex);
+	if (refresh_all) {
+		return;
+	}
+	if (moved.size() >= MAX_QUEUED_MOVES) {
+		// Updating every member is cheaper than growing the queue further.
+		refresh_all = true;
+		moved.clear();
+		return;
+	}
+	moved.push_back(p_node);
+}
+
+void SceneTree::GroupSpatialIndex::reset(const Vector<Node *> &p_nodes) {
+	members.clear();
+	cells.clear();
+	for (Node *node : p_nodes) {
+		members.insert(node, Member());
+	}
+
+	MutexLock lock(moved_mutex);
+	moved.clear();
+	refresh_all = true;
+}
+
+void SceneTree::_update_group_spatial_index(GroupSpatialIndex *p_index) {
+	LocalVector<Node *> moved;
+	bool refresh_all = false;
+	{
+		MutexLock lock(p_index->moved_mutex);
+		moved = std::move(p_index->moved);
+		p_index->moved.clear();
+		refresh_all = p_index->refresh_all;
+		p_index->refresh_all = false;
+	}
+
+	if (refresh_all) {
+		moved.clear();
+		moved.reserve(p_index->members.size());
+		for (const KeyValue<Node *, GroupSpatialIndex::Member> &E : p_index->members) {
+			moved.push_back(E.key);
+		}
+	}
+
+	// Nodes may be queued several times, or have left the group since, update each member once.
+	p_index->pass++;
+	for (Node *node : moved) {
+		GroupSpatialIndex::Member *member = p_index->members.getptr(node);
+		if (!member || member->pass == p_index->pass) {
+			continue;
+		}
+		member->pass = p_index->pass;
+		p_index->update_member(node);
+	}
+}
+
+void SceneTree::_mark_group_spatial_indices_dirty(Node *p_node) {
+	for (const KeyValue<StringName, Node::GroupData> &E : p_node->data.grouped) {
+		if (E.value.group && E.value.group->spatial_index) {
+			E.value.group->spatial_index->queue_member(p_node);
+		}
+	}
+}
+
+TypedArray<Node> SceneTree::_get_nodes_in_group_in_area(const StringName &p_group, const AABB &p_aabb, bool p_2d, real_t p_radius) {
+	TypedArray<Node> ret;
+	const Vector3 begin = p_aabb.position;
+	const Vector3 end = p_aabb.get_end();
+	const Vector3 center = p_aabb.get_center();
+	const real_t radius_squared = p_radius * p_radius;
+
+	auto matches = [&](const Vector3 &p_position, bool p_is_2d) {
+		if (p_is_2d != p_2d) {
+			return false;
+		}
+		if (p_position.x < begin.x || p_position.y < begin.y || p_position.z < begin.z || p_position.x > end.x || p_position.y > end.y || p_position.z > end.z) {
+			return false;
+		}
+		return p_radius < 0 || p_position.distance_squared_to(center) <= radius_squared;
+	};
+
+	HashMap<StringName, GroupSpatialIndex *>::Iterator I = group_spatial_indices.find(p_group);
+	if (!I) {
+		// Not indexed, test every member.
+		HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
+		if (!E) {
+			return ret;
+		}
+		_update_group_order(E->value);
+		for (Node *node : E->value.nodes) {
+			Vector3 position;
+			bool is_2d = false;
+			if (_get_group_member_position(node, position, is_2d) && matches(position, is_2d)) {
+				ret.push_back(node);
+			}
+		}
+		return ret;
+	}
+
+	GroupSpatialIndex *index = I->value;
+	_update_group_spatial_index(index);
+
+	const Vector3i from = index->get_cell(begin);
+	const Vector3i to = index->get_cell(end);
+	const double cells_in_area = double(to.x - from.x + 1) * double(to.y - from.y + 1) * double(to.z - from.z + 1);
+
+	if (cells_in_area >= index->cells.size()) {
+		// The area covers more cells than are populated, scanning all entries is cheaper.
+		for (const KeyValue<Vector3i, LocalVector<GroupSpatialIndex::Entry>> &C : index->cells) {
+			for (const GroupSpatialIndex::Entry &entry : C.value) {
+				if (matches(entry.position, entry.is_2d)) {
+					ret.push_back(entry.node);
+				}
+			}
+		}
+		return ret;
+	}
+
+	for (int x = from.x; x <= to.x; x++) {
+		for (int y = from.y; y <= to.y; y++) {
+			for (int z = from.z; z <= to.z; z++) {
+				HashMap<Vector3i, LocalVector<GroupSpatialIndex::Entry>>::ConstIterator C = index->cells.find(Vector3i(x, y, z));
+				if (!C) {
+					continue;
+				}
+				for (const GroupSpatialIndex::Entry &entry : C->value) {
+					if (matches(entry.position, entry.is_2d)) {
+						ret.push_back(entry.node);
+					}
+				}
+			}
+		}
+	}
+
+	return ret;
+}
+
+void SceneTree::enable_group_spatial_index(const StringName &p_group, real_t p_cell_size) {
+	_THREAD_SAFE_METHOD_
+	ERR_FAIL_COND_MSG(p_cell_size <= 0, "The spatial index cell size must be greater than 0.");
+
+	GroupSpatialIndex *index = nullptr;
+	HashMap<StringName, GroupSpatialIndex *>::Iterator I = group_spatial_indices.find(p_group);
+	if (I) {
+		index = I->value;
+	} else {
+		index = memnew(GroupSpatialIndex);
+		group_spatial_indices.insert(p_group, index);
+
+		HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
+		if (E) {
+			E->value.spatial_index = index;
+			for (Node *node : E->value.nodes) {
+				node->data.spatially_indexed_groups++;
+			}
+		}
+	}
+
+	index->cell_size = p_cell_size;
+	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
+	index->reset(E ? E->value.nodes : Vector<Node *>());
+}
+
+void SceneTree::disable_group_spatial_index(const StringName &p_group) {
+	_THREAD_SAFE_METHOD_
+	HashMap<StringName, GroupSpatialIndex *>::Iterator I = group_spatial_indices.find(p_group);
+	if (!I) {
+		return;
+	}
+
+	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
+	if (E) {
+		E->value.spatial_index = nullptr;
+		for (Node *node : E->value.nodes) {
+			node->data.spatially_indexed_groups--;
+		}
+	}
+
+	memdelete(I->value);
+	group_spatial_indices.remove(I);
+}
+
+bool SceneTree::has_group_spatial_index(const StringName &p_group) const {
+	_THREAD_SAFE_METHOD_
+	return group_spatial_indices.has(p_group);
+}
+
+TypedArray<Node> SceneTree::get_nodes_in_group_in_radius(const StringName &p_group, const Vector3 &p_center, real_t p_radius) {
+	_THREAD_SAFE_METHOD_
+	ERR_FAIL_COND_V_MSG(p_radius < 0, TypedArray<Node>(), "The radius must not be negative.");
+	return _get_nodes_in_group_in_area(p_group, AABB(p_center - Vector3(p_radius, p_radius, p_radius), Vector3(p_radius, p_radius, p_radius) * 2), false, p_radius);
+}
+
+TypedArray<Node> SceneTree::get_nodes_in_group_in_aabb(const StringName &p_group, const AABB &p_aabb) {
+	_THREAD_SAFE_METHOD_
+	return _get_nodes_in_group_in_area(p_group, p_aabb.abs(), false);
+}
+
+TypedArray<Node> SceneTree::get_nodes_in_group_in_radius_2d(const StringName &p_group, const Vector2 &p_center, real_t p_radius) {
+	_THREAD_SAFE_METHOD_
+	ERR_FAIL_COND_V_MSG(p_radius < 0, TypedArray<Node>(), "The radius must not be negative.");
+	return _get_nodes_in_group_in_area(p_group, AABB(Vector3(p_center.x - p_radius, p_center.y - p_radius, 0), Vector3(p_radius * 2, p_radius * 2, 0)), true, p_radius);
+}
+
+TypedArray<Node> SceneTree::get_nodes_in_group_in_rect(const StringName &p_group, const Rect2 &p_rect) {
+	_THREAD_SAFE_METHOD_
+	const Rect2 rect = p_rect.abs();
+	return _get_nodes_in_group_in_area(p_group, AABB(Vector3(rect.position.x, rect.position.y, 0), Vector3(rect.size.x, rect.size.y, 0)), true);
+}
+
 void SceneTree::_flush_delete_queue() {
 	_THREAD_SAFE_METHOD_
+	FRAME_TRACE_SCOPE("SceneTree::flush_delete_queue");
 
 	while (delete_queue.size()) {
 		Object *obj = ObjectDB::get_instance(delete_queue.front()->get());
@@ -1724,7 +2269,8 @@ Ref<SceneTreeTimer> SceneTree::create_timer(double p_delay_sec, bool p_process_a
 	stt->set_time_left(p_delay_sec);
 	stt->set_process_in_physics(p_process_in_physics);
 	stt->set_ignore_time_scale(p_ignore_time_scale);
-	timers.push_back(stt);
+	stt->order = timer_order++;
+	_schedule_timer(stt.ptr(), p_delay_sec);
 	return stt;
 }
 
@@ -1866,6 +2412,7 @@ void SceneTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("create_timer", "time_sec", "process_always", "process_in_physics", "ignore_time_scale"), &SceneTree::create_timer, DEFVAL(true), DEFVAL(false), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("create_tween"), &SceneTree::create_tween);
 	ClassDB::bind_method(D_METHOD("get_processed_tweens"), &SceneTree::get_processed_tweens);
+	ClassDB::bind_method(D_METHOD("get_process_group_schedule"), &SceneTree::get_process_group_schedule);
 
 	ClassDB::bind_method(D_METHOD("get_node_count"), &SceneTree::get_node_count);
 	ClassDB::bind_method(D_METHOD("get_frame"), &SceneTree::get_frame);
@@ -1901,6 +2448,14 @@ void SceneTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_first_node_in_group", "group"), &SceneTree::get_first_node_in_group);
 	ClassDB::bind_method(D_METHOD("get_node_count_in_group", "group"), &SceneTree::get_node_count_in_group);
 
+	ClassDB::bind_method(D_METHOD("enable_group_spatial_index", "group", "cell_size"), &SceneTree::enable_group_spatial_index, DEFVAL(64.0));
+	ClassDB::bind_method(D_METHOD("disable_group_spatial_index", "group"), &SceneTree::disable_group_spatial_index);
+	ClassDB::bind_method(D_METHOD("has_group_spatial_index", "group"), &SceneTree::has_group_spatial_index);
+	ClassDB::bind_method(D_METHOD("get_nodes_in_group_in_radius", "group", "center", "radius"), &SceneTree::get_nodes_in_group_in_radius);
+	ClassDB::bind_method(D_METHOD("get_nodes_in_group_in_aabb", "group", "aabb"), &SceneTree::get_nodes_in_group_in_aabb);
+	ClassDB::bind_method(D_METHOD("get_nodes_in_group_in_radius_2d", "group", "center", "radius"), &SceneTree::get_nodes_in_group_in_radius_2d);
+	ClassDB::bind_method(D_METHOD("get_nodes_in_group_in_rect", "group", "rect"), &SceneTree::get_nodes_in_group_in_rect);
+
 	ClassDB::bind_method(D_METHOD("set_current_scene", "child_node"), &SceneTree::set_current_scene);
 	ClassDB::bind_method(D_METHOD("get_current_scene"), &SceneTree::get_current_scene);
 
@@ -1950,6 +2505,7 @@ SceneTree::IdleCallback SceneTree::idle_callbacks[SceneTree::MAX_IDLE_CALLBACKS]
 int SceneTree::idle_callback_count = 0;
 
 void SceneTree::_call_idle_callbacks() {
+	FRAME_TRACE_SCOPE("SceneTree::call_idle_callbacks");
 	for (int i = 0; i < idle_callback_count; i++) {
 		idle_callbacks[i]();
 	}
@@ -2006,6 +2562,7 @@ SceneTree::SceneTree() {
 	debug_paths_color = GLOBAL_DEF("debug/shapes/paths/geometry_color", Color(0.1, 1.0, 0.7, 0.4));
 	debug_paths_width = GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "debug/shapes/paths/geometry_width", PROPERTY_HINT_RANGE, "0.01,10,0.001,or_greater"), 2.0);
 	collision_debug_contacts = GLOBAL_DEF(PropertyInfo(Variant::INT, "debug/shapes/collision/max_contacts_displayed", PROPERTY_HINT_RANGE, "0,20000,1"), 10000);
+	process_group_min_task_usec = GLOBAL_DEF(PropertyInfo(Variant::INT, "application/run/process_thread_group_min_task_usec", PROPERTY_HINT_RANGE, "0,10000,1,or_greater,suffix:µs"), 50);
 	accessibility_upd_per_sec = GLOBAL_GET(SNAME("accessibility/general/updates_per_second"));
 
 	GLOBAL_DEF("debug/shapes/collision/draw_2d_outlines", true);
@@ -2197,6 +2754,10 @@ SceneTree::~SceneTree() {
 
 	memdelete(process_group_call_queue_allocator);
 
+	for (KeyValue<StringName, GroupSpatialIndex *> &E : group_spatial_indices) {
+		memdelete(E.value);
+	}
+
 	if (singleton == this) {
 		singleton = nullptr;
 	}
@@ -49,17 +49,30 @@ class Material;
 class Mesh;
 class MultiplayerAPI;
 class SceneDebugger;
+class SceneTree;
 class Tween;
 class Viewport;
 
 class SceneTreeTimer : public RefCounted {
 	GDCLASS(SceneTreeTimer, RefCounted);
 
+	friend class SceneTree;
+
 	double time_left = 0.0;
 	bool process_always = true;
 	bool process_in_physics = false;
 	bool ignore_time_scale = false;
 
+	// Set while the timer is scheduled in a tree, the time left is then counted from the tree's clock.
+	SceneTree *tree = nullptr;
+	const double *clock = nullptr;
+	double timeout = 0.0;
+	uint64_t order = 0;
+	uint32_t version = 0;
+
+	static SceneTree *_lock_tree();
+	static void _unlock_tree(SceneTree *p_tree);
+
 protected:
 	static void _bind_methods();
 
@@ -99,12 +112,23 @@ private:
 		bool removed = false;
 		Node *owner = nullptr;
 		uint64_t last_pass = 0;
+		// Smoothed cost of the last frames, used to schedule threaded groups.
+		uint64_t process_usec = 0;
+		uint64_t physics_process_usec = 0;
+		// Worker thread tasks the group's batch was split into last frame, 0 until it runs on a worker thread.
+		uint32_t process_tasks = 0;
+		uint32_t physics_process_tasks = 0;
 	};
 
 	struct ProcessGroupSort {
 		_FORCE_INLINE_ bool operator()(const ProcessGroup *p_left, const ProcessGroup *p_right) const;
 	};
 
+	struct ProcessGroupCostSort {
+		bool physics = false;
+		_FORCE_INLINE_ bool operator()(const ProcessGroup *p_left, const ProcessGroup *p_right) const;
+	};
+
 	PagedAllocator<ProcessGroup, true> group_allocator; // Allocate groups on pages, to enhance cache usage.
 
 	LocalVector<ProcessGroup *> process_groups;
@@ -115,9 +139,47 @@ private:
 	ProcessGroup default_process_group;
 
 	bool node_threading_disabled = false;
+	uint64_t process_group_min_task_usec = 50;
+
+	// Optional grid over the global positions of a group's Node2D and Node3D members.
+	// Members that moved are queued and only their own entries are updated on the next query.
+	struct GroupSpatialIndex {
+		struct Entry {
+			Vector3 position;
+			Node *node = nullptr;
+			bool is_2d = false;
+		};
+		struct Member {
+			Vector3i cell;
+			uint32_t slot = 0;
+			uint64_t pass = 0;
+			bool in_cell = false;
+		};
+
+		real_t cell_size = 64.0;
+		uint64_t pass = 0;
+		HashMap<Node *, Member> members;
+		HashMap<Vector3i, LocalVector<Entry>> cells;
+
+		// Transform notifications may come from other threads.
+		static constexpr uint32_t MAX_QUEUED_MOVES = 4096;
+		Mutex moved_mutex;
+		LocalVector<Node *> moved;
+		bool refresh_all = false;
+
+		void _remove_from_cell(Member &p_member);
+
+		Vector3i get_cell(const Vector3 &p_position) const;
+		void update_member(Node *p_node);
+		void add_member(Node *p_node);
+		void remove_member(Node *p_node);
+		void queue_member(Node *p_node);
+		void reset(const Vector<Node *> &p_nodes);
+	};
 
 	struct Group {
 		Vector<Node *> nodes;
+		GroupSpatialIndex *spatial_index = nullptr;
 		bool changed = false;
 	};
 
@@ -144,6 +206,7 @@ private:
 	bool suspended = false;
 
 	HashMap<StringName, Group> group_map;
+	HashMap<StringName, GroupSpatialIndex *> group_spatial_indices; // Kept while the group is empty.
 	bool _quit = false;
 
 	bool _physics_interpolation_enabled = false;
@@ -191,6 +254,11 @@ private:
 
 	TypedArray<Node> _get_nodes_in_group(const StringName &p_group);
 
+	static bool _get_group_member_position(Node *p_node, Vector3 &r_position, bool &r_is_2d);
+	void _update_group_spatial_index(GroupSpatialIndex *p_index);
+	void _mark_group_spatial_indices_dirty(Node *p_node);
+	TypedArray<Node> _get_nodes_in_group_in_area(const StringName &p_group, const AABB &p_aabb, bool p_2d, real_t p_radius = -1.0);
+
 	Node *current_scene = nullptr;
 	ObjectID prev_scene_id;
 	ObjectID pending_new_scene_id;
@@ -206,7 +274,35 @@ private:
 
 	void _flush_scene_change();
 
-	List<Ref<SceneTreeTimer>> timers;
+	enum TimerClock {
+		TIMER_CLOCK_PHYSICS = 1,
+		TIMER_CLOCK_IGNORE_TIME_SCALE = 2,
+		TIMER_CLOCK_PROCESS_ALWAYS = 4,
+		TIMER_CLOCK_MAX = 8,
+	};
+
+	struct TimerEntry {
+		Ref<SceneTreeTimer> timer;
+		double timeout = 0.0;
+		uint64_t order = 0;
+		uint32_t version = 0;
+	};
+
+	struct TimerEntrySort {
+		_FORCE_INLINE_ bool operator()(const TimerEntry &p_left, const TimerEntry &p_right) const {
+			return p_left.timeout > p_right.timeout || (p_left.timeout == p_right.timeout && p_left.order > p_right.order);
+		}
+	};
+
+	// Scheduled timers as one min-heap per clock, so only the timers that are due are visited each frame.
+	// Rescheduling a timer leaves its previous entry behind, entries not matching the timer's version are skipped.
+	LocalVector<TimerEntry> timer_heaps[TIMER_CLOCK_MAX];
+	double timer_clocks[TIMER_CLOCK_MAX] = {};
+	LocalVector<TimerEntry> expired_timers;
+	uint32_t timer_count = 0;
+	uint32_t timer_stale_count = 0;
+	uint64_t timer_order = 0;
+
 	List<Ref<Tween>> tweens;
 
 	///network///
@@ -218,10 +314,21 @@ private:
 	static SceneTree *singleton;
 	friend class Node;
 
+	// While greater than zero, tree_changed() only records that the signal is due.
+	int tree_changed_batch = 0;
+	int group_insert_batch = 0; // Set while Node::add_children_bulk() adds children.
+	bool tree_changed_pending = false;
+
 	void tree_changed();
+	void _begin_tree_changed_batch();
+	void _end_tree_changed_batch();
 	void node_added(Node *p_node);
 	void node_removed(Node *p_node);
 	void node_renamed(Node *p_node);
+	friend class SceneTreeTimer;
+	static uint32_t _get_timer_clock(const SceneTreeTimer *p_timer);
+	void _schedule_timer(SceneTreeTimer *p_timer, double p_time_left);
+	void _compact_timer_heaps();
 	void process_timers(double p_delta, bool p_physics_frame);
 	void process_tweens(double p_delta, bool p_physics_frame);
 
@@ -230,6 +337,7 @@ private:
 
 	void _process_group(ProcessGroup *p_group, bool p_physics);
 	void _process_groups_thread(uint32_t p_index, bool p_physics);
+	int _schedule_process_groups(bool p_physics); // Returns the task count, 0 to process on the main thread.
 	void _process(bool p_physics);
 
 	void _remove_process_group(Node *p_node);
@@ -247,6 +355,8 @@ private:
 	friend class Viewport;
 
 	SelfList<Node>::List xform_change_list;
+	// Incremented whenever the transform notifications are flushed, never 0.
+	uint32_t xform_change_pass = 1;
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -406,6 +516,14 @@ public:
 	bool has_group(const StringName &p_identifier) const;
 	int get_node_count_in_group(const StringName &p_group) const;
 
+	void enable_group_spatial_index(const StringName &p_group, real_t p_cell_size = 64.0);
+	void disable_group_spatial_index(const StringName &p_group);
+	bool has_group_spatial_index(const StringName &p_group) const;
+	TypedArray<Node> get_nodes_in_group_in_radius(const StringName &p_group, const Vector3 &p_center, real_t p_radius);
+	TypedArray<Node> get_nodes_in_group_in_aabb(const StringName &p_group, const AABB &p_aabb);
+	TypedArray<Node> get_nodes_in_group_in_radius_2d(const StringName &p_group, const Vector2 &p_center, real_t p_radius);
+	TypedArray<Node> get_nodes_in_group_in_rect(const StringName &p_group, const Rect2 &p_rect);
+
 	//void change_scene(const String& p_path);
 	//Node *get_loaded_scene();
 
@@ -424,6 +542,8 @@ public:
 	void remove_tween(const Ref<Tween> &p_tween);
 	TypedArray<Tween> get_processed_tweens();
 
+	TypedArray<Dictionary> get_process_group_schedule() const;
+
 	//used by Main::start, don't use otherwise
 	void add_current_scene(Node *p_current);
 
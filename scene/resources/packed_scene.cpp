@@ -38,6 +38,7 @@
 #include "scene/gui/control.h"
 #include "scene/main/instance_placeholder.h"
 #include "scene/main/missing_node.h"
+#include "scene/main/scene_tree.h"
 #include "scene/property_utils.h"
 
 #ifndef _3D_DISABLED
@@ -124,6 +125,139 @@ Ref<Resource> SceneState::get_remap_resource(const Ref<Resource> &p_resource, Ha
 	return remap_resource;
 }
 
+int SceneState::_find_node_path_target(int p_from, const NodePath &p_path, const LocalVector<LocalVector<int>> &p_children) const {
+	if (p_path.is_empty() || p_path.is_absolute() || p_path.get_subname_count() > 0) {
+		return -1;
+	}
+
+	int current = p_from;
+	for (int i = 0; i < p_path.get_name_count(); i++) {
+		const StringName &name = p_path.get_name(i);
+		if (name == SNAME(".")) {
+			continue;
+		}
+		if (name == SNAME("..")) {
+			if (current == 0) {
+				return -1; // Outside of the scene.
+			}
+			current = nodes[current].parent;
+			continue;
+		}
+
+		int child = -1;
+		for (int c : p_children[current]) {
+			if (names[nodes[c].name] == name) {
+				child = c;
+				break;
+			}
+		}
+		if (child < 0) {
+			return -1; // Unique name, or added at runtime.
+		}
+		current = child;
+	}
+
+	return current;
+}
+
+void SceneState::_build_instantiation_plan() const {
+	InstantiationPlan &plan = instantiation_plan;
+	plan = InstantiationPlan();
+
+	const int nc = nodes.size();
+	plan.node_classes.resize(nc);
+	plan.property_offsets.resize(nc);
+
+	// NodePaths can only be resolved ahead of time when every node comes from this scene.
+	bool own_nodes_only = base_scene_idx < 0;
+	for (int i = 0; i < nc && own_nodes_only; i++) {
+		const NodeData &n = nodes[i];
+		own_nodes_only = n.instance < 0 && n.type != TYPE_INSTANTIATED && (i == 0 || (n.parent >= 0 && !(n.parent & FLAG_ID_IS_PATH) && n.parent < i));
+	}
+
+	LocalVector<LocalVector<int>> children;
+	if (own_nodes_only) {
+		children.resize(nc);
+		for (int i = 1; i < nc; i++) {
+			children[nodes[i].parent].push_back(i);
+		}
+	}
+
+	for (int i = 0; i < nc; i++) {
+		const NodeData &n = nodes[i];
+		plan.property_offsets[i] = plan.properties.size();
+
+		StringName class_name;
+		if (n.instance < 0 && n.type != TYPE_INSTANTIATED && !(i == 0 && base_scene_idx >= 0) && n.type >= 0 && n.type < names.size()) {
+			class_name = names[n.type];
+			// Extension classes may handle properties in their own setter.
+			ClassDB::APIType api = ClassDB::get_api_type(class_name);
+			if (!ClassDB::class_exists(class_name) || api == ClassDB::API_EXTENSION || api == ClassDB::API_EDITOR_EXTENSION) {
+				class_name = StringName();
+			}
+		}
+		plan.node_classes[i] = class_name;
+
+		for (const NodeData::Property &np : n.properties) {
+			InstantiationPlan::Property property;
+
+			if (np.name & FLAG_PATH_PROPERTY_IS_NODE) {
+				if (own_nodes_only && np.value >= 0 && np.value < variants.size() && variants[np.value].get_type() == Variant::NODE_PATH) {
+					property.node_path_target = _find_node_path_target(i, variants[np.value], children);
+				}
+			} else if (!class_name.is_empty() && np.name >= 0 && np.name < names.size()) {
+				const StringName &name = names[np.name];
+				StringName setter = ClassDB::get_property_setter(class_name, name);
+				if (!setter.is_empty()) {
+					property.setter = ClassDB::get_method(class_name, setter);
+					property.setter_index = ClassDB::get_property_index(class_name, name);
+				}
+			}
+
+			plan.properties.push_back(property);
+		}
+	}
+}
+
+const SceneState::InstantiationPlan &SceneState::_get_instantiation_plan() const {
+	if (!instantiation_plan_built.is_set()) {
+		MutexLock lock(instantiation_plan_mutex);
+		if (!instantiation_plan_built.is_set()) {
+			_build_instantiation_plan();
+			instantiation_plan_built.set();
+		}
+	}
+	return instantiation_plan;
+}
+
+void SceneState::_clear_instantiation_plan() {
+	MutexLock lock(instantiation_plan_mutex);
+	instantiation_plan_built.clear();
+	instantiation_plan = InstantiationPlan();
+}
+
+static void _set_node_property(Node *p_node, const MethodBind *p_setter, int p_setter_index, const StringName &p_name, const Variant &p_value, bool *r_valid) {
+	if (!p_setter || p_node->get_script_instance()) {
+		p_node->set(p_name, p_value, r_valid);
+		return;
+	}
+
+	// Same as what Object::set() ends up doing for built-in properties, without looking the property up.
+#ifdef TOOLS_ENABLED
+	p_node->set_edited(true);
+#endif
+	Callable::CallError ce;
+	if (p_setter_index >= 0) {
+		Variant index = p_setter_index;
+		const Variant *args[2] = { &index, &p_value };
+		p_setter->call(p_node, args, 2, ce);
+	} else {
+		const Variant *args[1] = { &p_value };
+		p_setter->call(p_node, args, 1, ce);
+	}
+	*r_valid = ce.error == Callable::CallError::CALL_OK;
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -161,6 +295,10 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	bool gen_node_path_cache = p_edit_state != GEN_EDIT_STATE_DISABLED && node_path_cache.is_empty();
 
+	const InstantiationPlan &plan = _get_instantiation_plan();
+	// Nodes can be renamed in the editor to avoid clashes, so resolve NodePaths at runtime there.
+	const bool use_node_path_targets = p_edit_state == GEN_EDIT_STATE_DISABLED;
+
 	HashMap<Ref<Resource>, Ref<Resource>> resources_local_to_scene;
 
 	LocalVector<DeferredNodePathProperties> deferred_node_paths;
@@ -304,6 +442,9 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			int nprop_count = n.properties.size();
 			if (nprop_count) {
 				const NodeData::Property *nprops = &n.properties[0];
+				const InstantiationPlan::Property *planned_props = &plan.properties[plan.property_offsets[i]];
+				// The planned setters only apply if the node was created as the expected class.
+				const bool use_planned_setters = !plan.node_classes[i].is_empty() && node->get_class_name() == plan.node_classes[i];
 
 				Dictionary missing_resource_properties;
 				HashMap<Ref<Resource>, Ref<Resource>> resources_local_to_sub_scene; // Record the mappings in the sub-scene.
@@ -331,6 +472,9 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						dnp.value = props[nprops[j].value];
 						dnp.base = node->get_instance_id();
 						dnp.property = snames[name_idx];
+						if (use_node_path_targets) {
+							dnp.target = planned_props[j].node_path_target;
+						}
 						deferred_node_paths.push_back(dnp);
 						continue;
 					}
@@ -411,7 +555,11 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							if (use_planned_setters) {
+								_set_node_property(node, planned_props[j].setter, planned_props[j].setter_index, snames[nprops[j].name], value, &valid);
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 						if (p_edit_state == GEN_EDIT_STATE_INSTANCE && value.get_type() != Variant::OBJECT) {
 							value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor.
@@ -466,6 +614,8 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 #endif
 						if (pending_add) {
+							// Not using add_children_bulk(): the instance is outside the tree here, so there are no
+							// tree notifications to batch, and stored names skip the validation it would repeat.
 							parent->_add_child_nocheck(node, snames[n.name]);
 						}
 						if (n.index >= 0 && n.index < parent->get_child_count() - 1) {
@@ -561,6 +711,8 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 				dict[key] = value;
 			}
 			base->set(dnp.property, dict);
+		} else if (dnp.target >= 0 && ret_nodes[dnp.target]) {
+			base->set(dnp.property, ret_nodes[dnp.target]);
 		} else {
 			base->set(dnp.property, base->get_node_or_null(dnp.value));
 		}
@@ -1315,6 +1467,7 @@ void SceneState::clear() {
 	node_paths.clear();
 	editable_instances.clear();
 	base_scene_idx = -1;
+	_clear_instantiation_plan();
 }
 
 Error SceneState::copy_from(const Ref<SceneState> &p_scene_state) {
@@ -1498,6 +1651,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	ERR_FAIL_COND(!p_dictionary.has("conns"));
 	//ERR_FAIL_COND( !p_dictionary.has("path"));
 
+	_clear_instantiation_plan();
+
 	int version = 1;
 	if (p_dictionary.has("version")) {
 		version = p_dictionary["version"];
@@ -1990,6 +2145,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.index = p_index;
 
 	nodes.push_back(nd);
+	_clear_instantiation_plan();
 
 	return nodes.size() - 1;
 }
@@ -2006,6 +2162,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 	}
 	prop.value = p_value;
 	nodes.write[p_node].properties.push_back(prop);
+	_clear_instantiation_plan();
 }
 
 void SceneState::add_node_group(int p_node, int p_group) {
@@ -2017,6 +2174,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
 	base_scene_idx = p_idx;
+	_clear_instantiation_plan();
 }
 
 void SceneState::add_connection(int p_from, int p_to, int p_signal, int p_method, int p_flags, int p_unbinds, const Vector<int> &p_binds) {
@@ -2129,6 +2287,7 @@ SceneState::SceneState() {
 ////////////////
 
 void PackedScene::_set_bundled_scene(const Dictionary &p_scene) {
+	_clear_pool();
 	state->set_bundled_scene(p_scene);
 }
 
@@ -2137,10 +2296,12 @@ Dictionary PackedScene::_get_bundled_scene() const {
 }
 
 Error PackedScene::pack(Node *p_scene) {
+	_clear_pool();
 	return state->pack(p_scene);
 }
 
 void PackedScene::clear() {
+	_clear_pool();
 	state->clear();
 }
 
@@ -2194,6 +2355,7 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 }
 
 void PackedScene::replace_state(Ref<SceneState> p_by) {
+	_clear_pool();
 	state = p_by;
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -2202,6 +2364,7 @@ void PackedScene::replace_state(Ref<SceneState> p_by) {
 }
 
 void PackedScene::recreate_state() {
+	_clear_pool();
 	state.instantiate();
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -2209,6 +2372,235 @@ void PackedScene::recreate_state() {
 #endif
 }
 
+void PackedScene::_snapshot_pool_node(Node *p_root, Node *p_node, Vector<PoolNode> &r_snapshot) {
+	PoolNode pool_node;
+	pool_node.path = p_root->get_path_to(p_node);
+
+	List<PropertyInfo> plist;
+	p_node->get_property_list(&plist);
+	for (const PropertyInfo &E : plist) {
+		if (!(E.usage & PROPERTY_USAGE_STORAGE) || E.name == CoreStringName(script)) {
+			continue;
+		}
+
+		PoolProperty prop;
+		prop.name = E.name;
+		prop.value = p_node->get(E.name);
+		if (prop.value.is_array() || prop.value.get_type() == Variant::DICTIONARY) {
+			// Instances may share containers with the scene state, keep a copy they can't edit.
+			prop.value = prop.value.duplicate(true);
+		}
+
+		if (prop.value.get_type() == Variant::OBJECT) {
+			Node *target = Object::cast_to<Node>(prop.value.get_validated_object());
+			if (target) {
+				if (target != p_root && !p_root->is_ancestor_of(target)) {
+					// Not part of the instance, leave it alone.
+					continue;
+				}
+				prop.value = p_root->get_path_to(target);
+				prop.is_node = true;
+			} else {
+				Ref<Resource> res = prop.value;
+				if (res.is_valid() && res->is_local_to_scene()) {
+					// Every instance owns its own copy.
+					continue;
+				}
+			}
+		}
+
+		pool_node.properties.push_back(prop);
+	}
+
+	r_snapshot.push_back(pool_node);
+
+	for (int i = 0; i < p_node->get_child_count(true); i++) {
+		_snapshot_pool_node(p_root, p_node->get_child(i, true), r_snapshot);
+	}
+}
+
+static uint32_t _count_pool_nodes(const Node *p_node) {
+	uint32_t count = 1;
+	for (int i = 0; i < p_node->get_child_count(true); i++) {
+		count += _count_pool_nodes(p_node->get_child(i, true));
+	}
+	return count;
+}
+
+bool PackedScene::_reset_pooled_instance(Node *p_node, const Vector<PoolNode> &p_snapshot) {
+	// Nodes added or removed after instantiation can't be restored.
+	if (_count_pool_nodes(p_node) != (uint32_t)p_snapshot.size()) {
+		return false;
+	}
+
+	for (const PoolNode &pool_node : p_snapshot) {
+		Node *node = p_node->get_node_or_null(pool_node.path);
+		if (!node) {
+			return false;
+		}
+
+		for (const PoolProperty &prop : pool_node.properties) {
+			Variant value = prop.is_node ? Variant(p_node->get_node_or_null(prop.value)) : prop.value;
+			if (node->get(prop.name) != value) {
+				// Containers are shared by reference, the instance must not be able to edit the snapshot's own.
+				if (value.is_array() || value.get_type() == Variant::DICTIONARY) {
+					value = value.duplicate(true);
+				}
+				node->set(prop.name, value);
+			}
+		}
+
+		// Like a new instance, the reused one is ready again once added to the tree.
+		node->request_ready();
+	}
+
+	return true;
+}
+
+void PackedScene::_clear_pool() {
+	LocalVector<ObjectID> stale;
+	{
+		MutexLock lock(pool_mutex);
+		stale = pool;
+		pool.clear();
+		pool_snapshot.clear();
+		pool_snapshot_valid = false;
+	}
+
+	// Freeing may run scripts, so do it outside the lock.
+	for (const ObjectID &id : stale) {
+		Node *node = ObjectDB::get_instance<Node>(id);
+		if (node && !node->get_parent()) {
+			memdelete(node);
+		}
+	}
+}
+
+Node *PackedScene::instantiate_pooled() {
+	while (true) {
+		Node *node = nullptr;
+		Vector<PoolNode> snapshot;
+		{
+			MutexLock lock(pool_mutex);
+			if (pool.is_empty()) {
+				pool_misses++;
+				break;
+			}
+			node = ObjectDB::get_instance<Node>(pool[pool.size() - 1]);
+			pool.resize(pool.size() - 1);
+			// _clear_pool() may run on another thread while the node is reset.
+			snapshot = pool_snapshot;
+		}
+
+		// The node may have been freed or reparented since it was released.
+		if (!node || node->get_parent() || node->is_queued_for_deletion()) {
+			continue;
+		}
+
+		if (_reset_pooled_instance(node, snapshot)) {
+			MutexLock lock(pool_mutex);
+			pool_hits++;
+			return node;
+		}
+
+		memdelete(node);
+	}
+
+	return instantiate();
+}
+
+void PackedScene::release_instance(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	ERR_FAIL_COND_MSG(p_node->is_queued_for_deletion(), "Can't release a node that is queued for deletion.");
+	ERR_FAIL_COND_MSG(!is_built_in() && p_node->get_scene_file_path() != get_path(), vformat("Node \"%s\" was not instantiated from \"%s\".", p_node->get_name(), get_path()));
+
+	if (p_node->get_parent()) {
+		p_node->get_parent()->remove_child(p_node);
+		ERR_FAIL_COND_MSG(p_node->get_parent(), "Failed to detach the node from its parent.");
+	}
+
+	bool needs_snapshot = false;
+	{
+		MutexLock lock(pool_mutex);
+		needs_snapshot = !pool_snapshot_valid && pool_capacity > 0;
+	}
+
+	if (needs_snapshot) {
+		// Take the reference values from a pristine instance, not the released one.
+		Node *pristine = instantiate();
+		ERR_FAIL_NULL(pristine);
+		Vector<PoolNode> snapshot;
+		_snapshot_pool_node(pristine, pristine, snapshot);
+		memdelete(pristine);
+
+		MutexLock lock(pool_mutex);
+		if (!pool_snapshot_valid) {
+			pool_snapshot = snapshot;
+			pool_snapshot_valid = true;
+		}
+	}
+
+	{
+		MutexLock lock(pool_mutex);
+		const ObjectID id = p_node->get_instance_id();
+		ERR_FAIL_COND_MSG(pool.has(id), "The node was already released.");
+		if (pool_snapshot_valid && pool.size() < (uint32_t)pool_capacity) {
+			pool.push_back(id);
+			return;
+		}
+	}
+
+	if (SceneTree::get_singleton()) {
+		p_node->queue_free();
+	} else {
+		memdelete(p_node);
+	}
+}
+
+void PackedScene::clear_pool() {
+	_clear_pool();
+}
+
+int PackedScene::get_pool_size() const {
+	MutexLock lock(pool_mutex);
+	return pool.size();
+}
+
+void PackedScene::set_pool_capacity(int p_capacity) {
+	ERR_FAIL_COND(p_capacity < 0);
+	LocalVector<ObjectID> excess;
+	{
+		MutexLock lock(pool_mutex);
+		pool_capacity = p_capacity;
+		while (pool.size() > (uint32_t)pool_capacity) {
+			excess.push_back(pool[pool.size() - 1]);
+			pool.resize(pool.size() - 1);
+		}
+	}
+
+	for (const ObjectID &id : excess) {
+		Node *node = ObjectDB::get_instance<Node>(id);
+		if (node && !node->get_parent()) {
+			memdelete(node);
+		}
+	}
+}
+
+int PackedScene::get_pool_capacity() const {
+	MutexLock lock(pool_mutex);
+	return pool_capacity;
+}
+
+uint64_t PackedScene::get_pool_hit_count() const {
+	MutexLock lock(pool_mutex);
+	return pool_hits;
+}
+
+uint64_t PackedScene::get_pool_miss_count() const {
+	MutexLock lock(pool_mutex);
+	return pool_misses;
+}
+
 #ifdef TOOLS_ENABLED
 HashSet<StringName> PackedScene::get_scene_groups(const String &p_path) {
 	{
@@ -2283,8 +2675,17 @@ void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
 	ClassDB::bind_method(D_METHOD("get_state"), &PackedScene::get_state);
+	ClassDB::bind_method(D_METHOD("instantiate_pooled"), &PackedScene::instantiate_pooled);
+	ClassDB::bind_method(D_METHOD("release_instance", "node"), &PackedScene::release_instance);
+	ClassDB::bind_method(D_METHOD("clear_pool"), &PackedScene::clear_pool);
+	ClassDB::bind_method(D_METHOD("get_pool_size"), &PackedScene::get_pool_size);
+	ClassDB::bind_method(D_METHOD("set_pool_capacity", "capacity"), &PackedScene::set_pool_capacity);
+	ClassDB::bind_method(D_METHOD("get_pool_capacity"), &PackedScene::get_pool_capacity);
+	ClassDB::bind_method(D_METHOD("get_pool_hit_count"), &PackedScene::get_pool_hit_count);
+	ClassDB::bind_method(D_METHOD("get_pool_miss_count"), &PackedScene::get_pool_miss_count);
 
 	ADD_PROPERTY(PropertyInfo(Variant::DICTIONARY, "_bundled", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_STORAGE | PROPERTY_USAGE_INTERNAL), "_set_bundled_scene", "_get_bundled_scene");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "pool_capacity", PROPERTY_HINT_RANGE, "0,1024,1,or_greater", PROPERTY_USAGE_NONE), "set_pool_capacity", "get_pool_capacity");
 
 	BIND_ENUM_CONSTANT(GEN_EDIT_STATE_DISABLED);
 	BIND_ENUM_CONSTANT(GEN_EDIT_STATE_INSTANCE);
@@ -2295,3 +2696,7 @@ void PackedScene::_bind_methods() {
 PackedScene::PackedScene() {
 	state.instantiate();
 }
+
+PackedScene::~PackedScene() {
+	_clear_pool();
+}
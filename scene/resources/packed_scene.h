@@ -31,6 +31,9 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -72,8 +75,33 @@ class SceneState : public RefCounted {
 		ObjectID base;
 		StringName property;
 		Variant value;
+		int target = -1;
 	};
 
+	// Work done once per scene and reused by every instantiation: resolved property
+	// setters and, when the scene has no instances or inheritance, the nodes that
+	// NodePath properties point to.
+	struct InstantiationPlan {
+		struct Property {
+			MethodBind *setter = nullptr;
+			int setter_index = -1;
+			int node_path_target = -1;
+		};
+
+		LocalVector<StringName> node_classes; // Empty for nodes not created by this scene.
+		LocalVector<uint32_t> property_offsets;
+		LocalVector<Property> properties;
+	};
+
+	mutable InstantiationPlan instantiation_plan;
+	mutable SafeFlag instantiation_plan_built;
+	mutable BinaryMutex instantiation_plan_mutex;
+
+	void _build_instantiation_plan() const;
+	const InstantiationPlan &_get_instantiation_plan() const;
+	void _clear_instantiation_plan();
+	int _find_node_path_target(int p_from, const NodePath &p_path, const LocalVector<LocalVector<int>> &p_children) const;
+
 	Vector<NodeData> nodes;
 
 	struct ConnectionData {
@@ -234,6 +262,31 @@ class PackedScene : public Resource {
 
 	Ref<SceneState> state;
 
+	// Detached instances kept for reuse, and the property values of a freshly
+	// instantiated scene used to reset them when they are reacquired.
+	struct PoolProperty {
+		StringName name;
+		Variant value;
+		bool is_node = false; // The value is a NodePath relative to the instance root.
+	};
+
+	struct PoolNode {
+		NodePath path;
+		LocalVector<PoolProperty> properties;
+	};
+
+	mutable Mutex pool_mutex;
+	LocalVector<ObjectID> pool;
+	Vector<PoolNode> pool_snapshot; // Copy-on-write, so reused instances can hold it outside of the lock.
+	bool pool_snapshot_valid = false;
+	int pool_capacity = 64;
+	uint64_t pool_hits = 0;
+	uint64_t pool_misses = 0;
+
+	static void _snapshot_pool_node(Node *p_root, Node *p_node, Vector<PoolNode> &r_snapshot);
+	static bool _reset_pooled_instance(Node *p_node, const Vector<PoolNode> &p_snapshot);
+	void _clear_pool();
+
 	void _set_bundled_scene(const Dictionary &p_scene);
 	Dictionary _get_bundled_scene() const;
 
@@ -260,6 +313,15 @@ public:
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
 
+	Node *instantiate_pooled();
+	void release_instance(Node *p_node);
+	void clear_pool();
+	int get_pool_size() const;
+	void set_pool_capacity(int p_capacity);
+	int get_pool_capacity() const;
+	uint64_t get_pool_hit_count() const;
+	uint64_t get_pool_miss_count() const;
+
 	virtual void reload_from_file() override;
 
 	virtual void set_path(const String &p_path, bool p_take_over = false) override;
@@ -276,6 +338,7 @@ public:
 	Ref<SceneState> get_state() const;
 
 	PackedScene();
+	~PackedScene();
 };
 
 VARIANT_ENUM_CAST(PackedScene::GenEditState)
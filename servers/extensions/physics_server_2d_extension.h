@@ -234,6 +234,7 @@ public:
 	EXBIND2(space_set_debug_contacts, RID, int)
 	EXBIND1RC(Vector<Vector2>, space_get_contacts, RID)
 	EXBIND1RC(int, space_get_contact_count, RID)
+	EXBIND1RC(uint64_t, space_get_state_hash, RID)
 
 	/* AREA API */
 
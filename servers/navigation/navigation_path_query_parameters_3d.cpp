@@ -102,6 +102,14 @@ real_t NavigationPathQueryParameters3D::get_simplify_epsilon() const {
 	return simplify_epsilon;
 }
 
+void NavigationPathQueryParameters3D::set_use_hierarchical_pathfinding(bool p_enabled) {
+	use_hierarchical_pathfinding = p_enabled;
+}
+
+bool NavigationPathQueryParameters3D::get_use_hierarchical_pathfinding() const {
+	return use_hierarchical_pathfinding;
+}
+
 void NavigationPathQueryParameters3D::set_included_regions(const TypedArray<RID> &p_regions) {
 	_included_regions.resize(p_regions.size());
 	for (uint32_t i = 0; i < _included_regions.size(); i++) {
@@ -162,6 +170,9 @@ void NavigationPathQueryParameters3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_simplify_epsilon", "epsilon"), &NavigationPathQueryParameters3D::set_simplify_epsilon);
 	ClassDB::bind_method(D_METHOD("get_simplify_epsilon"), &NavigationPathQueryParameters3D::get_simplify_epsilon);
 
+	ClassDB::bind_method(D_METHOD("set_use_hierarchical_pathfinding", "enabled"), &NavigationPathQueryParameters3D::set_use_hierarchical_pathfinding);
+	ClassDB::bind_method(D_METHOD("get_use_hierarchical_pathfinding"), &NavigationPathQueryParameters3D::get_use_hierarchical_pathfinding);
+
 	ClassDB::bind_method(D_METHOD("set_included_regions", "regions"), &NavigationPathQueryParameters3D::set_included_regions);
 	ClassDB::bind_method(D_METHOD("get_included_regions"), &NavigationPathQueryParameters3D::get_included_regions);
 
@@ -177,6 +188,7 @@ void NavigationPathQueryParameters3D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "metadata_flags", PROPERTY_HINT_FLAGS, "Include Types,Include RIDs,Include Owners"), "set_metadata_flags", "get_metadata_flags");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "simplify_path"), "set_simplify_path", "get_simplify_path");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "simplify_epsilon"), "set_simplify_epsilon", "get_simplify_epsilon");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_hierarchical_pathfinding"), "set_use_hierarchical_pathfinding", "get_use_hierarchical_pathfinding");
 	ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "excluded_regions", PROPERTY_HINT_ARRAY_TYPE, "RID"), "set_excluded_regions", "get_excluded_regions");
 	ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "included_regions", PROPERTY_HINT_ARRAY_TYPE, "RID"), "set_included_regions", "get_included_regions");
 
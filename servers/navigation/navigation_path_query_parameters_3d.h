@@ -68,6 +68,7 @@ private:
 	BitField<PathMetadataFlags> metadata_flags = PATH_METADATA_INCLUDE_ALL;
 	bool simplify_path = false;
 	real_t simplify_epsilon = 0.0;
+	bool use_hierarchical_pathfinding = false;
 	LocalVector<RID> _excluded_regions;
 	LocalVector<RID> _included_regions;
 
@@ -99,6 +100,9 @@ public:
 	void set_simplify_epsilon(real_t p_epsilon);
 	real_t get_simplify_epsilon() const;
 
+	void set_use_hierarchical_pathfinding(bool p_enabled);
+	bool get_use_hierarchical_pathfinding() const;
+
 	void set_excluded_regions(const TypedArray<RID> &p_regions);
 	TypedArray<RID> get_excluded_regions() const;
 
@@ -71,8 +71,10 @@ void NavigationServer2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("map_get_use_async_iterations", "map"), &NavigationServer2D::map_get_use_async_iterations);
 
 	ClassDB::bind_method(D_METHOD("map_get_random_point", "map", "navigation_layers", "uniformly"), &NavigationServer2D::map_get_random_point);
+	ClassDB::bind_method(D_METHOD("map_get_flow_directions", "map", "target_position", "positions", "navigation_layers"), &NavigationServer2D::map_get_flow_directions, DEFVAL(1));
 
 	ClassDB::bind_method(D_METHOD("query_path", "parameters", "result", "callback"), &NavigationServer2D::query_path, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("query_path_batch", "parameters", "start_target_positions"), &NavigationServer2D::query_path_batch);
 
 	ClassDB::bind_method(D_METHOD("region_create"), &NavigationServer2D::region_create);
 	ClassDB::bind_method(D_METHOD("region_get_iteration_id", "region"), &NavigationServer2D::region_get_iteration_id);
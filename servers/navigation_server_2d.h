@@ -96,6 +96,7 @@ public:
 	virtual bool map_get_use_async_iterations(RID p_map) const = 0;
 
 	virtual Vector2 map_get_random_point(RID p_map, uint32_t p_navigation_layers, bool p_uniformly) const = 0;
+	virtual PackedVector2Array map_get_flow_directions(RID p_map, const Vector2 &p_target_position, const PackedVector2Array &p_positions, uint32_t p_navigation_layers = 1) const = 0;
 
 	/* REGION API */
 
@@ -245,6 +246,7 @@ public:
 	/* QUERY API */
 
 	virtual void query_path(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback = Callable()) = 0;
+	virtual Dictionary query_path_batch(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, const PackedVector2Array &p_start_target_positions) = 0;
 
 	/* NAVMESH BAKE API */
 
@@ -79,8 +79,10 @@ void NavigationServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("map_get_use_async_iterations", "map"), &NavigationServer3D::map_get_use_async_iterations);
 
 	ClassDB::bind_method(D_METHOD("map_get_random_point", "map", "navigation_layers", "uniformly"), &NavigationServer3D::map_get_random_point);
+	ClassDB::bind_method(D_METHOD("map_get_flow_directions", "map", "target_position", "positions", "navigation_layers"), &NavigationServer3D::map_get_flow_directions, DEFVAL(1));
 
 	ClassDB::bind_method(D_METHOD("query_path", "parameters", "result", "callback"), &NavigationServer3D::query_path, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("query_path_batch", "parameters", "start_target_positions"), &NavigationServer3D::query_path_batch);
 
 	ClassDB::bind_method(D_METHOD("region_create"), &NavigationServer3D::region_create);
 	ClassDB::bind_method(D_METHOD("region_get_iteration_id", "region"), &NavigationServer3D::region_get_iteration_id);
@@ -232,6 +234,10 @@ void NavigationServer3D::_bind_methods() {
 	BIND_ENUM_CONSTANT(INFO_EDGE_CONNECTION_COUNT);
 	BIND_ENUM_CONSTANT(INFO_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(INFO_OBSTACLE_COUNT);
+	BIND_ENUM_CONSTANT(INFO_PATH_CACHE_HIT_COUNT);
+	BIND_ENUM_CONSTANT(INFO_PATH_CACHE_MISS_COUNT);
+	BIND_ENUM_CONSTANT(INFO_PATH_CLUSTER_COUNT);
+	BIND_ENUM_CONSTANT(INFO_HIERARCHICAL_PATH_QUERY_COUNT);
 }
 
 NavigationServer3D *NavigationServer3D::get_singleton() {
@@ -249,6 +255,10 @@ NavigationServer3D::NavigationServer3D() {
 	GLOBAL_DEF("navigation/3d/use_edge_connections", true);
 	GLOBAL_DEF_BASIC(PropertyInfo(Variant::FLOAT, "navigation/3d/default_edge_connection_margin", PROPERTY_HINT_RANGE, "0.01,10,0.001,or_greater"), NavigationDefaults3D::EDGE_CONNECTION_MARGIN);
 	GLOBAL_DEF_BASIC(PropertyInfo(Variant::FLOAT, "navigation/3d/default_link_connection_radius", PROPERTY_HINT_RANGE, "0.01,10,0.001,or_greater"), NavigationDefaults3D::LINK_CONNECTION_RADIUS);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "navigation/3d/path_hierarchy_cluster_size", PROPERTY_HINT_RANGE, "0,100,0.01,or_greater"), 0.0);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "navigation/3d/path_cache_size", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), 0);
+	GLOBAL_DEF("navigation/3d/avoidance_use_spatial_grid", false);
+	GLOBAL_DEF("navigation/3d/avoidance_deterministic", false);
 
 #ifdef DEBUG_ENABLED
 #ifndef DISABLE_DEPRECATED
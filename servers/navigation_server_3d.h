@@ -103,6 +103,7 @@ public:
 	virtual bool map_get_use_async_iterations(RID p_map) const = 0;
 
 	virtual Vector3 map_get_random_point(RID p_map, uint32_t p_navigation_layers, bool p_uniformly) const = 0;
+	virtual PackedVector3Array map_get_flow_directions(RID p_map, const Vector3 &p_target_position, const PackedVector3Array &p_positions, uint32_t p_navigation_layers = 1) const = 0;
 
 	/* REGION API */
 
@@ -275,6 +276,7 @@ public:
 	/* QUERY API */
 
 	virtual void query_path(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) = 0;
+	virtual Dictionary query_path_batch(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, const PackedVector3Array &p_start_target_positions) = 0;
 
 	/* NAVMESH BAKE API */
 
@@ -322,6 +324,10 @@ public:
 		INFO_EDGE_CONNECTION_COUNT,
 		INFO_EDGE_FREE_COUNT,
 		INFO_OBSTACLE_COUNT,
+		INFO_PATH_CACHE_HIT_COUNT,
+		INFO_PATH_CACHE_MISS_COUNT,
+		INFO_PATH_CLUSTER_COUNT,
+		INFO_HIERARCHICAL_PATH_QUERY_COUNT,
 	};
 
 	virtual int get_process_info(ProcessInfo p_info) const = 0;
@@ -276,6 +276,7 @@ public:
 	virtual void space_set_debug_contacts(RID p_space, int p_max_contacts) = 0;
 	virtual Vector<Vector2> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
+	virtual uint64_t space_get_state_hash(RID p_space) const = 0;
 
 	//missing space parameters
 
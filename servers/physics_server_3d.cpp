@@ -475,14 +475,116 @@ Dictionary PhysicsDirectSpaceState3D::_get_rest_info(const Ref<PhysicsShapeQuery
 	return r;
 }
 
+Dictionary PhysicsDirectSpaceState3D::_intersect_ray_batch(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_rays) {
+	ERR_FAIL_COND_V(p_ray_query.is_null(), Dictionary());
+	ERR_FAIL_COND_V_MSG(p_rays.size() % 2 != 0, Dictionary(), "Rays must be given as pairs of points, from and to.");
+
+	const int ray_count = p_rays.size() / 2;
+	Vector<RayResult> results;
+	results.resize(ray_count);
+	PackedByteArray hits;
+	hits.resize(ray_count);
+	hits.fill(0); // Implementations failing early don't write any hit.
+
+	intersect_ray_batch(p_ray_query->get_parameters(), p_rays.ptr(), ray_count, results.ptrw(), hits.ptrw());
+
+	PackedVector3Array positions;
+	positions.resize(ray_count);
+	PackedVector3Array normals;
+	normals.resize(ray_count);
+	PackedInt64Array collider_ids;
+	collider_ids.resize(ray_count);
+	PackedInt32Array shapes;
+	shapes.resize(ray_count);
+
+	Vector3 *positions_ptr = positions.ptrw();
+	Vector3 *normals_ptr = normals.ptrw();
+	int64_t *collider_ids_ptr = collider_ids.ptrw();
+	int32_t *shapes_ptr = shapes.ptrw();
+	const RayResult *results_ptr = results.ptr();
+	const uint8_t *hits_ptr = hits.ptr();
+	for (int i = 0; i < ray_count; i++) {
+		if (hits_ptr[i]) {
+			positions_ptr[i] = results_ptr[i].position;
+			normals_ptr[i] = results_ptr[i].normal;
+			collider_ids_ptr[i] = int64_t(results_ptr[i].collider_id);
+			shapes_ptr[i] = results_ptr[i].shape;
+		} else {
+			positions_ptr[i] = Vector3();
+			normals_ptr[i] = Vector3();
+			collider_ids_ptr[i] = 0;
+			shapes_ptr[i] = -1;
+		}
+	}
+
+	Dictionary d;
+	d["hit"] = hits;
+	d["position"] = positions;
+	d["normal"] = normals;
+	d["collider_id"] = collider_ids;
+	d["shape"] = shapes;
+
+	return d;
+}
+
+Vector<real_t> PhysicsDirectSpaceState3D::_cast_motion_batch(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const TypedArray<Transform3D> &p_transforms, const PackedVector3Array &p_motions) {
+	ERR_FAIL_COND_V(p_shape_query.is_null(), Vector<real_t>());
+	ERR_FAIL_COND_V_MSG(p_transforms.size() != p_motions.size(), Vector<real_t>(), "Each cast needs both a transform and a motion.");
+
+	const int count = p_motions.size();
+	LocalVector<Transform3D> transforms;
+	transforms.resize(count);
+	for (int i = 0; i < count; i++) {
+		transforms[i] = p_transforms[i];
+	}
+
+	LocalVector<real_t> closest_safe;
+	closest_safe.resize(count);
+	LocalVector<real_t> closest_unsafe;
+	closest_unsafe.resize(count);
+
+	cast_motion_batch(p_shape_query->get_parameters(), transforms.ptr(), p_motions.ptr(), count, closest_safe.ptr(), closest_unsafe.ptr());
+
+	Vector<real_t> ret;
+	ret.resize(count * 2);
+	real_t *ret_ptr = ret.ptrw();
+	for (int i = 0; i < count; i++) {
+		ret_ptr[i * 2 + 0] = closest_safe[i];
+		ret_ptr[i * 2 + 1] = closest_unsafe[i];
+	}
+	return ret;
+}
+
+void PhysicsDirectSpaceState3D::intersect_ray_batch(const RayParameters &p_parameters, const Vector3 *p_from_to, int p_ray_count, RayResult *r_results, uint8_t *r_hits) {
+	RayParameters parameters = p_parameters;
+	for (int i = 0; i < p_ray_count; i++) {
+		parameters.from = p_from_to[i * 2 + 0];
+		parameters.to = p_from_to[i * 2 + 1];
+		r_hits[i] = intersect_ray(parameters, r_results[i]);
+	}
+}
+
+void PhysicsDirectSpaceState3D::cast_motion_batch(const ShapeParameters &p_parameters, const Transform3D *p_transforms, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) {
+	ShapeParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.transform = p_transforms[i];
+		parameters.motion = p_motions[i];
+		r_closest_safe[i] = 1.0;
+		r_closest_unsafe[i] = 1.0;
+		cast_motion(parameters, r_closest_safe[i], r_closest_unsafe[i]);
+	}
+}
+
 PhysicsDirectSpaceState3D::PhysicsDirectSpaceState3D() {
 }
 
 void PhysicsDirectSpaceState3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("intersect_point", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_intersect_point, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("intersect_ray", "parameters"), &PhysicsDirectSpaceState3D::_intersect_ray);
+	ClassDB::bind_method(D_METHOD("intersect_ray_batch", "parameters", "rays"), &PhysicsDirectSpaceState3D::_intersect_ray_batch);
 	ClassDB::bind_method(D_METHOD("intersect_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_intersect_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("cast_motion", "parameters"), &PhysicsDirectSpaceState3D::_cast_motion);
+	ClassDB::bind_method(D_METHOD("cast_motion_batch", "parameters", "transforms", "motions"), &PhysicsDirectSpaceState3D::_cast_motion_batch);
 	ClassDB::bind_method(D_METHOD("collide_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_collide_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("get_rest_info", "parameters"), &PhysicsDirectSpaceState3D::_get_rest_info);
 }
@@ -1130,6 +1232,7 @@ PhysicsServer3D::PhysicsServer3D() {
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/default_angular_damp", PROPERTY_HINT_RANGE, "0,100,0.001,or_greater"), 0.1);
 
 	// PhysicsServer3D
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "physics/3d/broadphase", PROPERTY_HINT_ENUM, "BVH,Sweep and Prune"), 0);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/sleep_threshold_linear", PROPERTY_HINT_RANGE, "0,1,0.001,or_greater"), 0.1);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/sleep_threshold_angular", PROPERTY_HINT_RANGE, "0,90,0.1,radians_as_degrees"), Math::deg_to_rad(8.0));
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/time_before_sleep", PROPERTY_HINT_RANGE, "0,5,0.01,or_greater"), 0.5);
@@ -0,0 +1,126 @@
+/**************************************************************************/
+/*  test_frame_trace.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/debugger/frame_trace.h"
+#include "core/io/json.h"
+#include "core/os/thread.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFrameTrace {
+
+static Array get_trace_events(const String &p_name) {
+	Dictionary trace = JSON::parse_string(FrameTrace::to_chrome_trace_json());
+	Array events = trace["traceEvents"];
+	Array result;
+	for (const Variant &event : events) {
+		Dictionary dict = event;
+		if (dict["name"] == p_name) {
+			result.push_back(dict);
+		}
+	}
+	return result;
+}
+
+TEST_CASE("[FrameTrace] Scopes are only recorded while enabled") {
+	FrameTrace::clear();
+
+	{
+		FRAME_TRACE_SCOPE("FrameTraceTest::disabled");
+	}
+	CHECK(get_trace_events("FrameTraceTest::disabled").is_empty());
+
+	FrameTrace::set_enabled(true);
+	{
+		FRAME_TRACE_SCOPE("FrameTraceTest::outer");
+		{
+			FRAME_TRACE_SCOPE("FrameTraceTest::inner");
+			OS::get_singleton()->delay_usec(100);
+		}
+	}
+	FrameTrace::set_enabled(false);
+
+	Array outer = get_trace_events("FrameTraceTest::outer");
+	Array inner = get_trace_events("FrameTraceTest::inner");
+	REQUIRE_EQ(outer.size(), 1);
+	REQUIRE_EQ(inner.size(), 1);
+
+	Dictionary outer_event = outer[0];
+	Dictionary inner_event = inner[0];
+	CHECK_EQ(outer_event["ph"], "X");
+	CHECK_EQ(outer_event["tid"], inner_event["tid"]);
+	CHECK((double)inner_event["dur"] >= 100);
+	CHECK((double)outer_event["ts"] <= (double)inner_event["ts"]);
+	CHECK((double)outer_event["ts"] + (double)outer_event["dur"] >= (double)inner_event["ts"] + (double)inner_event["dur"]);
+
+	FrameTrace::finalize();
+}
+
+TEST_CASE("[FrameTrace] Clearing discards earlier events") {
+	const uint64_t now = OS::get_singleton()->get_ticks_usec();
+	FrameTrace::record("FrameTraceTest::old", now, now + 1);
+	CHECK_EQ(get_trace_events("FrameTraceTest::old").size(), 1);
+
+	OS::get_singleton()->delay_usec(10);
+	FrameTrace::clear();
+	CHECK(get_trace_events("FrameTraceTest::old").is_empty());
+
+	FrameTrace::finalize();
+}
+
+static void record_on_thread(void *p_userdata) {
+	FRAME_TRACE_SCOPE("FrameTraceTest::thread");
+}
+
+TEST_CASE("[FrameTrace] Each thread records to its own buffer") {
+	FrameTrace::clear();
+	FrameTrace::set_enabled(true);
+
+	{
+		FRAME_TRACE_SCOPE("FrameTraceTest::main");
+	}
+	Thread thread;
+	thread.start(record_on_thread, nullptr);
+	thread.wait_to_finish();
+
+	FrameTrace::set_enabled(false);
+
+	Array main_events = get_trace_events("FrameTraceTest::main");
+	Array thread_events = get_trace_events("FrameTraceTest::thread");
+	REQUIRE_EQ(main_events.size(), 1);
+	REQUIRE_EQ(thread_events.size(), 1);
+	CHECK_NE(((Dictionary)main_events[0])["tid"], ((Dictionary)thread_events[0])["tid"]);
+
+	FrameTrace::finalize();
+}
+
+} // namespace TestFrameTrace
@@ -116,4 +116,41 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 27000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+
+TEST_CASE("[PCKPacker] Load a packed PCK file") {
+	const String source_path = TestUtils::get_temp_path("pck_source.txt");
+	{
+		Ref<FileAccess> source = FileAccess::open(source_path, FileAccess::WRITE);
+		REQUIRE(source.is_valid());
+		source->store_string("Godot");
+	}
+
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_load.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	// Files from different directories are interleaved, so the directory lookup can't always be reused.
+	const char *paths[] = { "pck_load/a/one.txt", "pck_load/a/two.txt", "pck_load/b/three.txt", "pck_load/a/four.txt", "pck_load/a/c/five.txt" };
+	for (const char *path : paths) {
+		REQUIRE(pck_packer.add_file(path, source_path) == OK);
+	}
+	REQUIRE(pck_packer.flush() == OK);
+
+	PackedData *packed_data = PackedData::get_singleton();
+	REQUIRE(packed_data != nullptr);
+	REQUIRE(packed_data->add_pack(output_pck_path, false, 0) == OK);
+
+	for (const char *path : paths) {
+		CHECK_MESSAGE(packed_data->has_path(vformat("res://%s", path)), vformat("\"%s\" should be in the pack.", path));
+	}
+	CHECK(packed_data->get_size("pck_load/b/three.txt") == 5);
+	CHECK(packed_data->get_file_paths().size() == 5);
+
+	Ref<DirAccess> da = packed_data->try_open_directory("res://pck_load/a");
+	REQUIRE(da.is_valid());
+	CHECK(da->get_files().size() == 3);
+	CHECK(da->get_directories().size() == 1);
+
+	packed_data->clear();
+	CHECK_FALSE(packed_data->has_path("res://pck_load/a/one.txt"));
+}
 } // namespace TestPCKPacker
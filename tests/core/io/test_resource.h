@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/io/file_access.h"
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
@@ -111,6 +112,94 @@ TEST_CASE("[Resource] Saving and loading") {
 			"The loaded child resource name should be equal to the expected value.");
 }
 
+TEST_CASE("[Resource] Incremental binary saving") {
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Hello world");
+	PackedByteArray data;
+	data.resize(64 * 1024);
+	for (int i = 0; i < data.size(); i++) {
+		data.write[i] = uint8_t(i);
+	}
+	resource->set_meta("data", data);
+	Ref<Resource> child_resource = memnew(Resource);
+	child_resource->set_name("I'm a child resource");
+	resource->set_meta("other_resource", child_resource);
+
+	const String save_path = TestUtils::get_temp_path("resource_incremental.res");
+	REQUIRE(ResourceSaver::save(resource, save_path, ResourceSaver::FLAG_INCREMENTAL) == OK);
+	const int64_t full_size = FileAccess::get_size(save_path);
+
+	child_resource->set_name("My name was changed");
+	resource->set_meta("counter", 1);
+	REQUIRE(ResourceSaver::save(resource, save_path, ResourceSaver::FLAG_INCREMENTAL) == OK);
+	const int64_t delta_size = FileAccess::get_size(save_path) - full_size;
+	CHECK_MESSAGE(
+			delta_size < data.size() / 8,
+			"Only the changed properties should be appended to the file.");
+
+	Ref<Resource> loaded_resource = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded_resource.is_valid());
+	CHECK_MESSAGE(
+			loaded_resource->get_name() == "Hello world",
+			"Unchanged properties should be loaded from the original data.");
+	CHECK_MESSAGE(
+			loaded_resource->get_meta("data") == data,
+			"Unchanged properties should be loaded from the original data.");
+	CHECK_MESSAGE(
+			loaded_resource->get_meta("counter") == Variant(1),
+			"New properties should be loaded from the appended data.");
+	Ref<Resource> loaded_child_resource = loaded_resource->get_meta("other_resource");
+	REQUIRE(loaded_child_resource.is_valid());
+	CHECK_MESSAGE(
+			loaded_child_resource->get_name() == "My name was changed",
+			"Changed subresource properties should be loaded from the appended data.");
+
+	// Removing a property can't be expressed as a patch, the resource is written whole again.
+	resource->remove_meta("counter");
+	Ref<Resource> new_child_resource = memnew(Resource);
+	new_child_resource->set_name("I'm a new child resource");
+	resource->set_meta("other_resource", new_child_resource);
+	REQUIRE(ResourceSaver::save(resource, save_path, ResourceSaver::FLAG_INCREMENTAL) == OK);
+
+	loaded_resource = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded_resource.is_valid());
+	CHECK_FALSE(loaded_resource->has_meta("counter"));
+	CHECK(loaded_resource->get_meta("data") == data);
+	loaded_child_resource = loaded_resource->get_meta("other_resource");
+	REQUIRE(loaded_child_resource.is_valid());
+	CHECK(loaded_child_resource->get_name() == "I'm a new child resource");
+
+	// A regular save compacts the file.
+	const int64_t incremental_size = FileAccess::get_size(save_path);
+	REQUIRE(ResourceSaver::save(resource, save_path) == OK);
+	CHECK(FileAccess::get_size(save_path) < incremental_size);
+	loaded_resource = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded_resource.is_valid());
+	CHECK(loaded_resource->get_meta("data") == data);
+}
+
+TEST_CASE("[Resource] Incremental binary saving of packed arrays edited in place") {
+	Ref<Resource> resource = memnew(Resource);
+	PackedInt32Array ints = { 1, 2, 3 };
+	resource->set_meta("ints", ints);
+
+	const String save_path = TestUtils::get_temp_path("resource_incremental_packed.res");
+	REQUIRE(ResourceSaver::save(resource, save_path, ResourceSaver::FLAG_INCREMENTAL) == OK);
+
+	// Variant copies of a packed array share it, like a script editing an exported property does.
+	Variant shared_ints = resource->get_meta("ints");
+	shared_ints.call("append", 4);
+	REQUIRE(PackedInt32Array(resource->get_meta("ints")).size() == 4);
+	REQUIRE(ResourceSaver::save(resource, save_path, ResourceSaver::FLAG_INCREMENTAL) == OK);
+
+	Ref<Resource> loaded_resource = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded_resource.is_valid());
+	const PackedInt32Array expected_ints = { 1, 2, 3, 4 };
+	CHECK_MESSAGE(
+			PackedInt32Array(loaded_resource->get_meta("ints")) == expected_ints,
+			"Packed arrays edited in place should be saved again.");
+}
+
 TEST_CASE("[Resource] Breaking circular references on save") {
 	Ref<Resource> resource_a = memnew(Resource);
 	resource_a->set_name("A");
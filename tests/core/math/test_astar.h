@@ -31,6 +31,8 @@
 #pragma once
 
 #include "core/math/a_star.h"
+#include "core/math/a_star_grid_2d.h"
+#include "core/object/worker_thread_pool.h"
 
 #include "tests/test_macros.h"
 
@@ -356,4 +358,264 @@ TEST_CASE("[Stress][AStar3D] Find paths") {
 		CHECK_MESSAGE(match, "Found all paths.");
 	}
 }
+
+static real_t astar_grid_2d_path_cost(const Ref<AStarGrid2D> &p_grid, const TypedArray<Vector2i> &p_path) {
+	real_t cost = 0.0;
+	for (int i = 1; i < p_path.size(); i++) {
+		const Vector2i from = p_path[i - 1];
+		const Vector2i to = p_path[i];
+		const real_t weight_scale = p_grid->is_jumping_enabled() ? 1.0 : p_grid->get_point_weight_scale(to);
+		cost += Vector2(from).distance_to(Vector2(to)) * weight_scale;
+	}
+	return cost;
+}
+
+TEST_CASE("[AStarGrid2D] Batched paths should cost the same as single paths") {
+	Ref<AStarGrid2D> grid;
+	grid.instantiate();
+	// Not a multiple of 64, so that rows of the solid mask straddle words.
+	grid->set_region(Rect2i(-5, -3, 70, 45));
+	grid->update();
+
+	Math::seed(0);
+	for (int y = -3; y < 42; y++) {
+		for (int x = -5; x < 65; x++) {
+			grid->set_point_solid(Vector2i(x, y), Math::rand() % 4 == 0);
+			grid->set_point_weight_scale(Vector2i(x, y), 1.0 + Math::rand() % 3);
+		}
+	}
+	TypedArray<Vector2i> from_to_ids;
+	while (from_to_ids.size() < 64) {
+		const Vector2i id = Vector2i(-5 + Math::rand() % 70, -3 + Math::rand() % 45);
+		if (!grid->is_point_solid(id)) {
+			from_to_ids.push_back(id);
+		}
+	}
+	// A solid target can only be reached with a partial path.
+	const Vector2i solid_id = Vector2i(10, 10);
+	grid->set_point_solid(solid_id);
+	from_to_ids.push_back(from_to_ids[0]);
+	from_to_ids.push_back(solid_id);
+
+	for (int diagonal_mode = 0; diagonal_mode < AStarGrid2D::DIAGONAL_MODE_MAX; diagonal_mode++) {
+		for (int jumping = 0; jumping < 2; jumping++) {
+			grid->set_diagonal_mode(AStarGrid2D::DiagonalMode(diagonal_mode));
+			grid->set_jumping_enabled(jumping);
+
+			for (int partial = 0; partial < 2; partial++) {
+				const TypedArray<Array> paths = grid->get_id_paths(from_to_ids, partial);
+				REQUIRE_EQ(paths.size(), from_to_ids.size() / 2);
+
+				for (int i = 0; i < paths.size(); i++) {
+					const TypedArray<Vector2i> path = grid->get_id_path(from_to_ids[i * 2 + 0], from_to_ids[i * 2 + 1], partial);
+					const TypedArray<Vector2i> batch_path = paths[i];
+					REQUIRE_EQ(batch_path.is_empty(), path.is_empty());
+					if (path.is_empty()) {
+						continue;
+					}
+					CHECK_EQ(batch_path.front(), path.front());
+					if (batch_path.back() == path.back()) {
+						CHECK(Math::is_equal_approx(astar_grid_2d_path_cost(grid, batch_path), astar_grid_2d_path_cost(grid, path)));
+					} else {
+						// Partial paths may end at different points that are equally close to the target.
+						CHECK(partial);
+						const Vector2 target = Vector2i(from_to_ids[i * 2 + 1]);
+						CHECK(Math::is_equal_approx(target.distance_to(Vector2i(batch_path.back())), target.distance_to(Vector2i(path.back()))));
+					}
+				}
+			}
+		}
+	}
+}
+
+template <typename T>
+static real_t astar_path_cost(T &p_astar, const Vector<int64_t> &p_path) {
+	real_t cost = 0.0;
+	for (int i = 1; i < p_path.size(); i++) {
+		CHECK(p_astar.are_points_connected(p_path[i - 1], p_path[i], false));
+		cost += p_astar.get_point_position(p_path[i - 1]).distance_to(p_astar.get_point_position(p_path[i])) * p_astar.get_point_weight_scale(p_path[i]);
+	}
+	return cost;
+}
+
+template <typename T>
+static void check_frozen_astar_paths(T &p_astar, int p_point_count) {
+	for (int i = 0; i < 200; i++) {
+		const int64_t from = Math::rand() % p_point_count;
+		const int64_t to = Math::rand() % p_point_count;
+
+		for (int partial = 0; partial < 2; partial++) {
+			p_astar.unfreeze();
+			const Vector<int64_t> path = p_astar.get_id_path(from, to, partial);
+			p_astar.freeze();
+			const Vector<int64_t> frozen_path = p_astar.get_id_path(from, to, partial);
+
+			REQUIRE_EQ(frozen_path.is_empty(), path.is_empty());
+			if (path.is_empty()) {
+				continue;
+			}
+			CHECK_EQ(frozen_path[0], from);
+			CHECK_EQ(p_astar.get_point_path(from, to, partial).size(), frozen_path.size());
+			for (int j = 1; j < frozen_path.size() - 1; j++) {
+				CHECK_FALSE(p_astar.is_point_disabled(frozen_path[j]));
+			}
+			if (frozen_path[frozen_path.size() - 1] == path[path.size() - 1]) {
+				CHECK(Math::is_equal_approx(astar_path_cost(p_astar, frozen_path), astar_path_cost(p_astar, path)));
+			} else {
+				// Partial paths may end at different points that are equally close to the target.
+				CHECK(partial);
+				const real_t distance = p_astar.get_point_position(to).distance_to(p_astar.get_point_position(path[path.size() - 1]));
+				const real_t frozen_distance = p_astar.get_point_position(to).distance_to(p_astar.get_point_position(frozen_path[frozen_path.size() - 1]));
+				CHECK(Math::is_equal_approx(frozen_distance, distance));
+			}
+		}
+	}
+}
+
+TEST_CASE("[AStar3D] Frozen graph should find paths of the same cost") {
+	constexpr int N = 300;
+	Math::seed(0);
+
+	AStar3D a;
+	for (int u = 0; u < N; u++) {
+		a.add_point(u, Vector3(Math::rand() % 100, Math::rand() % 100, Math::rand() % 100), 1.0 + Math::rand() % 3);
+	}
+	for (int i = 0; i < N * 3; i++) {
+		const int u = Math::rand() % N;
+		const int v = Math::rand() % N;
+		if (u != v) {
+			a.connect_points(u, v, Math::rand() % 2);
+		}
+	}
+	for (int i = 0; i < N / 10; i++) {
+		a.set_point_disabled(Math::rand() % N);
+	}
+
+	check_frozen_astar_paths(a, N);
+
+	SUBCASE("Point changes are applied while frozen") {
+		a.freeze();
+		a.set_point_disabled(0, false);
+		a.set_point_position(0, Vector3(-1, -1, -1));
+		a.set_point_weight_scale(0, 2.0);
+		check_frozen_astar_paths(a, N);
+	}
+
+	SUBCASE("Connections are kept across freeze and unfreeze") {
+		Vector<Vector<int64_t>> connections;
+		for (int u = 0; u < N; u++) {
+			Vector<int64_t> point_connections = a.get_point_connections(u);
+			point_connections.sort();
+			connections.push_back(point_connections);
+		}
+
+		a.freeze();
+		for (int u = 0; u < N; u++) {
+			Vector<int64_t> point_connections = a.get_point_connections(u);
+			point_connections.sort();
+			CHECK_EQ(point_connections, connections[u]);
+		}
+
+		a.unfreeze();
+		for (int u = 0; u < N; u++) {
+			Vector<int64_t> point_connections = a.get_point_connections(u);
+			point_connections.sort();
+			CHECK_EQ(point_connections, connections[u]);
+		}
+
+		// Removing a point must also drop it from the points that only link to it.
+		a.remove_point(0);
+		for (int u = 1; u < N; u++) {
+			CHECK_FALSE(a.get_point_connections(u).has(0));
+			CHECK_FALSE(a.are_points_connected(u, 0));
+		}
+	}
+
+	SUBCASE("Structural changes are rejected while frozen") {
+		const bool connected = a.are_points_connected(0, 1);
+		a.freeze();
+		ERR_PRINT_OFF;
+		a.add_point(N, Vector3());
+		a.remove_point(0);
+		a.connect_points(0, 1);
+		a.disconnect_points(0, 1);
+		ERR_PRINT_ON;
+		CHECK_FALSE(a.has_point(N));
+		CHECK(a.has_point(0));
+		CHECK_EQ(a.are_points_connected(0, 1), connected);
+
+		a.clear();
+		CHECK_FALSE(a.is_frozen());
+	}
+}
+
+struct FrozenAStarPathsData {
+	AStar3D *astar = nullptr;
+	const int64_t *from_to_ids = nullptr;
+	Vector<int64_t> *paths = nullptr;
+
+	static void solve(void *p_userdata, uint32_t p_index) {
+		FrozenAStarPathsData *data = static_cast<FrozenAStarPathsData *>(p_userdata);
+		data->paths[p_index] = data->astar->get_id_path(data->from_to_ids[p_index * 2 + 0], data->from_to_ids[p_index * 2 + 1]);
+	}
+};
+
+TEST_CASE("[AStar3D] Frozen graph should support concurrent path queries") {
+	constexpr int N = 300;
+	constexpr int PATH_COUNT = 64;
+	Math::seed(1);
+
+	AStar3D a;
+	for (int u = 0; u < N; u++) {
+		a.add_point(u, Vector3(Math::rand() % 100, Math::rand() % 100, Math::rand() % 100));
+	}
+	for (int i = 0; i < N * 3; i++) {
+		const int u = Math::rand() % N;
+		const int v = Math::rand() % N;
+		if (u != v) {
+			a.connect_points(u, v);
+		}
+	}
+	a.freeze();
+
+	int64_t from_to_ids[PATH_COUNT * 2];
+	for (int i = 0; i < PATH_COUNT * 2; i++) {
+		from_to_ids[i] = Math::rand() % N;
+	}
+	Vector<int64_t> paths[PATH_COUNT];
+
+	FrozenAStarPathsData data;
+	data.astar = &a;
+	data.from_to_ids = from_to_ids;
+	data.paths = paths;
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&FrozenAStarPathsData::solve, &data, PATH_COUNT, -1, true, SNAME("FrozenAStarPaths"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	for (int i = 0; i < PATH_COUNT; i++) {
+		CHECK_EQ(paths[i], a.get_id_path(from_to_ids[i * 2 + 0], from_to_ids[i * 2 + 1]));
+	}
+}
+
+TEST_CASE("[AStar2D] Frozen graph should find paths of the same cost") {
+	constexpr int N = 300;
+	Math::seed(2);
+
+	AStar2D a;
+	for (int u = 0; u < N; u++) {
+		a.add_point(u, Vector2(Math::rand() % 100, Math::rand() % 100), 1.0 + Math::rand() % 3);
+	}
+	for (int i = 0; i < N * 3; i++) {
+		const int u = Math::rand() % N;
+		const int v = Math::rand() % N;
+		if (u != v) {
+			a.connect_points(u, v, Math::rand() % 2);
+		}
+	}
+	for (int i = 0; i < N / 10; i++) {
+		a.set_point_disabled(Math::rand() % N);
+	}
+
+	check_frozen_astar_paths(a, N);
+}
+
 } // namespace TestAStar
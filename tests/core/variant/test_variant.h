@@ -125,6 +125,111 @@ TEST_CASE("[Variant] Writer and parser Variant::FLOAT") {
 	CHECK_MESSAGE(float_parsed == 1.0e+100, "Should match the double literal.");
 }
 
+TEST_CASE("[Variant] Parser packed numeric arrays") {
+	String errs;
+	int line = 1;
+	Variant parsed;
+
+	VariantParser::StreamString ss;
+	ss.s = "PackedInt32Array(1, -2, 2147483647,\n\t3 ; comment\n, 4.5, 1e2)";
+	CHECK(VariantParser::parse(&ss, parsed, errs, line) == OK);
+	CHECK(line == 3);
+	REQUIRE(parsed.get_type() == Variant::PACKED_INT32_ARRAY);
+	PackedInt32Array int32_array = parsed;
+	REQUIRE(int32_array.size() == 6);
+	CHECK(int32_array[0] == 1);
+	CHECK(int32_array[1] == -2);
+	CHECK(int32_array[2] == 2147483647);
+	CHECK(int32_array[3] == 3);
+	CHECK(int32_array[4] == 4);
+	CHECK(int32_array[5] == 100);
+
+	VariantParser::StreamString ss64;
+	ss64.s = "PackedInt64Array(-9223372036854775807, 9223372036854775808)";
+	CHECK(VariantParser::parse(&ss64, parsed, errs, line) == OK);
+	PackedInt64Array int64_array = parsed;
+	REQUIRE(int64_array.size() == 2);
+	CHECK(int64_array[0] == -9223372036854775807);
+	CHECK_MESSAGE(int64_array[1] == 9223372036854775807, "The result should be clamped to max value.");
+
+	VariantParser::StreamString ssf;
+	ssf.s = "PackedFloat32Array(0.5, -1.25e-1, inf, inf_neg)";
+	CHECK(VariantParser::parse(&ssf, parsed, errs, line) == OK);
+	PackedFloat32Array float_array = parsed;
+	REQUIRE(float_array.size() == 4);
+	CHECK(float_array[0] == 0.5f);
+	CHECK(float_array[1] == -0.125f);
+	CHECK(float_array[2] == Math::INF);
+	CHECK(float_array[3] == -Math::INF);
+
+	VariantParser::StreamString ssb;
+	ssb.s = "PackedByteArray( 0, 127, 255 )";
+	CHECK(VariantParser::parse(&ssb, parsed, errs, line) == OK);
+	PackedByteArray byte_array = parsed;
+	REQUIRE(byte_array.size() == 3);
+	CHECK(byte_array[0] == 0);
+	CHECK(byte_array[1] == 127);
+	CHECK(byte_array[2] == 255);
+
+	VariantParser::StreamString ssb64;
+	ssb64.s = "PackedByteArray(\"AH//\")";
+	CHECK(VariantParser::parse(&ssb64, parsed, errs, line) == OK);
+	CHECK(PackedByteArray(parsed) == byte_array);
+
+	VariantParser::StreamString ss_empty;
+	ss_empty.s = "PackedInt32Array()";
+	CHECK(VariantParser::parse(&ss_empty, parsed, errs, line) == OK);
+	CHECK(PackedInt32Array(parsed).is_empty());
+
+	// Values in a Dictionary keep parsing after the array.
+	VariantParser::StreamString ss_dict;
+	ss_dict.s = "{\"a\": PackedInt32Array(1, 2), \"b\": 3}";
+	CHECK(VariantParser::parse(&ss_dict, parsed, errs, line) == OK);
+	Dictionary dict = parsed;
+	CHECK(PackedInt32Array(dict["a"]).size() == 2);
+	CHECK(int(dict["b"]) == 3);
+
+	VariantParser::StreamString ss_trailing;
+	ss_trailing.s = "PackedInt32Array(1, 2,)";
+	CHECK(VariantParser::parse(&ss_trailing, parsed, errs, line) == ERR_PARSE_ERROR);
+
+	VariantParser::StreamString ss_invalid;
+	ss_invalid.s = "PackedInt32Array(1 2)";
+	CHECK(VariantParser::parse(&ss_invalid, parsed, errs, line) == ERR_PARSE_ERROR);
+
+	VariantParser::StreamString ss_unterminated;
+	ss_unterminated.s = "PackedFloat64Array(1.0, 2.0";
+	CHECK(VariantParser::parse(&ss_unterminated, parsed, errs, line) == ERR_PARSE_ERROR);
+}
+
+TEST_CASE("[Variant] Writer and parser infinite components") {
+	const Vector3 vector = Vector3(-Math::INF, 0, Math::INF);
+	String written;
+	VariantWriter::write_to_string(vector, written);
+	CHECK(written == "Vector3(-inf, 0, inf)");
+
+	VariantParser::StreamString ss;
+	ss.s = written;
+	String errs;
+	int line = 1;
+	Variant parsed;
+	REQUIRE(VariantParser::parse(&ss, parsed, errs, line) == OK);
+	REQUIRE(parsed.get_type() == Variant::VECTOR3);
+	const Vector3 parsed_vector = parsed;
+	CHECK(parsed_vector.x == -Math::INF);
+	CHECK(parsed_vector.y == 0);
+	CHECK(parsed_vector.z == Math::INF);
+
+	VariantParser::StreamString ss_array;
+	ss_array.s = "PackedFloat64Array(-inf, 1, -nan)";
+	REQUIRE(VariantParser::parse(&ss_array, parsed, errs, line) == OK);
+	const PackedFloat64Array parsed_array = parsed;
+	REQUIRE(parsed_array.size() == 3);
+	CHECK(parsed_array[0] == -Math::INF);
+	CHECK(parsed_array[1] == 1);
+	CHECK(Math::is_nan(parsed_array[2]));
+}
+
 TEST_CASE("[Variant] Assignment To Bool from Int,Float,String,Vec2,Vec2i,Vec3,Vec3i,Vec4,Vec4i,Rect2,Rect2i,Trans2d,Trans3d,Color,Call,Plane,Basis,AABB,Quant,Proj,RID,and Object") {
 	Variant int_v = 0;
 	Variant bool_v = true;
@@ -916,4 +916,240 @@ TEST_CASE("[SceneTree][Node] Test the process priority") {
 	memdelete(node4);
 }
 
+class SiblingAddingNode : public Node {
+	GDCLASS(SiblingAddingNode, Node);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_READY) {
+			get_parent()->add_child(memnew(Node));
+		}
+	}
+};
+
+TEST_CASE("[SceneTree][Node] Bulk added children can add siblings when ready") {
+	GDREGISTER_CLASS(SiblingAddingNode);
+	Node *parent = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	TypedArray<Node> children;
+	children.push_back(memnew(SiblingAddingNode));
+	children.push_back(memnew(SiblingAddingNode));
+	parent->add_children_bulk(children);
+
+	CHECK_EQ(parent->get_child_count(), 4);
+	for (int i = 0; i < parent->get_child_count(); i++) {
+		CHECK(parent->get_child(i)->is_ready());
+	}
+
+	memdelete(parent);
+}
+
+class SignalOrderRecorder : public Object {
+	GDCLASS(SignalOrderRecorder, Object);
+
+public:
+	Vector<String> events;
+
+	void on_node_added(Node *p_node) { events.push_back("node_added " + p_node->get_name()); }
+	void on_child_entered_tree(Node *p_node) { events.push_back("child_entered_tree " + p_node->get_name()); }
+	void on_ready(const String &p_name) { events.push_back("ready " + p_name); }
+
+	Vector<String> get_events(const String &p_kind) const {
+		Vector<String> ret;
+		for (const String &event : events) {
+			if (event.begins_with(p_kind + " ")) {
+				ret.push_back(event);
+			}
+		}
+		return ret;
+	}
+};
+
+static SignalOrderRecorder *record_child_signals(bool p_bulk) {
+	SceneTree *tree = SceneTree::get_singleton();
+	Node *parent = memnew(Node);
+	tree->get_root()->add_child(parent);
+
+	SignalOrderRecorder *recorder = memnew(SignalOrderRecorder);
+	tree->connect("node_added", callable_mp(recorder, &SignalOrderRecorder::on_node_added));
+	parent->connect("child_entered_tree", callable_mp(recorder, &SignalOrderRecorder::on_child_entered_tree));
+
+	TypedArray<Node> children;
+	for (int i = 0; i < 4; i++) {
+		Node *child = memnew(Node);
+		child->set_name(vformat("Child%d", i));
+		child->add_to_group("signal_order_test");
+		child->connect(SceneStringName(ready), callable_mp(recorder, &SignalOrderRecorder::on_ready).bind(child->get_name()));
+		children.push_back(child);
+	}
+
+	if (p_bulk) {
+		parent->add_children_bulk(children);
+	} else {
+		for (int i = 0; i < children.size(); i++) {
+			parent->add_child(Object::cast_to<Node>(children[i]));
+		}
+	}
+	CHECK_EQ(tree->get_node_count_in_group("signal_order_test"), 4);
+
+	tree->disconnect("node_added", callable_mp(recorder, &SignalOrderRecorder::on_node_added));
+	memdelete(parent);
+	return recorder;
+}
+
+TEST_CASE("[SceneTree][Node] Bulk added children signal in the same order as an add_child() loop") {
+	SignalOrderRecorder *looped = record_child_signals(false);
+	SignalOrderRecorder *bulk = record_child_signals(true);
+
+	REQUIRE_EQ(bulk->events.size(), looped->events.size());
+	CHECK_EQ(bulk->get_events("node_added"), looped->get_events("node_added"));
+	CHECK_EQ(bulk->get_events("child_entered_tree"), looped->get_events("child_entered_tree"));
+	CHECK_EQ(bulk->get_events("ready"), looped->get_events("ready"));
+
+	// Unlike the loop, every child enters the tree before the first one is ready.
+	CHECK_EQ(looped->events[2], "ready Child0");
+	CHECK_EQ(bulk->events[8], "ready Child0");
+
+	memdelete(looped);
+	memdelete(bulk);
+}
+
+TEST_CASE("[SceneTree][Node] Bulk add and remove children") {
+	Node *parent = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	TypedArray<Node> children;
+	for (int i = 0; i < 8; i++) {
+		children.push_back(memnew(Node));
+	}
+
+	SIGNAL_WATCH(parent, "child_order_changed");
+	SIGNAL_WATCH(SceneTree::get_singleton(), "tree_changed");
+
+	parent->add_children_bulk(children);
+
+	Array empty_signal_args = { {} };
+	SIGNAL_CHECK("child_order_changed", empty_signal_args);
+	SIGNAL_CHECK("tree_changed", empty_signal_args);
+
+	CHECK_EQ(parent->get_child_count(), 8);
+	CHECK_EQ(SceneTree::get_singleton()->get_node_count(), 10);
+	HashSet<StringName> names;
+	for (int i = 0; i < 8; i++) {
+		Node *child = Object::cast_to<Node>(children[i]);
+		CHECK_EQ(parent->get_child(i), child);
+		CHECK_EQ(child->get_index(), i);
+		CHECK(child->is_inside_tree());
+		CHECK(child->is_ready());
+		names.insert(child->get_name());
+	}
+	CHECK_EQ(names.size(), 8);
+
+	SUBCASE("Removing a subset keeps the remaining children in order") {
+		TypedArray<Node> to_remove;
+		for (int i = 0; i < 8; i += 2) {
+			to_remove.push_back(children[i]);
+		}
+
+		parent->remove_children_bulk(to_remove);
+
+		SIGNAL_CHECK("child_order_changed", empty_signal_args);
+		SIGNAL_CHECK("tree_changed", empty_signal_args);
+
+		CHECK_EQ(parent->get_child_count(), 4);
+		CHECK_EQ(SceneTree::get_singleton()->get_node_count(), 6);
+		for (int i = 0; i < 4; i++) {
+			CHECK_EQ(parent->get_child(i), Object::cast_to<Node>(children[i * 2 + 1]));
+		}
+		for (int i = 0; i < to_remove.size(); i++) {
+			Node *removed = Object::cast_to<Node>(to_remove[i]);
+			CHECK_EQ(removed->get_parent(), nullptr);
+			CHECK_FALSE(removed->is_inside_tree());
+			memdelete(removed);
+		}
+	}
+
+	SUBCASE("Removed children can be added back in bulk") {
+		parent->remove_children_bulk(children);
+		SIGNAL_DISCARD("child_order_changed");
+		SIGNAL_DISCARD("tree_changed");
+		CHECK_EQ(parent->get_child_count(), 0);
+
+		parent->add_children_bulk(children);
+		CHECK_EQ(parent->get_child_count(), 8);
+		for (int i = 0; i < 8; i++) {
+			CHECK_EQ(parent->get_child(i), Object::cast_to<Node>(children[i]));
+			CHECK(Object::cast_to<Node>(children[i])->is_inside_tree());
+		}
+	}
+
+	SUBCASE("Invalid entries are skipped") {
+		Node *other_parent = memnew(Node);
+		Node *foreign = memnew(Node);
+		other_parent->add_child(foreign);
+
+		TypedArray<Node> mixed;
+		mixed.push_back(foreign);
+		mixed.push_back(memnew(Node));
+
+		ERR_PRINT_OFF;
+		parent->add_children_bulk(mixed);
+		ERR_PRINT_ON;
+
+		CHECK_EQ(parent->get_child_count(), 9);
+		CHECK_EQ(foreign->get_parent(), other_parent);
+		memdelete(other_parent);
+	}
+
+	SIGNAL_UNWATCH(parent, "child_order_changed");
+	SIGNAL_UNWATCH(SceneTree::get_singleton(), "tree_changed");
+
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][Node] Sub-thread process groups are scheduled") {
+	LocalVector<TestNode *> nodes;
+	for (int i = 0; i < 4; i++) {
+		TestNode *node = memnew(TestNode);
+		node->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+		node->set_process(true);
+		node->set_physics_process(true);
+		SceneTree::get_singleton()->get_root()->add_child(node);
+		nodes.push_back(node);
+	}
+
+	for (int i = 0; i < 3; i++) {
+		SceneTree::get_singleton()->process(0);
+		SceneTree::get_singleton()->physics_process(0);
+	}
+
+	for (TestNode *node : nodes) {
+		CHECK_EQ(node->process_counter, 3);
+		CHECK_EQ(node->physics_process_counter, 3);
+	}
+
+	TypedArray<Dictionary> schedule = SceneTree::get_singleton()->get_process_group_schedule();
+	int threaded_groups = 0;
+	for (int i = 0; i < schedule.size(); i++) {
+		Dictionary group = schedule[i];
+		if (!group["threaded"]) {
+			continue;
+		}
+		threaded_groups++;
+		Node *owner = SceneTree::get_singleton()->get_root()->get_node_or_null(group["owner"]);
+		CHECK(nodes.has(Object::cast_to<TestNode>(owner)));
+		// Cheap groups are batched, but still dispatched to a worker thread.
+		CHECK((int)group["process_tasks"] >= 1);
+		CHECK((int)group["physics_process_tasks"] >= 1);
+		CHECK((int)group["process_tasks"] <= nodes.size());
+		CHECK((int)group["physics_process_tasks"] <= nodes.size());
+	}
+	CHECK_EQ(threaded_groups, 4);
+
+	for (TestNode *node : nodes) {
+		memdelete(node);
+	}
+}
+
 } // namespace TestNode
@@ -210,4 +210,36 @@ TEST_CASE("[SceneTree][Node2D] Utility methods") {
 	memdelete(test_node1);
 }
 
+TEST_CASE("[SceneTree][Node2D] Spatially indexed group queries") {
+	SceneTree *tree = SceneTree::get_singleton();
+	const StringName group = "spatial_test_2d";
+	tree->enable_group_spatial_index(group, 32);
+
+	Node2D *parent = memnew(Node2D);
+	Node2D *near = memnew(Node2D);
+	Node2D *far = memnew(Node2D);
+	near->set_position(Vector2(10, 10));
+	far->set_position(Vector2(200, 0));
+	near->add_to_group(group);
+	far->add_to_group(group);
+	parent->add_child(near);
+	parent->add_child(far);
+	tree->get_root()->add_child(parent);
+
+	TypedArray<Node> found = tree->get_nodes_in_group_in_radius_2d(group, Vector2(), 20);
+	REQUIRE_EQ(found.size(), 1);
+	CHECK_EQ(Object::cast_to<Node>(found[0]), near);
+	CHECK_EQ(tree->get_nodes_in_group_in_rect(group, Rect2(0, -10, 300, 30)).size(), 2);
+	// 3D queries ignore 2D members.
+	CHECK(tree->get_nodes_in_group_in_radius(group, Vector3(), 1000).is_empty());
+
+	parent->set_position(Vector2(-200, 0));
+	found = tree->get_nodes_in_group_in_radius_2d(group, Vector2(), 20);
+	REQUIRE_EQ(found.size(), 1);
+	CHECK_EQ(Object::cast_to<Node>(found[0]), far);
+
+	tree->disable_group_spatial_index(group);
+	memdelete(parent);
+}
+
 } // namespace TestNode2D
@@ -0,0 +1,231 @@
+/**************************************************************************/
+/*  test_node_3d.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode3D {
+
+class TransformNotifiedNode3D : public Node3D {
+	GDCLASS(TransformNotifiedNode3D, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			transform_changed_count++;
+		}
+	}
+
+public:
+	int transform_changed_count = 0;
+
+	void ignore_transform_notification(bool p_ignore) { set_ignore_transform_notification(p_ignore); }
+
+	TransformNotifiedNode3D() {
+		set_notify_transform(true);
+	}
+};
+
+TEST_CASE("[SceneTree][Node3D] Transform propagation") {
+	Node3D *root = memnew(Node3D);
+	Node3D *middle = memnew(Node3D);
+	TransformNotifiedNode3D *leaf = memnew(TransformNotifiedNode3D);
+	root->add_child(middle);
+	middle->add_child(leaf);
+	middle->set_position(Vector3(0, 1, 0));
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	SceneTree::get_singleton()->flush_transform_notifications();
+	leaf->transform_changed_count = 0;
+
+	SUBCASE("[Node3D] Repeated changes before a flush notify once") {
+		root->set_position(Vector3(1, 0, 0));
+		root->set_rotation(Vector3(0, Math::PI, 0));
+		root->set_position(Vector3(2, 0, 0));
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(2, 1, 0)));
+
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK_EQ(leaf->transform_changed_count, 1);
+	}
+
+	SUBCASE("[Node3D] Changes after reading the global transform are propagated") {
+		root->set_position(Vector3(1, 0, 0));
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(1, 1, 0)));
+		root->set_position(Vector3(3, 0, 0));
+		CHECK(middle->get_global_position().is_equal_approx(Vector3(3, 1, 0)));
+		root->set_position(Vector3(4, 0, 0));
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(4, 1, 0)));
+	}
+
+	SUBCASE("[Node3D] Notifications are sent again after a flush") {
+		// The leaf doesn't read its global transform, so it stays dirty between flushes.
+		root->set_position(Vector3(1, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		root->set_position(Vector3(2, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK_EQ(leaf->transform_changed_count, 2);
+	}
+
+	SUBCASE("[Node3D] Nodes enabling notifications in a dirty subtree are notified") {
+		root->set_position(Vector3(1, 0, 0));
+
+		TransformNotifiedNode3D *late = memnew(TransformNotifiedNode3D);
+		late->set_notify_transform(false);
+		middle->add_child(late);
+		late->set_notify_transform(true);
+
+		root->set_position(Vector3(2, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK_EQ(late->transform_changed_count, 1);
+		CHECK(late->get_global_position().is_equal_approx(Vector3(2, 1, 0)));
+	}
+
+	SUBCASE("[Node3D] Nodes no longer ignoring notifications in a dirty subtree are notified") {
+		leaf->ignore_transform_notification(true);
+		root->set_position(Vector3(1, 0, 0));
+		leaf->ignore_transform_notification(false);
+
+		root->set_position(Vector3(2, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK_EQ(leaf->transform_changed_count, 1);
+	}
+
+	memdelete(root);
+}
+
+TEST_CASE("[SceneTree][Node3D] Spatially indexed group queries") {
+	SceneTree *tree = SceneTree::get_singleton();
+	Node3D *root = memnew(Node3D);
+	tree->get_root()->add_child(root);
+
+	const StringName group = "spatial_test";
+	LocalVector<Node3D *> nodes;
+	for (int i = 0; i < 100; i++) {
+		Node3D *node = memnew(Node3D);
+		node->set_position(Vector3(i % 10, 0, i / 10) * 10);
+		node->add_to_group(group);
+		root->add_child(node);
+		nodes.push_back(node);
+	}
+
+	SUBCASE("[Node3D] Indexed queries match unindexed ones") {
+		const TypedArray<Node> unindexed_radius = tree->get_nodes_in_group_in_radius(group, Vector3(45, 0, 45), 12);
+		const TypedArray<Node> unindexed_aabb = tree->get_nodes_in_group_in_aabb(group, AABB(Vector3(0, -1, 0), Vector3(20, 2, 20)));
+		CHECK_EQ(unindexed_radius.size(), 4);
+		CHECK_EQ(unindexed_aabb.size(), 9);
+
+		tree->enable_group_spatial_index(group, 16);
+		CHECK(tree->has_group_spatial_index(group));
+		const TypedArray<Node> indexed_radius = tree->get_nodes_in_group_in_radius(group, Vector3(45, 0, 45), 12);
+		const TypedArray<Node> indexed_aabb = tree->get_nodes_in_group_in_aabb(group, AABB(Vector3(0, -1, 0), Vector3(20, 2, 20)));
+		CHECK_EQ(indexed_radius.size(), 4);
+		CHECK_EQ(indexed_aabb.size(), 9);
+		for (int i = 0; i < indexed_radius.size(); i++) {
+			CHECK(unindexed_radius.has(indexed_radius[i]));
+		}
+		for (int i = 0; i < indexed_aabb.size(); i++) {
+			CHECK(unindexed_aabb.has(indexed_aabb[i]));
+		}
+
+		// A query larger than the populated area scans all members.
+		CHECK_EQ(tree->get_nodes_in_group_in_radius(group, Vector3(), 10000).size(), 100);
+		// 2D queries ignore 3D members.
+		CHECK(tree->get_nodes_in_group_in_rect(group, Rect2(-1000, -1000, 2000, 2000)).is_empty());
+	}
+
+	SUBCASE("[Node3D] The index follows moving members") {
+		tree->enable_group_spatial_index(group, 16);
+		CHECK_EQ(tree->get_nodes_in_group_in_radius(group, Vector3(500, 0, 500), 1).size(), 0);
+
+		// Moving the parent moves every member.
+		root->set_position(Vector3(500, 0, 500));
+		const TypedArray<Node> moved = tree->get_nodes_in_group_in_radius(group, Vector3(500, 0, 500), 1);
+		REQUIRE_EQ(moved.size(), 1);
+		CHECK_EQ(Object::cast_to<Node>(moved[0]), nodes[0]);
+
+		nodes[0]->set_position(Vector3(0, 100, 0));
+		CHECK(tree->get_nodes_in_group_in_radius(group, Vector3(500, 0, 500), 1).is_empty());
+		CHECK_EQ(tree->get_nodes_in_group_in_radius(group, Vector3(500, 100, 500), 1).size(), 1);
+	}
+
+	SUBCASE("[Node3D] Members moving between cells match unindexed queries") {
+		tree->enable_group_spatial_index(group, 16);
+		for (int step = 0; step < 3; step++) {
+			for (uint32_t i = 0; i < nodes.size(); i += 3) {
+				nodes[i]->set_position(nodes[i]->get_position() + Vector3(7, 0, -11) * (step + 1));
+			}
+			const TypedArray<Node> indexed = tree->get_nodes_in_group_in_aabb(group, AABB(Vector3(10, -1, 10), Vector3(50, 2, 40)));
+			tree->disable_group_spatial_index(group);
+			const TypedArray<Node> unindexed = tree->get_nodes_in_group_in_aabb(group, AABB(Vector3(10, -1, 10), Vector3(50, 2, 40)));
+			tree->enable_group_spatial_index(group, 16);
+			CHECK_EQ(indexed.size(), unindexed.size());
+			for (int i = 0; i < indexed.size(); i++) {
+				CHECK(unindexed.has(indexed[i]));
+			}
+		}
+	}
+
+	SUBCASE("[Node3D] Huge and non-finite positions and extents") {
+		tree->enable_group_spatial_index(group, 16);
+		nodes[0]->set_position(Vector3(1e30, 0, -1e30));
+		nodes[1]->set_position(Vector3(Math::INF, 0, 0));
+		nodes[2]->set_position(Vector3(Math::NaN, 0, 0));
+		CHECK_EQ(tree->get_nodes_in_group_in_radius(group, Vector3(1e30, 0, -1e30), 1).size(), 1);
+		CHECK_EQ(tree->get_nodes_in_group_in_aabb(group, AABB(Vector3(1e29, -1, -1e31), Vector3(1e31, 2, 1e31))).size(), 1);
+		CHECK(tree->get_nodes_in_group_in_radius(group, Vector3(), 1).is_empty());
+		// Non-finite members never match finite areas.
+		CHECK_EQ(tree->get_nodes_in_group_in_aabb(group, AABB(Vector3(-1e31, -1e31, -1e31), Vector3(2e31, 2e31, 2e31))).size(), 98);
+	}
+
+	SUBCASE("[Node3D] The index follows group membership") {
+		tree->enable_group_spatial_index(group, 16);
+		CHECK_EQ(tree->get_nodes_in_group_in_radius(group, Vector3(), 1).size(), 1);
+
+		nodes[0]->remove_from_group(group);
+		CHECK(tree->get_nodes_in_group_in_radius(group, Vector3(), 1).is_empty());
+
+		root->remove_child(nodes[1]);
+		CHECK(tree->get_nodes_in_group_in_radius(group, Vector3(10, 0, 0), 1).is_empty());
+		root->add_child(nodes[1]);
+		CHECK_EQ(tree->get_nodes_in_group_in_radius(group, Vector3(10, 0, 0), 1).size(), 1);
+
+		tree->disable_group_spatial_index(group);
+		CHECK_FALSE(tree->has_group_spatial_index(group));
+		CHECK_EQ(tree->get_nodes_in_group_in_radius(group, Vector3(10, 0, 0), 1).size(), 1);
+	}
+
+	tree->disable_group_spatial_index(group);
+	memdelete(root);
+}
+
+} // namespace TestNode3D
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "scene/2d/node_2d.h"
 #include "scene/resources/packed_scene.h"
 
 #include "tests/test_macros.h"
@@ -280,4 +281,148 @@ TEST_CASE("[PackedScene] Recreate State") {
 	memdelete(scene);
 }
 
+TEST_CASE("[PackedScene] Instantiate Packed Scene With Properties Multiple Times") {
+	// Create a scene to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_position(Vector2(1, 2));
+	child->set_rotation(0.5);
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	// Pack the scene.
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	// Instantiate twice, the second instantiation reuses the cached plan.
+	for (int i = 0; i < 2; i++) {
+		Node *instance = packed_scene.instantiate();
+		CHECK(instance != nullptr);
+		Node2D *instance_child = Object::cast_to<Node2D>(instance->get_node(NodePath("Child")));
+		REQUIRE(instance_child != nullptr);
+		CHECK(instance_child->get_position().is_equal_approx(Vector2(1, 2)));
+		CHECK(Math::is_equal_approx(instance_child->get_rotation(), (real_t)0.5));
+		memdelete(instance);
+	}
+
+	// Modifying the scene and repacking invalidates the plan.
+	child->set_position(Vector2(3, 4));
+	packed_scene.pack(scene);
+
+	Node *instance = packed_scene.instantiate();
+	Node2D *instance_child = Object::cast_to<Node2D>(instance->get_node(NodePath("Child")));
+	REQUIRE(instance_child != nullptr);
+	CHECK(instance_child->get_position().is_equal_approx(Vector2(3, 4)));
+
+	memdelete(instance);
+	memdelete(scene);
+}
+
+TEST_CASE("[PackedScene] Instantiate Scene State With Deferred Node Path") {
+	// Build the state by hand, so the deferred property refers to a sibling node.
+	Ref<SceneState> state;
+	state.instantiate();
+	int root = state->add_node(-1, -1, state->add_name("Node"), state->add_name("Root"), -1, -1);
+	int child = state->add_node(root, root, state->add_name("Node"), state->add_name("Child"), -1, -1);
+	state->add_node(root, root, state->add_name("Node"), state->add_name("Target"), -1, -1);
+	state->add_node_property(child, state->add_name("metadata/target"), state->add_value(NodePath("../Target")), true);
+
+	PackedScene packed_scene;
+	packed_scene.replace_state(state);
+
+	for (int i = 0; i < 2; i++) {
+		Node *instance = packed_scene.instantiate();
+		REQUIRE(instance != nullptr);
+		Node *instance_child = instance->get_node(NodePath("Child"));
+		Node *instance_target = instance->get_node(NodePath("Target"));
+		CHECK(Object::cast_to<Node>(instance_child->get_meta("target")) == instance_target);
+		memdelete(instance);
+	}
+}
+
+TEST_CASE("[PackedScene] Instance Pool") {
+	// Create a scene to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_position(Vector2(1, 2));
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	// Pack the scene.
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	// An empty pool instantiates the scene.
+	Node *instance = packed_scene.instantiate_pooled();
+	REQUIRE(instance != nullptr);
+	CHECK(packed_scene.get_pool_miss_count() == 1);
+	CHECK(packed_scene.get_pool_hit_count() == 0);
+
+	Node2D *instance_child = Object::cast_to<Node2D>(instance->get_node(NodePath("Child")));
+	REQUIRE(instance_child != nullptr);
+	instance_child->set_position(Vector2(5, 6));
+	instance_child->set_visible(false);
+
+	packed_scene.release_instance(instance);
+	CHECK(packed_scene.get_pool_size() == 1);
+
+	// The released instance is reused with its properties reset.
+	Node *reused = packed_scene.instantiate_pooled();
+	CHECK(reused == instance);
+	CHECK(packed_scene.get_pool_hit_count() == 1);
+	CHECK(packed_scene.get_pool_size() == 0);
+	CHECK(instance_child->get_position().is_equal_approx(Vector2(1, 2)));
+	CHECK(instance_child->is_visible());
+
+	// Instances with a different structure are not reused.
+	reused->add_child(memnew(Node));
+	packed_scene.release_instance(reused);
+	Node *fresh = packed_scene.instantiate_pooled();
+	REQUIRE(fresh != nullptr);
+	CHECK(packed_scene.get_pool_miss_count() == 2);
+	CHECK(fresh->get_child_count() == 1);
+
+	// Without capacity, released instances are freed.
+	packed_scene.set_pool_capacity(0);
+	packed_scene.release_instance(fresh);
+	CHECK(packed_scene.get_pool_size() == 0);
+
+	memdelete(scene);
+}
+
+TEST_CASE("[PackedScene] Instance Pool resets containers edited in place") {
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	Array items = { 1, 2 };
+	scene->set_meta("items", items);
+
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	Node *instance = packed_scene.instantiate_pooled();
+	REQUIRE(instance != nullptr);
+	packed_scene.release_instance(instance);
+
+	for (int i = 0; i < 3; i++) {
+		Node *reused = packed_scene.instantiate_pooled();
+		CHECK(reused == instance);
+
+		// Arrays are shared by reference, like an exported script variable edited in place.
+		Array reused_items = reused->get_meta("items");
+		CHECK_MESSAGE(reused_items == Array({ 1, 2 }), "A reused instance should get the original array contents.");
+		reused_items.push_back(3);
+
+		packed_scene.release_instance(reused);
+	}
+
+	packed_scene.clear_pool();
+	memdelete(scene);
+}
+
 } // namespace TestPackedScene
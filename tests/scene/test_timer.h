@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include "core/math/random_number_generator.h"
+#include "scene/main/scene_tree.h"
 #include "scene/main/timer.h"
 
 #include "tests/test_macros.h"
@@ -203,4 +205,116 @@ TEST_CASE("[SceneTree][Timer] Check Timer timeout signal") {
 	memdelete(test_timer);
 }
 
+class TimeoutRecorder : public Object {
+	GDCLASS(TimeoutRecorder, Object);
+
+public:
+	LocalVector<int> timeouts;
+
+	void on_timeout(int p_id) {
+		timeouts.push_back(p_id);
+	}
+};
+
+static Ref<SceneTreeTimer> create_recorded_timer(TimeoutRecorder *p_recorder, int p_id, double p_delay, bool p_process_always = true, bool p_process_in_physics = false) {
+	Ref<SceneTreeTimer> timer = SceneTree::get_singleton()->create_timer(p_delay, p_process_always, p_process_in_physics);
+	timer->connect("timeout", callable_mp(p_recorder, &TimeoutRecorder::on_timeout).bind(p_id));
+	return timer;
+}
+
+TEST_CASE("[SceneTree][SceneTreeTimer] Timers time out once their delay has elapsed") {
+	TimeoutRecorder *recorder = memnew(TimeoutRecorder);
+
+	SUBCASE("Timers expiring on the same frame time out in creation order") {
+		Ref<SceneTreeTimer> timer_a = create_recorded_timer(recorder, 0, 0.3);
+		Ref<SceneTreeTimer> timer_b = create_recorded_timer(recorder, 1, 0.1);
+		Ref<SceneTreeTimer> timer_c = create_recorded_timer(recorder, 2, 0.2);
+
+		SceneTree::get_singleton()->process(0.15);
+		REQUIRE_EQ(recorder->timeouts.size(), 1u);
+		CHECK_EQ(recorder->timeouts[0], 1);
+		CHECK(Math::is_equal_approx(timer_a->get_time_left(), 0.15));
+		CHECK(Math::is_equal_approx(timer_c->get_time_left(), 0.05));
+		CHECK_EQ(timer_b->get_time_left(), 0.0);
+
+		SceneTree::get_singleton()->process(0.2);
+		REQUIRE_EQ(recorder->timeouts.size(), 3u);
+		CHECK_EQ(recorder->timeouts[1], 0);
+		CHECK_EQ(recorder->timeouts[2], 2);
+	}
+
+	SUBCASE("Changing the time left reschedules the timer") {
+		Ref<SceneTreeTimer> timer = create_recorded_timer(recorder, 0, 1.0);
+
+		SceneTree::get_singleton()->process(0.5);
+		CHECK(recorder->timeouts.is_empty());
+		CHECK(Math::is_equal_approx(timer->get_time_left(), 0.5));
+
+		timer->set_time_left(0.1);
+		SceneTree::get_singleton()->process(0.05);
+		CHECK(recorder->timeouts.is_empty());
+		CHECK(Math::is_equal_approx(timer->get_time_left(), 0.05));
+
+		timer->set_time_left(2.0);
+		SceneTree::get_singleton()->process(0.1);
+		CHECK(recorder->timeouts.is_empty());
+
+		timer->set_time_left(0.0);
+		SceneTree::get_singleton()->process(0.01);
+		CHECK_EQ(recorder->timeouts.size(), 1u);
+	}
+
+	SUBCASE("Physics timers only advance on physics frames") {
+		Ref<SceneTreeTimer> timer = create_recorded_timer(recorder, 0, 0.1, true, true);
+
+		SceneTree::get_singleton()->process(0.2);
+		CHECK(recorder->timeouts.is_empty());
+		CHECK(Math::is_equal_approx(timer->get_time_left(), 0.1));
+
+		timer->set_process_in_physics(false);
+		SceneTree::get_singleton()->process(0.2);
+		CHECK_EQ(recorder->timeouts.size(), 1u);
+	}
+
+	SUBCASE("Timers not processing always are paused with the tree") {
+		Ref<SceneTreeTimer> pausable = create_recorded_timer(recorder, 0, 0.1, false);
+		Ref<SceneTreeTimer> always = create_recorded_timer(recorder, 1, 0.1, true);
+
+		SceneTree::get_singleton()->set_pause(true);
+		SceneTree::get_singleton()->process(0.2);
+		SceneTree::get_singleton()->set_pause(false);
+
+		REQUIRE_EQ(recorder->timeouts.size(), 1u);
+		CHECK_EQ(recorder->timeouts[0], 1);
+		CHECK(Math::is_equal_approx(pausable->get_time_left(), 0.1));
+
+		SceneTree::get_singleton()->process(0.2);
+		CHECK_EQ(recorder->timeouts.size(), 2u);
+	}
+
+	SUBCASE("Many timers all time out exactly once") {
+		Ref<RandomNumberGenerator> rng;
+		rng.instantiate();
+		rng->set_seed(42);
+
+		const int timer_count = 10000;
+		for (int i = 0; i < timer_count; i++) {
+			create_recorded_timer(recorder, i, rng->randf_range(0.0, 2.0));
+		}
+
+		for (int frame = 0; frame < 40; frame++) {
+			SceneTree::get_singleton()->process(0.1);
+		}
+
+		REQUIRE_EQ(recorder->timeouts.size(), (uint32_t)timer_count);
+		HashSet<int> ids;
+		for (int id : recorder->timeouts) {
+			ids.insert(id);
+		}
+		CHECK_EQ(ids.size(), (uint32_t)timer_count);
+	}
+
+	memdelete(recorder);
+}
+
 } // namespace TestTimer
@@ -744,6 +744,68 @@ TEST_SUITE("[Navigation2D]") {
 			CHECK_EQ(query_result->get_path_owner_ids().size(), 0);
 		}
 
+		SUBCASE("Batched queries should yield the same paths as single queries") {
+			Ref<NavigationPathQueryParameters2D> query_parameters;
+			query_parameters.instantiate();
+			query_parameters->set_map(map);
+			const PackedVector2Array start_target_positions = { Vector2(-500, -500), Vector2(500, 500), Vector2(300, -300), Vector2(-300, 300), Vector2(10, 10), Vector2(0, 0) };
+
+			const Dictionary batch_result = navigation_server->query_path_batch(query_parameters, start_target_positions);
+			const PackedVector2Array path_points = batch_result["path_points"];
+			const PackedInt32Array path_offsets = batch_result["path_offsets"];
+			REQUIRE_EQ(path_offsets.size(), 4);
+			CHECK_EQ(path_offsets[0], 0);
+			CHECK_EQ(path_offsets[3], path_points.size());
+
+			Ref<NavigationPathQueryResult2D> query_result;
+			query_result.instantiate();
+			for (int i = 0; i < 3; i++) {
+				query_parameters->set_start_position(start_target_positions[i * 2 + 0]);
+				query_parameters->set_target_position(start_target_positions[i * 2 + 1]);
+				navigation_server->query_path(query_parameters, query_result);
+				const Vector<Vector2> path = query_result->get_path();
+				CHECK_NE(path.size(), 0);
+				REQUIRE_EQ(path_offsets[i + 1] - path_offsets[i], path.size());
+				for (int j = 0; j < path.size(); j++) {
+					CHECK(path_points[path_offsets[i] + j].is_equal_approx(path[j]));
+				}
+			}
+		}
+
+		SUBCASE("Following flow directions should reach the target about as fast as following the path") {
+			const Vector2 target_position = Vector2(500, 500);
+			const PackedVector2Array start_positions = { Vector2(-500, -500), Vector2(500, -500), Vector2(-500, 0), Vector2(0, 500) };
+
+			for (const Vector2 &start_position : start_positions) {
+				const Vector<Vector2> path = navigation_server->map_get_path(map, start_position, target_position, true);
+				REQUIRE_NE(path.size(), 0);
+				real_t path_length = 0.0;
+				for (int i = 1; i < path.size(); i++) {
+					path_length += path[i - 1].distance_to(path[i]);
+				}
+
+				Vector2 position = start_position;
+				real_t traveled_length = 0.0;
+				for (int step = 0; step < 1000 && position.distance_to(target_position) > 1.0; step++) {
+					const PackedVector2Array directions = navigation_server->map_get_flow_directions(map, target_position, { position });
+					REQUIRE_EQ(directions.size(), 1);
+					REQUIRE_NE(directions[0], Vector2());
+					const real_t step_length = MIN(real_t(10.0), position.distance_to(target_position));
+					position += directions[0] * step_length;
+					traveled_length += step_length;
+				}
+				CHECK(position.distance_to(target_position) <= 1.0);
+				CHECK(traveled_length <= path_length * 1.5 + 10.0);
+			}
+
+			// Positions and targets on polygons without a matching navigation layer can not be reached.
+			const PackedVector2Array directions = navigation_server->map_get_flow_directions(map, target_position, start_positions, 2);
+			REQUIRE_EQ(directions.size(), start_positions.size());
+			for (const Vector2 &direction : directions) {
+				CHECK_EQ(direction, Vector2());
+			}
+		}
+
 		navigation_server->free(region);
 		navigation_server->free(map);
 		navigation_server->physics_process(0.0); // Give server some cycles to commit.
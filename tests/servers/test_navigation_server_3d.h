@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/config/project_settings.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/resources/3d/primitive_meshes.h"
 #include "servers/navigation_server_3d.h"
@@ -50,6 +51,17 @@ public:
 	Variant function1_latest_arg0;
 };
 
+class AvoidanceCallbackRecorder : public Object {
+	GDCLASS(AvoidanceCallbackRecorder, Object);
+
+public:
+	void record(Variant p_safe_velocity, int p_index) {
+		safe_velocities.write[p_index] = p_safe_velocity;
+	}
+
+	Vector<Vector3> safe_velocities;
+};
+
 static inline Array build_array() {
 	return Array();
 }
@@ -525,6 +537,69 @@ TEST_SUITE("[Navigation3D]") {
 		navigation_server->physics_process(0.0); // Give server some cycles to commit.
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should make agents avoid each other with the avoidance spatial grid") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		const Variant use_spatial_grid = ProjectSettings::get_singleton()->get_setting("navigation/3d/avoidance_use_spatial_grid");
+		const Variant deterministic = ProjectSettings::get_singleton()->get_setting("navigation/3d/avoidance_deterministic");
+		ProjectSettings::get_singleton()->set_setting("navigation/3d/avoidance_deterministic", true);
+
+		ProjectSettings::get_singleton()->set_setting("navigation/3d/avoidance_use_spatial_grid", true);
+		RID grid_map_1 = navigation_server->map_create();
+		RID grid_map_2 = navigation_server->map_create();
+		ProjectSettings::get_singleton()->set_setting("navigation/3d/avoidance_use_spatial_grid", false);
+		RID tree_map = navigation_server->map_create();
+
+		ProjectSettings::get_singleton()->set_setting("navigation/3d/avoidance_use_spatial_grid", use_spatial_grid);
+		ProjectSettings::get_singleton()->set_setting("navigation/3d/avoidance_deterministic", deterministic);
+
+		navigation_server->map_set_active(grid_map_1, true);
+		navigation_server->map_set_active(grid_map_2, true);
+		navigation_server->map_set_active(tree_map, true);
+
+		// Agents move towards the center of the map in a lattice of 16x16 agents.
+		const int agent_count = 16 * 16;
+		Vector<RID> agents;
+		AvoidanceCallbackRecorder recorders[3];
+		const RID maps[3] = { grid_map_1, grid_map_2, tree_map };
+		for (int map_index = 0; map_index < 3; map_index++) {
+			recorders[map_index].safe_velocities.resize(agent_count);
+			for (int i = 0; i < agent_count; i++) {
+				const Vector3 position = Vector3(i % 16, 0, i / 16) * 1.5;
+				RID agent = navigation_server->agent_create();
+				navigation_server->agent_set_map(agent, maps[map_index]);
+				navigation_server->agent_set_avoidance_enabled(agent, true);
+				navigation_server->agent_set_position(agent, position);
+				navigation_server->agent_set_radius(agent, 0.5);
+				navigation_server->agent_set_neighbor_distance(agent, 3.0);
+				navigation_server->agent_set_velocity(agent, (Vector3(11.25, 0, 11.25) - position).limit_length(1.0));
+				navigation_server->agent_set_avoidance_callback(agent, callable_mp(&recorders[map_index], &AvoidanceCallbackRecorder::record).bind(i));
+				agents.push_back(agent);
+			}
+		}
+
+		// Agents in the crowd have fewer neighbors than their maximum, so both searches find the same ones.
+		navigation_server->physics_process(0.1);
+		for (int i = 0; i < agent_count; i++) {
+			CHECK(recorders[0].safe_velocities[i].distance_to(recorders[2].safe_velocities[i]) < 0.001);
+		}
+
+		for (int step = 0; step < 4; step++) {
+			navigation_server->physics_process(0.1);
+		}
+		for (int i = 0; i < agent_count; i++) {
+			CHECK_MESSAGE(recorders[0].safe_velocities[i] == recorders[1].safe_velocities[i], "Deterministic avoidance should give the same velocities for the same inputs.");
+		}
+
+		for (const RID &agent : agents) {
+			navigation_server->free(agent);
+		}
+		navigation_server->free(tree_map);
+		navigation_server->free(grid_map_2);
+		navigation_server->free(grid_map_1);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
 #ifndef DISABLE_DEPRECATED
 	// This test case uses only public APIs on purpose - other test cases use simplified baking.
 	// FIXME: Remove once deprecated `region_bake_navigation_mesh()` is removed.
@@ -805,6 +880,232 @@ TEST_SUITE("[Navigation3D]") {
 			CHECK_EQ(query_result->get_path().size(), 0);
 		}
 
+		SUBCASE("Batched queries should yield the same paths as single queries") {
+			Ref<NavigationPathQueryParameters3D> query_parameters;
+			query_parameters.instantiate();
+			query_parameters->set_map(map);
+			const PackedVector3Array start_target_positions = { Vector3(0, 0, 0), Vector3(10, 0, 10), Vector3(4, 0, -4), Vector3(-4, 0, 4), Vector3(-3, 0, -3), Vector3(3, 0, 3) };
+
+			const Dictionary batch_result = navigation_server->query_path_batch(query_parameters, start_target_positions);
+			const PackedVector3Array path_points = batch_result["path_points"];
+			const PackedInt32Array path_offsets = batch_result["path_offsets"];
+			REQUIRE_EQ(path_offsets.size(), 4);
+			CHECK_EQ(path_offsets[0], 0);
+			CHECK_EQ(path_offsets[3], path_points.size());
+
+			Ref<NavigationPathQueryResult3D> query_result;
+			query_result.instantiate();
+			for (int i = 0; i < 3; i++) {
+				query_parameters->set_start_position(start_target_positions[i * 2 + 0]);
+				query_parameters->set_target_position(start_target_positions[i * 2 + 1]);
+				navigation_server->query_path(query_parameters, query_result);
+				const Vector<Vector3> path = query_result->get_path();
+				CHECK_NE(path.size(), 0);
+				REQUIRE_EQ(path_offsets[i + 1] - path_offsets[i], path.size());
+				for (int j = 0; j < path.size(); j++) {
+					CHECK(path_points[path_offsets[i] + j].is_equal_approx(path[j]));
+				}
+			}
+		}
+
+		SUBCASE("Following flow directions should reach the target about as fast as following the path") {
+			const Vector3 target_position = navigation_server->map_get_closest_point(map, Vector3(4, 0, 4));
+			const PackedVector3Array start_positions = { Vector3(-4, 0, -4), Vector3(4, 0, -4), Vector3(-4, 0, 4), Vector3(0, 0, 0) };
+
+			for (const Vector3 &start_position : start_positions) {
+				const Vector<Vector3> path = navigation_server->map_get_path(map, start_position, target_position, true);
+				REQUIRE_NE(path.size(), 0);
+				real_t path_length = 0.0;
+				for (int i = 1; i < path.size(); i++) {
+					path_length += path[i - 1].distance_to(path[i]);
+				}
+
+				Vector3 position = navigation_server->map_get_closest_point(map, start_position);
+				real_t traveled_length = 0.0;
+				for (int step = 0; step < 400 && position.distance_to(target_position) > 0.1; step++) {
+					const PackedVector3Array directions = navigation_server->map_get_flow_directions(map, target_position, { position });
+					REQUIRE_EQ(directions.size(), 1);
+					REQUIRE_NE(directions[0], Vector3());
+					const real_t step_length = MIN(real_t(0.1), position.distance_to(target_position));
+					position += directions[0] * step_length;
+					traveled_length += step_length;
+				}
+				CHECK(position.distance_to(target_position) <= 0.1);
+				CHECK(traveled_length <= path_length * 1.5 + 0.1);
+			}
+
+			// Positions and targets on polygons without a matching navigation layer can not be reached.
+			const PackedVector3Array directions = navigation_server->map_get_flow_directions(map, target_position, start_positions, 2);
+			REQUIRE_EQ(directions.size(), start_positions.size());
+			for (const Vector3 &direction : directions) {
+				CHECK_EQ(direction, Vector3());
+			}
+		}
+
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should find paths with the path hierarchy") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		// A 20x20 grid of cells with a wall in the middle that paths have to go around.
+		Ref<NavigationMesh> navigation_mesh;
+		navigation_mesh.instantiate();
+		Vector<Vector3> vertices;
+		for (int z = 0; z <= 20; z++) {
+			for (int x = 0; x <= 20; x++) {
+				vertices.push_back(Vector3(x, 0, z));
+			}
+		}
+		navigation_mesh->set_vertices(vertices);
+		for (int z = 0; z < 20; z++) {
+			for (int x = 0; x < 20; x++) {
+				if (x == 10 && z < 15) {
+					continue;
+				}
+				Vector<int> polygon;
+				polygon.push_back(z * 21 + x);
+				polygon.push_back(z * 21 + x + 1);
+				polygon.push_back((z + 1) * 21 + x + 1);
+				polygon.push_back((z + 1) * 21 + x);
+				navigation_mesh->add_polygon(polygon);
+			}
+		}
+
+		const Variant cluster_size = ProjectSettings::get_singleton()->get_setting("navigation/3d/path_hierarchy_cluster_size");
+		ProjectSettings::get_singleton()->set_setting("navigation/3d/path_hierarchy_cluster_size", 4.0);
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		ProjectSettings::get_singleton()->set_setting("navigation/3d/path_hierarchy_cluster_size", cluster_size);
+
+		// The 4x4 cells of the grid are split into clusters, more on the cells cut by the wall.
+		CHECK_GE(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_CLUSTER_COUNT), 25);
+
+		Ref<NavigationPathQueryParameters3D> query_parameters;
+		query_parameters.instantiate();
+		query_parameters->set_map(map);
+		query_parameters->set_start_position(Vector3(2, 0, 2));
+		query_parameters->set_target_position(Vector3(18, 0, 2));
+
+		Ref<NavigationPathQueryResult3D> query_result;
+		query_result.instantiate();
+		navigation_server->query_path(query_parameters, query_result);
+		const Vector<Vector3> path = query_result->get_path();
+
+		query_parameters->set_use_hierarchical_pathfinding(true);
+		navigation_server->query_path(query_parameters, query_result);
+		const Vector<Vector3> hierarchical_path = query_result->get_path();
+
+		// Only the hierarchical query is counted, and only if it didn't fall back to searching the whole map.
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_HIERARCHICAL_PATH_QUERY_COUNT), 1);
+
+		REQUIRE_GE(path.size(), 2);
+		REQUIRE_GE(hierarchical_path.size(), 2);
+		CHECK(hierarchical_path[0].is_equal_approx(path[0]));
+		CHECK(hierarchical_path[hierarchical_path.size() - 1].is_equal_approx(path[path.size() - 1]));
+		CHECK(hierarchical_path[hierarchical_path.size() - 1].is_equal_approx(Vector3(18, 0, 2)));
+
+		real_t path_length = 0.0;
+		for (int i = 1; i < path.size(); i++) {
+			path_length += path[i - 1].distance_to(path[i]);
+		}
+		real_t hierarchical_path_length = 0.0;
+		for (int i = 1; i < hierarchical_path.size(); i++) {
+			hierarchical_path_length += hierarchical_path[i - 1].distance_to(hierarchical_path[i]);
+		}
+		// The path has to go around the wall.
+		CHECK_GT(path_length, 26.0);
+		CHECK_LE(hierarchical_path_length, path_length * 1.2);
+
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should reuse cached path corridors") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		// A 10x10 grid of cells with a wall in the middle that paths have to go around.
+		Ref<NavigationMesh> navigation_mesh;
+		navigation_mesh.instantiate();
+		Vector<Vector3> vertices;
+		for (int z = 0; z <= 10; z++) {
+			for (int x = 0; x <= 10; x++) {
+				vertices.push_back(Vector3(x, 0, z));
+			}
+		}
+		navigation_mesh->set_vertices(vertices);
+		for (int z = 0; z < 10; z++) {
+			for (int x = 0; x < 10; x++) {
+				if (x == 5 && z < 8) {
+					continue;
+				}
+				Vector<int> polygon;
+				polygon.push_back(z * 11 + x);
+				polygon.push_back(z * 11 + x + 1);
+				polygon.push_back((z + 1) * 11 + x + 1);
+				polygon.push_back((z + 1) * 11 + x);
+				navigation_mesh->add_polygon(polygon);
+			}
+		}
+
+		const Variant path_cache_size = ProjectSettings::get_singleton()->get_setting("navigation/3d/path_cache_size");
+		ProjectSettings::get_singleton()->set_setting("navigation/3d/path_cache_size", 16);
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		ProjectSettings::get_singleton()->set_setting("navigation/3d/path_cache_size", path_cache_size);
+
+		Ref<NavigationPathQueryParameters3D> query_parameters;
+		query_parameters.instantiate();
+		query_parameters->set_map(map);
+		Ref<NavigationPathQueryResult3D> query_result;
+		query_result.instantiate();
+
+		// Both queries start and end on the same polygons.
+		query_parameters->set_start_position(Vector3(1.5, 0, 1.5));
+		query_parameters->set_target_position(Vector3(8.5, 0, 1.5));
+		navigation_server->query_path(query_parameters, query_result);
+		const Vector<Vector3> first_path = query_result->get_path();
+
+		query_parameters->set_start_position(Vector3(1.2, 0, 1.7));
+		query_parameters->set_target_position(Vector3(8.7, 0, 1.3));
+		navigation_server->query_path(query_parameters, query_result);
+		const Vector<Vector3> second_path = query_result->get_path();
+
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_CACHE_MISS_COUNT), 1);
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_CACHE_HIT_COUNT), 1);
+
+		REQUIRE_GE(first_path.size(), 3);
+		REQUIRE_GE(second_path.size(), 3);
+		CHECK(second_path[0].is_equal_approx(Vector3(1.2, 0, 1.7)));
+		CHECK(second_path[second_path.size() - 1].is_equal_approx(Vector3(8.7, 0, 1.3)));
+		// The cached corridor still leads around the wall.
+		for (const Vector3 &point : second_path) {
+			CHECK_FALSE((point.x > 5.0 && point.x < 6.0 && point.z < 8.0));
+		}
+
+		// Counts are reported per update.
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_CACHE_HIT_COUNT), 0);
+
 		navigation_server->free(region);
 		navigation_server->free(map);
 		navigation_server->physics_process(0.0); // Give server some cycles to commit.